@@ -20,11 +20,12 @@
         ProtocolStepPeriod = 47,    // U16    Period for each step in ms [1;65535]
         ProtocolVolume = 48,        // FLOAT  Volume value in uL [0.5;2000.0]
         ProtocolType = 49,          // U8     Step-based (0) or Volume-based protocol (1)
-        CalibrationValue1 = 50,     // U8     Calibration value 1
-        CalibrationValue2 = 51,     // U8     Calibration value 2
+        CalibrationValue1 = 50,     // FLOAT  Calibration offset in uL
+        CalibrationValue2 = 51,     // FLOAT  Calibration slope in uL/step
         EventsEnable = 52,          // U8     Enable the Events
         SetBoardType = 53,          // U8     Type of the board
         ProtocolState = 54,         // U8     State of the protocol (running or stopped)
-        ProtocolDirection = 55      // U8     Protocol direction
+        ProtocolDirection = 55,     // U8     Protocol direction
+        ProtocolConfiguration = 99  // U32[15] Protocol and IO configuration written at once
     }
 }
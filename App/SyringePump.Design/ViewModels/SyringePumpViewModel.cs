@@ -62,8 +62,8 @@ namespace SyringePump.Design.ViewModels
         [Reactive] public int DigitalInput0Config { get; set; }
         [Reactive] public int DigitalOutput0Config { get; set; }
         [Reactive] public int DigitalOutput1Config { get; set; }
-        [Reactive] public int CalibrationValue1 { get; set; }
-        [Reactive] public int CalibrationValue2 { get; set; }
+        [Reactive] public float CalibrationValue1 { get; set; }
+        [Reactive] public float CalibrationValue2 { get; set; } = 1.0f;
         [Reactive] public Direction ProtocolDirection { get; set; }
 
         [Reactive] public List<Direction> Directions { get; set; }
@@ -98,6 +98,9 @@ namespace SyringePump.Design.ViewModels
         private IDisposable _observable;
         private readonly Subject<HarpMessage> _msgsSubject;
         private DeviceConfiguration configuration;
+        // last configuration read from the device, keeps the values that aren't shown when saving
+        private uint[] protocolConfiguration;
+        private const int ProtocolConfigurationLength = 15;
 
         public SyringePumpViewModel()
         {
@@ -226,7 +229,10 @@ namespace SyringePump.Design.ViewModels
 
                 var msgs = new List<HarpMessage>();
 
-                // send commands to save every config (verify each step for board's reply)
+                // the whole configuration goes in a single message, the board checks it before applying any value
+                var config = protocolConfiguration?.Length == ProtocolConfigurationLength
+                    ? (uint[])protocolConfiguration.Clone()
+                    : new uint[ProtocolConfigurationLength];
 
                 // events
                 byte events = (byte)((Convert.ToByte(StepStateEvent) << 0) |
@@ -235,74 +241,32 @@ namespace SyringePump.Design.ViewModels
                                      (Convert.ToByte(SwitchReverseStateEvent) << 3) |
                                      (Convert.ToByte(InputStateEvent) << 4) |
                                      (Convert.ToByte(ProtocolStateEvent) << 5));
-                var eventsMessage = HarpCommand.WriteByte((int)PumpRegisters.EventsEnable, events);
-                msgs.Add(eventsMessage);
+                config[14] = events;
 
                 // motor microstep
-                byte motor = Convert.ToByte(MotorMicrostep);
-                var motorMessage = HarpCommand.WriteByte((int)PumpRegisters.MotorMicrostep, motor);
-                msgs.Add(motorMessage);
+                config[10] = Convert.ToByte(MotorMicrostep);
 
                 // di0, do0 and do1
-                byte di0 = Convert.ToByte(DigitalInput0Config);
-                var di0Message = HarpCommand.WriteByte((int)PumpRegisters.DigitalInput0Config, di0);
-                msgs.Add(di0Message);
+                config[11] = Convert.ToByte(DigitalInput0Config);
+                config[12] = Convert.ToByte(DigitalOutput0Config);
+                config[13] = Convert.ToByte(DigitalOutput1Config);
 
-                byte do0 = Convert.ToByte(DigitalOutput0Config);
-                var do0Message = HarpCommand.WriteByte((int)PumpRegisters.DigitalOutput0Config, do0);
-                msgs.Add(do0Message);
+                // protocol
+                config[0] = Convert.ToByte(ProtocolType);
+                config[1] = Convert.ToByte(ProtocolDirection);
 
-                byte do1 = Convert.ToByte(DigitalOutput1Config);
-                var do1Message = HarpCommand.WriteByte((int)PumpRegisters.DigitalOutput1Config, do1);
-                msgs.Add(do1Message);
+                // step protocol, the period is in microseconds
+                config[2] = Convert.ToUInt16(NumberOfSteps);
+                config[3] = Convert.ToUInt32(StepPeriod) * 1000;
 
-                // protocol
-                // protocol type
-                byte protocolType = Convert.ToByte(ProtocolType);
-                var protocolTypeMessage = HarpCommand.WriteByte((int)PumpRegisters.ProtocolType, protocolType);
-                msgs.Add(protocolTypeMessage);
-
-                // protocol direction
-                byte protocolDirection = Convert.ToByte(ProtocolDirection);
-                var protocolDirectionMessage =
-                    HarpCommand.WriteByte((int)PumpRegisters.ProtocolDirection, protocolDirection);
-                msgs.Add(protocolDirectionMessage);
-
-                // if step:
-                if (protocolType == 0)
-                {
-                    // number of steps
-                    ushort numberOfSteps = Convert.ToUInt16(NumberOfSteps);
-                    var numberOfStepsMessage =
-                        HarpCommand.WriteUInt16((int)PumpRegisters.ProtocolNumberOfSteps, numberOfSteps);
-                    msgs.Add(numberOfStepsMessage);
-
-                    // step period
-                    ushort stepPeriod = Convert.ToUInt16(StepPeriod);
-                    var stepPeriodMessage = HarpCommand.WriteUInt16((int)PumpRegisters.ProtocolStepPeriod, stepPeriod);
-                    msgs.Add(stepPeriodMessage);
-                }
-                else
-                {
-                    // flowrate
-                    float flowrate = Convert.ToSingle(Flowrate);
-                    var flowrateMessage = HarpCommand.WriteSingle((int)PumpRegisters.ProtocolFlowrate, flowrate);
-                    msgs.Add(flowrateMessage);
-                    // volume
-                    float volume = Convert.ToSingle(Volume);
-                    var volumeMessage = HarpCommand.WriteSingle((int)PumpRegisters.ProtocolVolume, volume);
-                    msgs.Add(volumeMessage);
-
-                    // calibration val 1
-                    byte calValue1 = Convert.ToByte(CalibrationValue1);
-                    var calValue1Message = HarpCommand.WriteByte((int)PumpRegisters.CalibrationValue1, calValue1);
-                    msgs.Add(calValue1Message);
-
-                    // calibration val 2
-                    byte calValue2 = Convert.ToByte(CalibrationValue2);
-                    var calValue2Message = HarpCommand.WriteByte((int)PumpRegisters.CalibrationValue2, calValue2);
-                    msgs.Add(calValue2Message);
-                }
+                // volume protocol in nl and calibration in nl and pl/step
+                config[4] = (uint)Math.Round(Flowrate * 1000.0);
+                config[5] = (uint)Math.Round(Volume * 1000.0);
+                config[6] = unchecked((uint)(int)Math.Round(CalibrationValue1 * 1000.0));
+                config[7] = (uint)Math.Round(CalibrationValue2 * 1000000.0);
+
+                var configMessage = HarpCommand.WriteUInt32((int)PumpRegisters.ProtocolConfiguration, config);
+                msgs.Add(configMessage);
 
                 if (savePermanently)
                 {
@@ -518,10 +482,10 @@ namespace SyringePump.Design.ViewModels
                     ProtocolType = item.GetPayloadByte();
                     break;
                 case PumpRegisters.CalibrationValue1:
-                    CalibrationValue1 = item.GetPayloadByte();
+                    CalibrationValue1 = item.GetPayloadSingle();
                     break;
                 case PumpRegisters.CalibrationValue2:
-                    CalibrationValue2 = item.GetPayloadByte();
+                    CalibrationValue2 = item.GetPayloadSingle();
                     break;
                 case PumpRegisters.ProtocolDirection:
                     ProtocolDirection = (Direction)item.GetPayloadByte();
@@ -541,8 +505,12 @@ namespace SyringePump.Design.ViewModels
                     break;
                 case PumpRegisters.ProtocolState:
                     break;
+                case PumpRegisters.ProtocolConfiguration:
+                    protocolConfiguration = item.GetPayloadArray<uint>();
+                    break;
                 default:
-                    throw new ArgumentOutOfRangeException();
+                    // registers that are not shown in the GUI
+                    break;
             }
         }
 
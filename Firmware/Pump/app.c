@@ -1,6 +1,7 @@
 #include "hwbp_core.h"
 #include "hwbp_core_regs.h"
 #include "hwbp_core_types.h"
+#include "hwbp_core_com.h"
 
 #include "app.h"
 #include "app_funcs.h"
@@ -8,6 +9,7 @@
 
 #define F_CPU 32000000
 #include <util/delay.h>
+#include <avr/interrupt.h>
 
 /************************************************************************/
 /* Declare application registers                                        */
@@ -71,82 +73,2635 @@ void core_callback_catastrophic_error_detected(void)
 /************************************************************************/
 /* User functions                                                       */
 /************************************************************************/
-#define DIR_FORWARD 1
-#define DIR_REVERSE 0
+uint16_t inactivity_counter = 0;
+
+/* Buttons */
+uint8_t but_push_counter_ms = 0;
+uint16_t but_long_push_counter_ms = 0;
+bool but_push_long_press = false;
+
+uint8_t but_pull_counter_ms = 0;
+uint16_t but_long_pull_counter_ms = 0;
+bool but_pull_long_press = false;
+
+uint8_t but_reset_counter_ms = 0;
+bool but_reset_pressed = false;
+bool but_reset_dir_change = false;
+
+/* Switches */
+bool switch_f_active = false;
+bool switch_r_active = false;
+uint8_t sw_f_counter_ms = 0;
+uint8_t sw_r_counter_ms = 0;
+// set on the press edge, so the steps towards the switch stop right away, and only cleared after a de-bounced release
+volatile bool switch_f_inhibit = false;
+volatile bool switch_r_inhibit = false;
+uint8_t sw_f_release_ms = 0;
+uint8_t sw_r_release_ms = 0;
+void clear_sw_f();
+void clear_sw_r();
+void switch_released(uint8_t direction);
+
+uint8_t curr_dir = DIR_FORWARD;
+uint8_t prev_dir = DIR_FORWARD;
+uint16_t step_period_counter = 0;
+
+bool running_protocol = false;
+// what the step engine is running, one of GM_PROTOCOL_* or of the internal MOTION_*
+uint8_t prot_type = GM_PROTOCOL_STEP;
+uint32_t prot_number_steps = 0;
+
+// the step engine plans one interval ahead, so the end of the protocol is seen two boundaries before
+#define PROT_RUNNING 0
+#define PROT_LAST_STEP 1    // the next boundary makes the last step
+#define PROT_STOPPING 2     // the next boundary ends the protocol
+uint8_t prot_ending = PROT_RUNNING;
+uint32_t prot_step_period = 0;
+uint32_t prot_step_period_frac = 0;
+
+/* Achieved rate of the current (or last) protocol */
+uint32_t prot_steps_done = 0;
+uint64_t prot_elapsed_ticks = 0;
+uint32_t prot_interval_ticks = 0;
+
+/* Volume protocol, fixed-point copies of the float registers */
+uint32_t prot_flowrate_nl = 500;            // nL/s
+uint32_t prot_volume_nl = 500;              // nL
+int32_t calibration_offset_nl = 0;          // nL
+uint32_t calibration_slope_pl = 1000000;    // pL/step
+
+/* Protocol queue */
+#define PROTOCOL_QUEUE_SIZE 16    // must be a power of 2
+#define PROTOCOL_QUEUE_MASK (PROTOCOL_QUEUE_SIZE - 1)
+
+typedef struct
+{
+	uint32_t steps;
+	uint32_t interval_ticks;
+	uint32_t dwell_ticks;
+	uint8_t direction;
+} ProtocolSegment;
+
+ProtocolSegment prot_queue[PROTOCOL_QUEUE_SIZE];
+// free running indexes, only the register writes the head and only the step engine moves the tail
+volatile uint8_t prot_queue_head = 0;
+volatile uint8_t prot_queue_tail = 0;
+// segment being planned (runs one step ahead of the tail) and steps left on the executing one
+uint8_t prot_queue_plan = 0;
+uint32_t prot_queue_seg_remaining = 0;
+
+/* Committed protocol parameters */
+// copies of the NEXT registers, the step engine only reads them while the mask is set
+volatile uint8_t prot_commit_pending = 0;
+uint32_t prot_commit_interval;
+uint32_t prot_commit_steps;
+uint8_t prot_commit_dir;
+// a reversal decelerates to a stop first and then continues with these
+bool prot_reverse_pending = false;
+uint32_t prot_reverse_steps;
+uint32_t prot_reverse_interval;
+uint32_t prot_reverse_frac;
+void protocol_run(void);
+
+/* DI0 step follower */
+// steps made by the PORTB interrupt while STEP follows DI0, accounted for on the 1 ms callback
+volatile int16_t di0_follow_steps = 0;
+// steps refused by the PORTB interrupt because of a switch, added to SWITCH_OVERRUN_STEPS on the 1 ms callback
+volatile uint8_t di0_follow_overrun = 0;
+
+/* Timestamp timer */
+// TCD0 runs free at 32 MHz / 8 and captures, through the event system, the DI0 edges (CCA)
+// and the core's second boundaries given by the TCC1 overflow (CCB)
+#define TS_TIMER_TICKS_PER_US 4
+#define TS_TIMER_TICKS_SHIFT 2
+// the core's microsecond counter has a resolution of 32 us
+#define TS_CORE_TOLERANCE_US 64
+uint16_t ts_timer_overflows = 0;
+uint32_t ts_second_start = 0;
+bool ts_second_start_valid = false;
+// level of DI0 after the last captured edge, each capture toggles it
+uint8_t di0_level = 0;
+
+/* CPU load */
+// measured on TCD0 (8 CPU cycles per count), the PORTC and PORTD edges are captured on CCC and CCD
+#define CPU_LOAD_CYCLES_PER_COUNT 8
+#define CPU_LOAD_CORE_TICK_COUNTS (500 * TS_TIMER_TICKS_PER_US)
+uint16_t cpu_tick_start;
+bool cpu_tick_start_valid = false;
+bool cpu_tick_measured = false;
+// exponential average of the cycles per tick, times 16
+uint32_t cpu_tick_average_x16;
+// TCD0 at the entry of the PORTB interrupt, taken by the capture interrupt that follows it
+volatile uint16_t cpu_portb_entry;
+// the core's TX ring buffer, written at the head and sent from the tail
+extern uint16_t hwbp_uart_head;
+extern uint16_t hwbp_uart_tail;
+void cpu_load_count(uint8_t index, uint16_t n);
+void cpu_load_latency(uint8_t index, uint16_t entry, uint16_t capture);
+void cpu_load_sample_tx(void);
+
+/* Step intervals */
+// the STEPs raised by the step engine are timestamped on TCD0 and compared with the interval commanded for them
+uint32_t intervals_last_step;
+uint64_t intervals_sum_ticks;
+void intervals_mark(void);
+void intervals_step(uint32_t interval_ticks);
+void intervals_reset(void);
+
+/* Homing */
+// the approach runs until the switch is reached
+#define HOMING_APPROACH_STEPS 0xFFFFFFFF
+uint8_t homing_dir = DIR_REVERSE;
+void homing_set_state(uint8_t state);
+void homing_motion_ended(void);
+
+/* Jog */
+// the jog runs while the button is held
+#define JOG_STEPS 0xFFFFFFFF
+uint8_t jog_dir = DIR_FORWARD;
+
+/* Refill cycle */
+// phases of the refill, while the step engine runs MOTION_REFILL
+#define REFILL_VALVE_TO_RESERVOIR 0
+#define REFILL_WITHDRAW 1
+#define REFILL_VALVE_TO_OUTPUT 2
+uint8_t refill_phase;
+uint8_t refill_infuse_dir = DIR_FORWARD;
+uint8_t refill_infuse_type;
+// steps delivered by the protocol before the current infusion
+uint32_t refill_delivered_steps;
+uint32_t refill_cycle_steps;
+uint32_t refill_start_ticks;
+void refill_motion_ended(void);
+bool refill_position_reached(void);
+void refill_start(void);
+uint32_t ts_timer_now(void);
+
+/* Automatic microstepping */
+// in the automatic mode steps are counted in sixteenths and each STEP makes a group of 16 >> mode of them
+bool microstep_auto = false;
+uint8_t microstep_weight = 1;
+// position of the driver in its sequence, in sixteenths of a full step, so modes are only switched on full steps
+uint8_t microstep_phase = 0;
+// the phase after the steps already planned by the step engine
+uint8_t microstep_plan_phase = 0;
+// STEPs closer than this make the automatic mode go coarser
+uint32_t microstep_auto_min_interval = 2000;
+// number of sixteenths made by the STEP ending the running interval, the planned one and the last group planned
+uint8_t prot_weight = 1;
+uint8_t prot_weight_next = 1;
+uint8_t prot_group_weight = 1;
+
+/* Scheduled commands */
+// register writes fired at a Harp time, kept sorted by time
+#define SCHEDULE_SIZE 8
+// commands due within this window are fired from the one-shot timer (TCD1) instead of the 1 ms callback
+#define SCHEDULE_ARM_WINDOW_US 4000
+// commands due sooner than this are fired right away
+#define SCHEDULE_MIN_ARM_US 8
+// fires later than this are counted as late
+#define SCHEDULE_LATE_US 64
+typedef struct
+{
+	uint32_t seconds;
+	uint32_t microseconds;
+	uint32_t value;
+	uint8_t address;
+} ScheduledCommand;
+ScheduledCommand schedule[SCHEDULE_SIZE];
+volatile uint8_t schedule_count = 0;
+volatile bool schedule_armed = false;
+
+/* Protocol progress */
+// set while a protocol started from START_PROTOCOL runs, including its refills
+bool progress_active = false;
+// the last report of a protocol is computed when it stops and sent from the 1 ms callback
+bool progress_final = false;
+uint16_t progress_ms = 0;
+uint8_t progress_last_percent = 0;
+void progress_start(void);
+void progress_stop(void);
+
+/* Status snapshot */
+// what was last sent, the snapshot is only sent when a state changed
+uint8_t status_last_flags = 0;
+int32_t status_last_position = 0;
+
+/* Decimated step reports */
+int32_t step_report_delta = 0;
+uint16_t step_report_ms = 0;
+
+/* Streaming mode */
+#define STREAM_FIFO_SIZE 4          // must be a power of 2
+#define STREAM_FIFO_MASK (STREAM_FIFO_SIZE - 1)
+// while stopped, the step engine polls for a new setpoint with this interval
+#define STREAM_IDLE_TICKS (1000 * STEP_TIMER_TICKS_PER_US)
+// the decay stops the motor once the rate drops below 1 step/s
+#define STREAM_MIN_RATE_MSPS 1000
+
+// setpoints in millisteps/s, signed with the direction
+int32_t stream_fifo[STREAM_FIFO_SIZE];
+volatile uint8_t stream_fifo_head = 0;
+volatile uint8_t stream_fifo_tail = 0;
+int32_t stream_last_rate = 0;
+uint16_t stream_period_counter = 0;
+
+// double buffer, the pending setpoint is copied to the active one on a step boundary
+bool stream_pending = false;
+uint32_t stream_pending_interval;
+uint32_t stream_pending_frac;
+uint8_t stream_pending_dir;
+uint32_t stream_interval = 0;
+uint32_t stream_frac = 0;
+uint32_t stream_frac_acc = 0;
+uint8_t stream_dir = DIR_FORWARD;
+bool stream_step_due = false;
+
+/* Step engine */
+// time after the rising edge at which the STEP pulse is cleared (driver needs at least 1 us)
+#define STEP_PULSE_WIDTH_TICKS (10 * STEP_TIMER_TICKS_PER_US)
+// intervals that don't fit the 16 bits timer are split in chunks of this size
+#define STEP_TIMER_MAX_CHUNK 0x8000
+
+bool step_timer_running = false;
+uint32_t step_interval_ticks = 0;
+uint32_t step_remaining_ticks = 0;
+
+/* Step playback (TCE0 + DMA) */
+// each entry is a mask toggled on PORTA and the timer period until the next entry
+#define PLAYBACK_BLOCK_SIZE 64
+#define PLAYBACK_MASK_STEP (1 << 0)
+#define PLAYBACK_RUNNING 0
+#define PLAYBACK_LAST 1     // the gap after the last step is being written
+#define PLAYBACK_DONE 2     // the entry ending the protocol was written
+#define PLAYBACK_NO_END 0xFF
+
+// double buffer, one half plays while the other is refilled
+uint8_t playback_pattern[2][PLAYBACK_BLOCK_SIZE];
+uint16_t playback_period[2][PLAYBACK_BLOCK_SIZE];
+uint8_t playback_entries[2];
+uint8_t playback_half;
+uint8_t playback_end_half;
+bool playback_active = false;
+uint8_t playback_state;
+// ticks still to wait before the next toggle
+uint32_t playback_gap;
+// ticks played since the last STEP, the elapsed time is accounted on each STEP like the step engine does
+uint32_t playback_since_step;
+bool playback_start(void);
+void playback_stop(void);
+void step_report_count(int16_t steps);
+void clear_step();
+
+/* Returns num / den, saturated to 32 bits, and optionally the remainder */
+uint32_t div_u64_u32(uint64_t num, uint32_t den, uint32_t * remainder)
+{
+	uint32_t rem = 0;
+	uint32_t quot = 0;
+	
+	// the upper half must be smaller than the divisor for the result to fit
+	if(den == 0 || (uint32_t)(num >> 32) >= den)
+	{
+		if(remainder)
+			*remainder = 0;
+		return 0xFFFFFFFF;
+	}
+	
+	// bitwise long division, much cheaper on the AVR than the generic 64-bit division
+	for(uint8_t i = 0; i < 64; i++)
+	{
+		uint8_t carry = rem >> 31;
+		rem = (rem << 1) | (uint8_t)(num >> 63);
+		num <<= 1;
+		quot <<= 1;
+		
+		if(carry || rem >= den)
+		{
+			rem -= den;
+			quot |= 1;
+		}
+	}
+	
+	if(remainder)
+		*remainder = rem;
+	
+	return quot;
+}
+
+/* Returns a * b / c with a 64-bit intermediate product, saturated to 32 bits */
+uint32_t mul_div(uint32_t a, uint32_t b, uint32_t c)
+{
+	return div_u64_u32((uint64_t)a * b, c, 0);
+}
+
+/* Ramp planner */
+// ticks per second of the step timer, multiplied by 16 to match the 4 fractional bits of the speed
+#define RAMP_TICKS_PER_SECOND_X16 (STEP_TIMER_TICKS_PER_US * 1000000UL * 16)
+// each table entry covers one or more consecutive steps of the ramp
+#define RAMP_TABLE_SIZE 32
+
+uint32_t ramp_accel_table[RAMP_TABLE_SIZE];
+uint32_t ramp_decel_table[RAMP_TABLE_SIZE];
+uint32_t ramp_cruise_interval;
+uint32_t ramp_cruise_frac;
+uint32_t ramp_cruise_speed_sq;
+uint32_t ramp_frac_acc;
+uint32_t ramp_last_interval;
+
+uint32_t ramp_accel_steps;
+uint32_t ramp_cruise_steps;
+uint32_t ramp_decel_steps;
+
+uint8_t ramp_accel_index;
+uint32_t ramp_accel_sub;
+uint32_t ramp_accel_steps_per_entry;
+uint8_t ramp_decel_index;
+uint32_t ramp_decel_sub;
+uint32_t ramp_decel_steps_per_entry;
+// squared speed the profile starts from, standstill unless a move sets it around ramp_plan()
+uint32_t ramp_entry_speed_sq = 0;
+
+uint16_t isqrt32(uint32_t x)
+{
+	uint32_t res = 0;
+	uint32_t bit = (uint32_t)1 << 30;
+	
+	while(bit > x)
+		bit >>= 2;
+	
+	while(bit)
+	{
+		if(x >= res + bit)
+		{
+			x -= res + bit;
+			res = (res >> 1) + bit;
+		}
+		else
+			res >>= 1;
+		bit >>= 2;
+	}
+	
+	return res;
+}
+
+/* Interval, in ticks, of a step whose squared speed is speed_sq (steps^2/s^2) */
+uint32_t ramp_interval_from_speed_sq(uint32_t speed_sq)
+{
+	uint32_t speed_x16;
+	
+	// speed with 4 fractional bits, keeping precision at low speeds
+	if(speed_sq < ((uint32_t)1 << 24))
+		speed_x16 = isqrt32(speed_sq << 8);
+	else
+		speed_x16 = (uint32_t)isqrt32(speed_sq) << 4;
+	
+	if(speed_x16 == 0)
+		speed_x16 = 1;
+	
+	return RAMP_TICKS_PER_SECOND_X16 / speed_x16;
+}
+
+/* Fills the table with the intervals of a ramp going from the squared speed from_sq towards the cruise speed */
+uint32_t ramp_fill_table(uint32_t * table, uint32_t steps, uint16_t rate, uint32_t from_sq)
+{
+	uint32_t steps_per_entry = (steps + RAMP_TABLE_SIZE - 1) / RAMP_TABLE_SIZE;
+	uint8_t entries = (steps + steps_per_entry - 1) / steps_per_entry;
+	uint32_t step = steps_per_entry / 2;
+	uint32_t delta;
+	
+	for(uint8_t i = 0; i < entries; i++, step += steps_per_entry)
+	{
+		// speed at the middle of the step: v^2 = v0^2 +- 2 * a * (step + 0.5)
+		delta = rate * (2 * step + 1);
+		
+		if(from_sq > ramp_cruise_speed_sq)
+		{
+			table[i] = ramp_interval_from_speed_sq(from_sq > delta ? from_sq - delta : 0);
+			if(table[i] > ramp_cruise_interval)
+				table[i] = ramp_cruise_interval;
+		}
+		else
+		{
+			table[i] = ramp_interval_from_speed_sq(from_sq + delta);
+			if(table[i] < ramp_cruise_interval)
+				table[i] = ramp_cruise_interval;
+		}
+	}
+	
+	return steps_per_entry;
+}
+
+/* Precomputes the trapezoidal profile, the step path only does table lookups */
+/* cruise_frac is the fractional part of the cruise interval, in 1/2^32 ticks */
+/* The acceleration goes from ramp_entry_speed_sq to the cruise speed (slowing down if it's above) and the deceleration to standstill */
+void ramp_plan(uint32_t steps, uint32_t cruise_interval, uint32_t cruise_frac, uint16_t accel, uint16_t decel)
+{
+	uint32_t cruise_speed = (STEP_TIMER_TICKS_PER_US * 1000000UL) / cruise_interval;
+	uint32_t cruise_speed_sq = cruise_speed * cruise_speed;
+	uint32_t entry_sq = ramp_entry_speed_sq;
+	uint32_t accel_steps = 0;
+	uint32_t decel_steps = 0;
+	
+	ramp_cruise_interval = cruise_interval;
+	ramp_cruise_frac = cruise_frac;
+	ramp_cruise_speed_sq = cruise_speed_sq;
+	ramp_frac_acc = 0;
+	ramp_last_interval = cruise_interval;
+	
+	if(accel)
+		accel_steps = (cruise_speed_sq > entry_sq ? cruise_speed_sq - entry_sq : entry_sq - cruise_speed_sq) / (2 * (uint32_t)accel);
+	if(decel)
+		decel_steps = cruise_speed_sq / (2 * (uint32_t)decel);
+	
+	if(accel_steps + decel_steps > steps)
+	{
+		if(entry_sq > cruise_speed_sq)
+		{
+			// already too fast, the slow down to the cruise speed is cut short so the deceleration still ends at standstill
+			if(decel_steps > steps)
+				decel_steps = steps;
+			accel_steps = steps - decel_steps;
+		}
+		else if(accel && decel)
+		{
+			// too short to reach the cruise speed, ramps meet where v0^2 + 2 * a * n_accel = 2 * d * n_decel
+			uint64_t reach = 2 * (uint64_t)decel * steps;
+			
+			accel_steps = 0;
+			if(reach > entry_sq)
+				accel_steps = div_u64_u32(reach - entry_sq, 2 * ((uint32_t)accel + decel), 0);
+			if(accel_steps > steps)
+				accel_steps = steps;
+			decel_steps = steps - accel_steps;
+		}
+		else if(accel)
+			accel_steps = steps;
+		else
+			decel_steps = steps;
+	}
+	
+	ramp_accel_steps = accel_steps;
+	ramp_decel_steps = decel_steps;
+	ramp_cruise_steps = steps - accel_steps - decel_steps;
+	
+	ramp_accel_index = 0;
+	ramp_accel_sub = 0;
+	if(accel_steps)
+		ramp_accel_steps_per_entry = ramp_fill_table(ramp_accel_table, accel_steps, accel, entry_sq);
+	
+	// the deceleration table is indexed by the number of steps still to go
+	if(decel_steps)
+	{
+		ramp_decel_steps_per_entry = ramp_fill_table(ramp_decel_table, decel_steps, decel, 0);
+		ramp_decel_index = (decel_steps - 1) / ramp_decel_steps_per_entry;
+		ramp_decel_sub = (decel_steps - 1) % ramp_decel_steps_per_entry;
+	}
+}
+
+uint32_t ramp_steps_left(void)
+{
+	return ramp_accel_steps + ramp_cruise_steps + ramp_decel_steps;
+}
+
+/* Returns the interval preceding the next step of the planned profile, or 0 when it ended */
+uint32_t ramp_next_interval(void)
+{
+	if(ramp_accel_steps)
+	{
+		ramp_accel_steps--;
+		ramp_last_interval = ramp_accel_table[ramp_accel_index];
+		if(++ramp_accel_sub == ramp_accel_steps_per_entry)
+		{
+			ramp_accel_sub = 0;
+			ramp_accel_index++;
+		}
+	}
+	else if(ramp_cruise_steps)
+	{
+		ramp_cruise_steps--;
+		ramp_last_interval = ramp_cruise_interval;
+		
+		// spread the fractional tick over the intervals, so the average rate is exact
+		ramp_frac_acc += ramp_cruise_frac;
+		if(ramp_frac_acc < ramp_cruise_frac)
+			ramp_last_interval++;
+	}
+	else if(ramp_decel_steps)
+	{
+		ramp_decel_steps--;
+		ramp_last_interval = ramp_decel_table[ramp_decel_index];
+		if(ramp_decel_sub == 0)
+		{
+			ramp_decel_sub = ramp_decel_steps_per_entry - 1;
+			ramp_decel_index--;
+		}
+		else
+			ramp_decel_sub--;
+	}
+	else
+	{
+		// the profile ended, there are no more steps
+		return 0;
+	}
+	
+	return ramp_last_interval;
+}
+
+void step_timer_load_chunk(void)
+{
+	uint16_t chunk;
+	
+	// splitting this way leaves a last chunk of at least STEP_TIMER_MAX_CHUNK, so a new PER is never below CNT
+	if(step_remaining_ticks > 0xFFFF)
+		chunk = STEP_TIMER_MAX_CHUNK;
+	else
+		chunk = step_remaining_ticks;
+	
+	step_remaining_ticks -= chunk;
+	TCC0.PER = chunk - 1;
+}
+
+void step_timer_start(uint32_t interval_ticks)
+{
+	step_interval_ticks = interval_ticks;
+	step_remaining_ticks = interval_ticks;
+	
+	// the first step happens after one full interval, like the remaining ones
+	timer_type0_enable(&TCC0, TIMER_PRESCALER_DIV8, STEP_TIMER_MAX_CHUNK, INT_LEVEL_LOW);
+	step_timer_load_chunk();
+	TCC0.CCA = STEP_PULSE_WIDTH_TICKS;
+	TCC0.INTCTRLB = INT_LEVEL_LOW;
+	
+	step_timer_running = true;
+	intervals_mark();
+}
+
+void step_timer_stop(void)
+{
+	timer_type0_stop(&TCC0);
+	step_timer_running = false;
+	
+	if(playback_active)
+		playback_stop();
+}
+
+void microstep_set_pins(uint8_t mode)
+{
+	switch (mode)
+	{
+		case GM_STEP_FULL:
+			clr_MS1;
+			clr_MS2;
+			clr_MS3;
+			break;
+		
+		case GM_STEP_HALF:
+			set_MS1;
+			clr_MS2;
+			clr_MS3;
+			break;
+		
+		case GM_STEP_QUARTER:
+			clr_MS1;
+			set_MS2;
+			clr_MS3;
+			break;
+		
+		case GM_STEP_EIGHTH:
+			set_MS1;
+			set_MS2;
+			clr_MS3;
+			break;
+		
+		default:
+			set_MS1;
+			set_MS2;
+			set_MS3;
+			break;
+	}
+	
+	microstep_weight = microstep_auto ? (16 >> mode) : 1;
+	
+	if(app_regs.REG_MICROSTEP_EFFECTIVE != mode)
+	{
+		app_regs.REG_MICROSTEP_EFFECTIVE = mode;
+		if(app_regs.REG_EVT_ENABLE_EXT & B_EVT_EXT_MICROSTEP)
+			core_func_send_event(ADD_REG_MICROSTEP_EFFECTIVE, true);
+	}
+}
+
+/* Switches the driver to the mode in which a STEP makes weight sixteenths */
+void microstep_apply_weight(uint8_t weight)
+{
+	uint8_t mode = GM_STEP_SIXTEENTH;
+	
+	if(weight == microstep_weight)
+		return;
+	
+	for(; weight > 1; weight >>= 1)
+		mode--;
+	
+	microstep_set_pins(mode);
+}
+
+/* Returns the weight of the next STEP given the interval of each step, changing one level at a time on full steps only */
+uint8_t microstep_auto_weight(uint32_t interval, uint8_t weight, uint8_t phase)
+{
+	if(!microstep_auto || interval == 0 || phase != 0)
+		return weight;
+	
+	// coarser when the STEPs would come faster than the limit
+	if(weight < 16 && interval < microstep_auto_min_interval / weight)
+		return weight << 1;
+	
+	// finer once the STEPs would stay below 3/4 of the limit, the gap is the hysteresis
+	if(weight > 1 && interval >= microstep_auto_min_interval * 4 / 3 / (weight >> 1))
+		return weight >> 1;
+	
+	return weight;
+}
+
+uint8_t protocol_queue_count(void)
+{
+	return prot_queue_head - prot_queue_tail;
+}
+
+bool protocol_queue_push(uint32_t steps, uint32_t interval_us, uint8_t direction, uint32_t dwell_us)
+{
+	ProtocolSegment * segment;
+	
+	if(protocol_queue_count() >= PROTOCOL_QUEUE_SIZE)
+		return false;
+	
+	segment = &prot_queue[prot_queue_head & PROTOCOL_QUEUE_MASK];
+	segment->steps = steps;
+	segment->interval_ticks = interval_us * STEP_TIMER_TICKS_PER_US;
+	segment->dwell_ticks = dwell_us * STEP_TIMER_TICKS_PER_US;
+	segment->direction = direction;
+	
+	// publish the segment only after it is complete
+	prot_queue_head++;
+	
+	return true;
+}
+
+void protocol_queue_clear(void)
+{
+	prot_queue_head = prot_queue_tail;
+}
+
+/* Starts executing the segment at the tail of the queue */
+void protocol_queue_execute_tail(void)
+{
+	ProtocolSegment * segment = &prot_queue[prot_queue_tail & PROTOCOL_QUEUE_MASK];
+	
+	prot_queue_seg_remaining = segment->steps;
+	app_write_REG_DIR_STATE(&segment->direction);
+}
+
+/* Returns the interval preceding the next step of the protocol, or 0 when there are no more steps */
+uint32_t protocol_next_interval(void)
+{
+	uint32_t interval = ramp_next_interval();
+	uint32_t dwell;
+	
+	if(interval || prot_type != GM_PROTOCOL_QUEUE)
+		return interval;
+	
+	// continue with the next segment of the queue, back-to-back
+	if((uint8_t)(prot_queue_plan + 1) == prot_queue_head)
+		return 0;
+	
+	dwell = prot_queue[prot_queue_plan & PROTOCOL_QUEUE_MASK].dwell_ticks;
+	prot_queue_plan++;
+	ramp_plan(prot_queue[prot_queue_plan & PROTOCOL_QUEUE_MASK].steps, prot_queue[prot_queue_plan & PROTOCOL_QUEUE_MASK].interval_ticks, 0, 0, 0);
+	
+	return dwell + ramp_next_interval();
+}
+
+/* Plans the interval preceding the next STEP, which makes a group of prot_group_weight steps */
+uint32_t protocol_next_step(void)
+{
+	uint8_t weight = microstep_auto_weight(ramp_last_interval, prot_group_weight, microstep_plan_phase);
+	uint32_t interval = protocol_next_interval();
+	uint8_t dir = curr_dir;
+	
+	if(interval == 0)
+		return 0;
+	
+	// a group never goes past the end of the profile (or of the queue segment), going finer is always possible
+	while(weight > 1 && ramp_steps_left() < (uint32_t)weight - 1)
+		weight >>= 1;
+	
+	for(uint8_t i = 1; i < weight; i++)
+		interval += ramp_next_interval();
+	
+	if(prot_type == GM_PROTOCOL_QUEUE)
+		dir = prot_queue[prot_queue_plan & PROTOCOL_QUEUE_MASK].direction;
+	
+	microstep_plan_phase = (microstep_plan_phase + (dir == DIR_FORWARD ? weight : -weight)) & 0x0F;
+	prot_group_weight = weight;
+	
+	return interval;
+}
+
+bool stream_push(int32_t rate_msps)
+{
+	if((uint8_t)(stream_fifo_head - stream_fifo_tail) >= STREAM_FIFO_SIZE)
+		return false;
+	
+	stream_fifo[stream_fifo_head & STREAM_FIFO_MASK] = rate_msps;
+	stream_fifo_head++;
+	
+	return true;
+}
+
+/* Converts a rate into the pending interval, which is picked up on the next step boundary */
+void stream_set_pending(int32_t rate_msps)
+{
+	uint8_t int_level = TCC0.INTCTRLA;
+	uint32_t rate = rate_msps < 0 ? -rate_msps : rate_msps;
+	uint32_t interval = 0;
+	uint32_t frac = 0;
+	uint32_t rem;
+	
+	if(rate)
+	{
+		// interval in ticks = ticks per second * 1000 / rate in millisteps/s
+		interval = div_u64_u32((uint64_t)STEP_TIMER_TICKS_PER_US * 1000000000UL, rate, &rem);
+		frac = div_u64_u32((uint64_t)rem << 32, rate, 0);
+	}
+	
+	stream_last_rate = rate_msps;
+	
+	// the step engine reads the pending setpoint from its interrupt
+	TCC0.INTCTRLA = 0;
+	stream_pending_interval = interval;
+	stream_pending_frac = frac;
+	stream_pending_dir = rate_msps < 0 ? DIR_REVERSE : DIR_FORWARD;
+	stream_pending = true;
+	TCC0.INTCTRLA = int_level;
+}
+
+/* Takes the next setpoint from the FIFO, called once per stream period */
+void stream_next_setpoint(void)
+{
+	if(stream_fifo_head != stream_fifo_tail)
+	{
+		stream_set_pending(stream_fifo[stream_fifo_tail & STREAM_FIFO_MASK]);
+		stream_fifo_tail++;
+		return;
+	}
+	
+	// underrun
+	if(app_regs.REG_STREAM_UNDERRUN_COUNT != 0xFFFF)
+		app_regs.REG_STREAM_UNDERRUN_COUNT++;
+	
+	if(app_regs.REG_STREAM_UNDERRUN_MODE == GM_STREAM_UNDERRUN_DECAY && stream_last_rate)
+	{
+		int32_t rate = stream_last_rate / 2;
+		
+		if(rate > -STREAM_MIN_RATE_MSPS && rate < STREAM_MIN_RATE_MSPS)
+			rate = 0;
+		
+		stream_set_pending(rate);
+	}
+}
+
+void stream_tick_1ms(void)
+{
+	if(++stream_period_counter >= app_regs.REG_STREAM_PERIOD)
+	{
+		stream_period_counter = 0;
+		stream_next_setpoint();
+	}
+}
+
+/* Loads the interval until the next step boundary, replacing the one just reloaded */
+void stream_schedule(void)
+{
+	uint32_t interval;
+	
+	if(stream_pending)
+	{
+		stream_pending = false;
+		stream_interval = stream_pending_interval;
+		stream_frac = stream_pending_frac;
+		stream_frac_acc = 0;
+		
+		if(stream_pending_dir != stream_dir)
+		{
+			stream_dir = stream_pending_dir;
+			app_write_REG_DIR_STATE(&stream_dir);
+		}
+	}
+	
+	if(stream_interval)
+	{
+		// nothing else is planned ahead, so the phase is the one of the driver
+		prot_weight = microstep_auto_weight(stream_interval, prot_weight, microstep_phase);
+		
+		interval = 0;
+		for(uint8_t i = 0; i < prot_weight; i++)
+		{
+			interval += stream_interval;
+			stream_frac_acc += stream_frac;
+			if(stream_frac_acc < stream_frac)
+				interval++;
+		}
+		stream_step_due = true;
+	}
+	else
+	{
+		interval = STREAM_IDLE_TICKS;
+		stream_step_due = false;
+	}
+	
+	step_remaining_ticks = interval;
+	step_timer_load_chunk();
+	prot_interval_ticks = interval;
+}
+
+void stream_start(void)
+{
+	stream_period_counter = 0;
+	stream_last_rate = 0;
+	stream_pending = false;
+	stream_interval = 0;
+	stream_dir = curr_dir;
+	app_regs.REG_STREAM_UNDERRUN_COUNT = 0;
+	
+	// a setpoint written before the start is used right away
+	if(stream_fifo_head != stream_fifo_tail)
+		stream_next_setpoint();
+}
+
+void stream_step(void)
+{
+	if(stream_step_due)
+	{
+		microstep_apply_weight(prot_weight);
+		app_regs.REG_STEP_STATE = 1;
+		app_write_REG_STEP_STATE(&app_regs.REG_STEP_STATE);
+		
+		intervals_step(prot_interval_ticks);
+		prot_steps_done += prot_weight;
+		prot_elapsed_ticks += prot_interval_ticks;
+	}
+	else
+		intervals_mark();
+	
+	// setpoints are switched here, so an interval is never cut short
+	stream_schedule();
+}
+
+/* Prepares the interval that follows the step being made now */
+void protocol_schedule_next(void)
+{
+	step_interval_ticks = protocol_next_step();
+	prot_weight_next = prot_group_weight;
+	
+	// no more steps after the next one, wait one more interval before stopping
+	if(step_interval_ticks == 0)
+	{
+		prot_ending = PROT_LAST_STEP;
+		step_interval_ticks = ramp_last_interval;
+	}
+}
+
+/* Replaces the interval just loaded with the first one of the profile planned now */
+void protocol_load_first(uint32_t interval)
+{
+	prot_ending = PROT_RUNNING;
+	prot_interval_ticks = interval;
+	prot_weight = prot_group_weight;
+	step_remaining_ticks = interval;
+	step_timer_load_chunk();
+	
+	protocol_schedule_next();
+}
+
+/* Continues with segments appended after the queue ran out, replacing the interval just loaded */
+bool protocol_queue_resume(void)
+{
+	uint32_t interval;
+	
+	if(prot_type != GM_PROTOCOL_QUEUE)
+		return false;
+	
+	interval = protocol_next_step();
+	if(interval == 0)
+		return false;
+	
+	if(prot_queue_seg_remaining == 0)
+		protocol_queue_execute_tail();
+	
+	protocol_load_first(interval);
+	return true;
+}
+
+/* Copies the NEXT registers for the step engine, which picks them up on the next step boundary */
+void protocol_commit(uint8_t fields)
+{
+	// the step engine never sees a half written copy
+	prot_commit_pending = 0;
+	prot_commit_interval = app_regs.REG_PROTOCOL_NEXT_PERIOD_US * STEP_TIMER_TICKS_PER_US;
+	prot_commit_steps = app_regs.REG_PROTOCOL_NEXT_STEPS;
+	prot_commit_dir = app_regs.REG_PROTOCOL_NEXT_DIRECTION;
+	prot_commit_pending = fields;
+	
+	app_regs.REG_PROTOCOL_COMMIT = fields;
+}
+
+/* Replans the rest of the running protocol with the committed parameters, from the speed it has now */
+void protocol_commit_apply(void)
+{
+	uint8_t fields = prot_commit_pending;
+	// the step ending the interval loaded now was already planned, unless the protocol was ending
+	uint8_t in_flight = (prot_ending == PROT_RUNNING) ? prot_weight : 0;
+	uint32_t speed = (STEP_TIMER_TICKS_PER_US * 1000000UL) / ramp_last_interval;
+	uint8_t dir = curr_dir;
+	uint32_t steps = ramp_steps_left();
+	uint32_t interval = ramp_cruise_interval;
+	uint32_t frac = ramp_cruise_frac;
+	uint16_t rate;
+	
+	prot_commit_pending = 0;
+	
+	// a reversal that didn't happen yet is changed instead
+	if(prot_reverse_pending)
+	{
+		dir = !curr_dir;
+		steps = prot_reverse_steps;
+		interval = prot_reverse_interval;
+		frac = prot_reverse_frac;
+	}
+	
+	if(fields & B_COMMIT_DIRECTION)
+		dir = prot_commit_dir;
+	
+	if(fields & B_COMMIT_PERIOD)
+	{
+		interval = prot_commit_interval;
+		frac = 0;
+	}
+	
+	// the steps left are counted from this boundary, so the step in flight is one of them
+	if(fields & B_COMMIT_STEPS)
+	{
+		steps = prot_commit_steps;
+		if(dir == curr_dir)
+			steps = (steps > in_flight) ? steps - in_flight : 0;
+	}
+	
+	// a refill resumes with the new rate and what's left
+	prot_step_period = interval;
+	prot_step_period_frac = frac;
+	prot_number_steps = refill_delivered_steps + prot_steps_done + in_flight + steps;
+	
+	prot_reverse_pending = (dir != curr_dir);
+	if(prot_reverse_pending)
+	{
+		prot_reverse_steps = steps;
+		prot_reverse_interval = interval;
+		prot_reverse_frac = frac;
+		
+		// decelerate to a stop on the current direction, protocol_reverse_resume() continues from there
+		ramp_plan(app_regs.REG_PROTOCOL_DECELERATION ? speed * speed / (2 * (uint32_t)app_regs.REG_PROTOCOL_DECELERATION) : 0, ramp_last_interval, 0, 0, app_regs.REG_PROTOCOL_DECELERATION);
+	}
+	else
+	{
+		// ramp from the current speed, slowing down uses the deceleration
+		rate = (interval > ramp_last_interval) ? app_regs.REG_PROTOCOL_DECELERATION : app_regs.REG_PROTOCOL_ACCELERATION;
+		ramp_entry_speed_sq = speed * speed;
+		ramp_plan(steps, interval, frac, rate, app_regs.REG_PROTOCOL_DECELERATION);
+		ramp_entry_speed_sq = 0;
+	}
+	
+	app_regs.REG_PROTOCOL_COMMIT = 0;
+	if(app_regs.REG_EVT_ENABLE_EXT & B_EVT_EXT_PROTOCOL_COMMIT)
+		core_func_send_event(ADD_REG_PROTOCOL_COMMIT, true);
+	
+	if(in_flight)
+	{
+		protocol_schedule_next();
+		return;
+	}
+	
+	// the protocol was ending, the interval loaded now is replaced by the first one of the new profile
+	interval = protocol_next_step();
+	if(interval)
+		protocol_load_first(interval);
+	else
+		prot_ending = PROT_STOPPING;
+}
+
+/* Continues on the opposite direction once the deceleration of a committed reversal stopped the motor */
+bool protocol_reverse_resume(void)
+{
+	uint8_t dir = !curr_dir;
+	
+	if(!prot_reverse_pending)
+		return false;
+	
+	prot_reverse_pending = false;
+	
+	// the refill withdraws what was delivered on the new direction only
+	refill_delivered_steps += prot_steps_done;
+	refill_infuse_dir = dir;
+	prot_number_steps = refill_delivered_steps + prot_reverse_steps;
+	
+	step_timer_stop();
+	app_write_REG_DIR_STATE(&dir);
+	ramp_plan(prot_reverse_steps, prot_reverse_interval, prot_reverse_frac, app_regs.REG_PROTOCOL_ACCELERATION, app_regs.REG_PROTOCOL_DECELERATION);
+	protocol_run();
+	return true;
+}
+
+void protocol_step(void)
+{
+	uint8_t weight = prot_weight;
+	
+	if(prot_type == GM_PROTOCOL_STREAM)
+	{
+		stream_step();
+		return;
+	}
+	
+	if(prot_ending == PROT_STOPPING)
+	{
+		// a boundary without a STEP, the next interval is measured from here
+		intervals_mark();
+		
+		if(protocol_reverse_resume())
+			return;
+		
+		if(protocol_queue_resume())
+			return;
+		
+		// the routines go on with their next move
+		if(prot_type == MOTION_HOMING)
+		{
+			homing_motion_ended();
+			return;
+		}
+		
+		if(prot_type == MOTION_REFILL)
+		{
+			refill_motion_ended();
+			return;
+		}
+		
+		// we reached the end, lets stop everything and reset variables
+		app_regs.REG_START_PROTOCOL = 0;
+		app_write_REG_START_PROTOCOL(&app_regs.REG_START_PROTOCOL);
+		return;
+	}
+	
+	// make step
+	microstep_apply_weight(weight);
+	app_regs.REG_DIR_STATE = curr_dir;
+	app_regs.REG_STEP_STATE = 1;
+	app_write_REG_DIR_STATE(&app_regs.REG_DIR_STATE);
+	app_write_REG_STEP_STATE(&app_regs.REG_STEP_STATE);
+	intervals_step(prot_interval_ticks);
+	
+	// account the interval that ended with this step, the next one was just reloaded
+	prot_steps_done += weight;
+	prot_elapsed_ticks += prot_interval_ticks;
+	prot_interval_ticks = step_interval_ticks;
+	prot_weight = prot_weight_next;
+	
+	// end of travel of the infusion
+	if(refill_position_reached())
+	{
+		refill_start();
+		return;
+	}
+	
+	// groups never span two segments
+	if(prot_type == GM_PROTOCOL_QUEUE && (prot_queue_seg_remaining -= weight) == 0)
+	{
+		// segment completed
+		prot_queue_tail++;
+		app_regs.REG_PROTOCOL_QUEUE_COUNT = protocol_queue_count();
+		if(app_regs.REG_EVT_ENABLE & B_EVT_PROTOCOL_QUEUE)
+			core_func_send_event(ADD_REG_PROTOCOL_QUEUE_COUNT, true);
+		
+		if(protocol_queue_count())
+			protocol_queue_execute_tail();
+	}
+	
+	// committed parameters are picked up on a step boundary
+	if(prot_commit_pending && (prot_type == GM_PROTOCOL_STEP || prot_type == GM_PROTOCOL_VOLUME))
+	{
+		protocol_commit_apply();
+		return;
+	}
+	
+	if(prot_ending == PROT_LAST_STEP)
+	{
+		if(!protocol_queue_resume())
+			prot_ending = PROT_STOPPING;
+		return;
+	}
+	
+	// interval to load on the next step boundary
+	protocol_schedule_next();
+}
+
+/* Called from TCC0 overflow interrupt */
+void step_timer_overflow(void)
+{
+	// still waiting for the remaining chunks of a long interval
+	if(step_remaining_ticks)
+	{
+		step_timer_load_chunk();
+		return;
+	}
+	
+	// reload before stepping so the interval timing stays in hardware
+	step_remaining_ticks = step_interval_ticks;
+	step_timer_load_chunk();
+	
+	if(running_protocol)
+	{
+		// the pulse ends on CCA, a STEP raised after it is cut short
+		if(TCC0.CNT >= STEP_PULSE_WIDTH_TICKS)
+			cpu_load_count(CPU_LOAD_LATE_STEPS, 1);
+		
+		protocol_step();
+	}
+}
+
+/* Starts the step engine on the profile already planned */
+void protocol_run(void)
+{
+	prot_ending = PROT_RUNNING;
+	prot_steps_done = 0;
+	prot_elapsed_ticks = 0;
+	microstep_plan_phase = microstep_phase;
+	prot_group_weight = microstep_weight;
+	prot_interval_ticks = protocol_next_step();
+	prot_weight = prot_group_weight;
+	
+	// nothing to do, just wait one interval before stopping
+	if(prot_interval_ticks == 0)
+	{
+		prot_ending = PROT_STOPPING;
+		prot_interval_ticks = ramp_last_interval;
+	}
+	
+	step_timer_start(prot_interval_ticks);
+	
+	if(prot_ending == PROT_RUNNING)
+		protocol_schedule_next();
+}
+
+void start_protocol()
+{
+	prot_type = app_regs.REG_PROTOCOL_TYPE;
+	refill_infuse_dir = curr_dir;
+	refill_infuse_type = prot_type;
+	refill_delivered_steps = 0;
+	progress_start();
+	intervals_reset();
+	
+	if(prot_type == GM_PROTOCOL_STREAM)
+	{
+		// runs until stopped, with the rate written to the FIFO
+		stream_start();
+		prot_weight = microstep_weight;
+		prot_steps_done = 0;
+		prot_elapsed_ticks = 0;
+		step_timer_start(STREAM_IDLE_TICKS);
+		stream_step_due = false;
+		return;
+	}
+	
+	if(prot_type == GM_PROTOCOL_QUEUE)
+	{
+		prot_queue_plan = prot_queue_tail;
+		ramp_plan(prot_queue[prot_queue_plan & PROTOCOL_QUEUE_MASK].steps, prot_queue[prot_queue_plan & PROTOCOL_QUEUE_MASK].interval_ticks, 0, 0, 0);
+		protocol_queue_execute_tail();
+	}
+	else
+		ramp_plan(prot_number_steps, prot_step_period, prot_step_period_frac, app_regs.REG_PROTOCOL_ACCELERATION, app_regs.REG_PROTOCOL_DECELERATION);
+	
+	if(playback_start())
+		return;
+	
+	protocol_run();
+}
+
+/* Runs a ramped move on the step engine for the routines that aren't user protocols */
+void motion_start(uint8_t type, uint8_t direction, uint32_t steps, uint32_t interval_ticks, uint16_t accel, uint16_t decel)
+{
+	step_timer_stop();
+	
+	prot_type = type;
+	app_write_REG_DIR_STATE(&direction);
+	ramp_plan(steps, interval_ticks, 0, accel, decel);
+	
+	running_protocol = true;
+	protocol_run();
+}
+
+void motion_stop(void)
+{
+	step_timer_stop();
+	running_protocol = false;
+	
+	// outside of the protocols the automatic mode steps in sixteenths, going finer is always possible
+	if(microstep_auto)
+		microstep_set_pins(GM_STEP_SIXTEENTH);
+}
+
+/* The playback accounts the steps once per block, so it only runs protocols that don't need each single step */
+bool playback_eligible(void)
+{
+	if(!app_regs.REG_STEP_PLAYBACK)
+		return false;
+	
+	if(prot_type != GM_PROTOCOL_STEP && prot_type != GM_PROTOCOL_VOLUME)
+		return false;
+	
+	// the automatic mode and the refill end of travel decide on each step
+	if(microstep_auto || app_regs.REG_REFILL_MODE != GM_REFILL_OFF)
+		return false;
+	
+	if(!STEP_REPORT_DECIMATED && (app_regs.REG_EVT_ENABLE & (B_EVT_STEP_STATE | B_EVT_POSITION)))
+		return false;
+	
+	if((app_regs.REG_DO1_CONFIG & MSK_OUT1_CONF) == GM_OUT1_STEP_STATE)
+		return false;
+	
+	// the switches stop the playback from their interrupt, but it can't start towards one
+	if(curr_dir == DIR_FORWARD)
+		return !read_SW_F && !switch_f_inhibit;
+	else
+		return !read_SW_R && !switch_r_inhibit;
+}
+
+/* Takes the next timer period out of the gap before the next toggle, long gaps are split like on the step engine */
+uint16_t playback_take_gap(void)
+{
+	uint16_t chunk;
+	
+	if(playback_gap > 0xFFFF)
+		chunk = STEP_TIMER_MAX_CHUNK;
+	else
+		chunk = playback_gap;
+	
+	playback_gap -= chunk;
+	return chunk - 1;
+}
+
+/* Writes the next entries of the planned profile to a half of the buffers, returns how many */
+uint8_t playback_fill(uint8_t half)
+{
+	uint8_t * pattern = playback_pattern[half];
+	uint16_t * period = playback_period[half];
+	uint32_t interval;
+	uint8_t n = 0;
+	
+	while(n < PLAYBACK_BLOCK_SIZE && playback_state != PLAYBACK_DONE)
+	{
+		// the rest of a long interval
+		if(playback_gap)
+		{
+			pattern[n] = 0;
+			period[n++] = playback_take_gap();
+			continue;
+		}
+	
+		// one interval after the last step, like on the step engine, the end of this block ends the protocol
+		if(playback_state == PLAYBACK_LAST)
+		{
+			pattern[n] = 0;
+			period[n++] = 0xFFFF;
+			playback_state = PLAYBACK_DONE;
+			playback_end_half = half;
+			break;
+		}
+	
+		// a STEP pulse never spans two blocks, so each block starts with STEP low
+		if(n > PLAYBACK_BLOCK_SIZE - 2)
+			break;
+	
+		interval = ramp_next_interval();
+		if(interval == 0)
+		{
+			playback_state = PLAYBACK_LAST;
+			interval = ramp_last_interval;
+		}
+	
+		pattern[n] = PLAYBACK_MASK_STEP;
+		period[n++] = STEP_PULSE_WIDTH_TICKS - 1;
+	
+		playback_gap = interval - STEP_PULSE_WIDTH_TICKS;
+		pattern[n] = PLAYBACK_MASK_STEP;
+		period[n++] = playback_take_gap();
+	}
+	
+	return n;
+}
+
+/* Refills a half of the buffers, the hardware enables its channels again when the other half ends */
+void playback_load(uint8_t half)
+{
+	uint8_t n = playback_fill(half);
+	
+	// past the end of the protocol, the playback is stopped before these play
+	if(n == 0)
+	{
+		playback_pattern[half][0] = 0;
+		playback_period[half][0] = 0xFFFF;
+		n = 1;
+	}
+	
+	playback_entries[half] = n;
+	
+	if(half)
+	{
+		DMA.CH1.TRFCNT = n;
+		DMA.CH3.TRFCNT = 2 * n;
+	}
+	else
+	{
+		DMA.CH0.TRFCNT = n;
+		DMA.CH2.TRFCNT = 2 * n;
+	}
+}
+
+void playback_channel_setup(volatile DMA_CH_t * channel, void * source, volatile void * destination, uint8_t burst, uint8_t address_control)
+{
+	channel->CTRLA = DMA_CH_SINGLE_bm | burst;
+	channel->ADDRCTRL = DMA_CH_SRCRELOAD_BLOCK_gc | DMA_CH_SRCDIR_INC_gc | address_control;
+	channel->TRIGSRC = DMA_CH_TRIGSRC_TCE0_OVF_gc;
+	channel->SRCADDR0 = (uint16_t)source & 0xFF;
+	channel->SRCADDR1 = (uint16_t)source >> 8;
+	channel->SRCADDR2 = 0;
+	channel->DESTADDR0 = (uint16_t)destination & 0xFF;
+	channel->DESTADDR1 = (uint16_t)destination >> 8;
+	channel->DESTADDR2 = 0;
+}
+
+/* Accounts the STEPs made by the first entries of a half, like protocol_step() does for each one */
+void playback_account(uint8_t half, uint8_t entries)
+{
+	uint16_t steps = 0;
+	bool step_high = false;
+	int16_t delta;
+	
+	for(uint8_t i = 0; i < entries; i++)
+	{
+		if(playback_pattern[half][i] & PLAYBACK_MASK_STEP)
+		{
+			step_high = !step_high;
+			if(step_high)
+			{
+				steps++;
+				prot_elapsed_ticks += playback_since_step;
+				playback_since_step = 0;
+			}
+		}
+	
+		playback_since_step += playback_period[half][i] + 1;
+	}
+	
+	if(steps == 0)
+		return;
+	
+	delta = steps * prot_weight;
+	prot_steps_done += delta;
+	
+	if(curr_dir == DIR_FORWARD)
+	{
+		app_regs.REG_POSITION += delta;
+		microstep_phase = (microstep_phase + steps * (16 >> app_regs.REG_MICROSTEP_EFFECTIVE)) & 0x0F;
+	}
+	else
+	{
+		app_regs.REG_POSITION -= delta;
+		microstep_phase = (microstep_phase - steps * (16 >> app_regs.REG_MICROSTEP_EFFECTIVE)) & 0x0F;
+		delta = -delta;
+	}
+	
+	if(STEP_REPORT_DECIMATED)
+		step_report_count(delta);
+}
+
+/* Plays the profile already planned from DMA, returns false if it must run on the step engine */
+bool playback_start(void)
+{
+	uint32_t interval;
+	uint16_t first;
+	
+	if(!playback_eligible())
+		return false;
+	
+	interval = ramp_next_interval();
+	if(interval == 0)
+		return false;
+	
+	if(app_regs.REG_ENABLE_MOTOR_DRIVER == 0)
+	{
+		app_regs.REG_ENABLE_MOTOR_DRIVER = 1;
+		app_write_REG_ENABLE_MOTOR_DRIVER(&app_regs.REG_ENABLE_MOTOR_DRIVER);
+	}
+	
+	// the pattern toggles STEP, so it must start low and nothing else may clear it meanwhile
+	clear_step();
+	
+	prot_ending = PROT_RUNNING;
+	prot_steps_done = 0;
+	prot_elapsed_ticks = 0;
+	prot_interval_ticks = interval;
+	prot_weight = microstep_weight;
+	
+	// the first step happens after one full interval, like on the step engine
+	playback_state = PLAYBACK_RUNNING;
+	playback_end_half = PLAYBACK_NO_END;
+	playback_gap = interval;
+	first = playback_take_gap();
+	playback_since_step = first + 1;
+	
+	// OUTTGL only changes the pins in the mask, so the other PORTA pins can still be written meanwhile
+	playback_channel_setup(&DMA.CH0, playback_pattern[0], &PORTA.OUTTGL, DMA_CH_BURSTLEN_1BYTE_gc, DMA_CH_DESTRELOAD_NONE_gc | DMA_CH_DESTDIR_FIXED_gc);
+	playback_channel_setup(&DMA.CH1, playback_pattern[1], &PORTA.OUTTGL, DMA_CH_BURSTLEN_1BYTE_gc, DMA_CH_DESTRELOAD_NONE_gc | DMA_CH_DESTDIR_FIXED_gc);
+	
+	// the period is written right after the overflow, so it sets the period running now and not the next one
+	playback_channel_setup(&DMA.CH2, playback_period[0], &TCE0.PER, DMA_CH_BURSTLEN_2BYTE_gc, DMA_CH_DESTRELOAD_BURST_gc | DMA_CH_DESTDIR_INC_gc);
+	playback_channel_setup(&DMA.CH3, playback_period[1], &TCE0.PER, DMA_CH_BURSTLEN_2BYTE_gc, DMA_CH_DESTRELOAD_BURST_gc | DMA_CH_DESTDIR_INC_gc);
+	
+	// the period channels end after the pattern ones, so the refill is done from their interrupts
+	DMA.CH2.CTRLB = DMA_CH_TRNINTLVL_LO_gc;
+	DMA.CH3.CTRLB = DMA_CH_TRNINTLVL_LO_gc;
+	
+	playback_load(0);
+	playback_load(1);
+	playback_half = 0;
+	
+	// fixed priority, so on each overflow the pins toggle before the period is written
+	DMA.CTRL = DMA_ENABLE_bm | DMA_DBUFMODE_CH01CH23_gc | DMA_PRIMODE_CH0123_gc;
+	DMA.CH0.CTRLA |= DMA_CH_ENABLE_bm;
+	DMA.CH2.CTRLA |= DMA_CH_ENABLE_bm;
+	
+	playback_active = true;
+	timer_type0_enable(&TCE0, TIMER_PRESCALER_DIV8, first, INT_LEVEL_OFF);
+	
+	return true;
+}
+
+/* Stops the playback and accounts the STEPs made by the half that was playing */
+void playback_stop(void)
+{
+	uint8_t half = playback_half;
+	uint16_t remaining;
+	
+	timer_type0_stop(&TCE0);
+	
+	// it may have stopped in the middle of a pulse
+	clr_STEP;
+	
+	// the half ended but its interrupt didn't run yet
+	if((half ? DMA.CH3.CTRLB : DMA.CH2.CTRLB) & DMA_CH_TRNIF_bm)
+	{
+		playback_account(half, playback_entries[half]);
+		half ^= 1;
+	}
+	
+	remaining = half ? DMA.CH1.TRFCNT : DMA.CH0.TRFCNT;
+	if(remaining < playback_entries[half])
+		playback_account(half, playback_entries[half] - remaining);
+	
+	DMA.CH0.CTRLA = 0;
+	DMA.CH1.CTRLA = 0;
+	DMA.CH2.CTRLA = 0;
+	DMA.CH3.CTRLA = 0;
+	DMA.CTRL = 0;
+	
+	// writing the flags clears them, the interrupts are disabled as well
+	DMA.CH0.CTRLB = DMA_CH_TRNIF_bm;
+	DMA.CH1.CTRLB = DMA_CH_TRNIF_bm;
+	DMA.CH2.CTRLB = DMA_CH_TRNIF_bm;
+	DMA.CH3.CTRLB = DMA_CH_TRNIF_bm;
+	
+	playback_active = false;
+}
+
+/* Called from the DMA interrupt when a half of the buffers ended */
+void playback_block_done(uint8_t half)
+{
+	uint8_t other_flags = half ? DMA.CH2.CTRLB : DMA.CH3.CTRLB;
+	
+	if(half)
+	{
+		DMA.CH1.CTRLB |= DMA_CH_TRNIF_bm;
+		DMA.CH3.CTRLB |= DMA_CH_TRNIF_bm;
+	}
+	else
+	{
+		DMA.CH0.CTRLB |= DMA_CH_TRNIF_bm;
+		DMA.CH2.CTRLB |= DMA_CH_TRNIF_bm;
+	}
+	
+	playback_account(half, playback_entries[half]);
+	playback_half = half ^ 1;
+	
+	// we reached the end (or the other half ended as well and would play again), lets stop everything and reset variables
+	if(playback_end_half == half || (other_flags & DMA_CH_TRNIF_bm))
+	{
+		app_regs.REG_START_PROTOCOL = 0;
+		app_write_REG_START_PROTOCOL(&app_regs.REG_START_PROTOCOL);
+		return;
+	}
+	
+	playback_load(half);
+}
+
+/* Converts the volume and flowrate into steps using the calibration (volume = slope * steps + offset) */
+void load_volume_protocol(void)
+{
+	uint32_t steps = 0;
+	
+	if((int32_t)prot_volume_nl > calibration_offset_nl)
+		steps = mul_div((uint32_t)((int32_t)prot_volume_nl - calibration_offset_nl), 1000, calibration_slope_pl);
+	
+	prot_number_steps = steps;
+	
+	// step interval in ticks = slope [pL/step] * ticks per second / (flowrate [nL/s] * 1000)
+	uint32_t rem;
+	prot_step_period = div_u64_u32((uint64_t)calibration_slope_pl * (STEP_TIMER_TICKS_PER_US * 1000), prot_flowrate_nl, &rem);
+	
+	// keep the remainder as a 32-bit binary fraction of a tick
+	prot_step_period_frac = div_u64_u32((uint64_t)rem << 32, prot_flowrate_nl, 0);
+	
+	if(prot_step_period < PROTOCOL_PERIOD_US_MIN * STEP_TIMER_TICKS_PER_US)
+	{
+		prot_step_period = PROTOCOL_PERIOD_US_MIN * STEP_TIMER_TICKS_PER_US;
+		prot_step_period_frac = 0;
+	}
+}
+
+void stop_and_reset_protocol()
+{
+	motion_stop();
+	progress_stop();
+	
+	// commits only apply to the run they were written for
+	prot_commit_pending = 0;
+	prot_reverse_pending = false;
+	app_regs.REG_PROTOCOL_COMMIT = 0;
+	
+	// the homing routine was interrupted
+	if(app_regs.REG_HOMING_STATE >= GM_HOMING_APPROACH && app_regs.REG_HOMING_STATE <= GM_HOMING_REAPPROACH)
+		homing_set_state(GM_HOMING_FAILED);
+	
+	// the protocol may have been stopped in the middle of a refill
+	if((app_regs.REG_DO0_CONFIG & MSK_OUT0_CONF) == GM_OUT0_VALVE)
+		clr_OUT00;
+	
+	if(app_regs.REG_PROTOCOL_TYPE == GM_PROTOCOL_VOLUME)
+		load_volume_protocol();
+	else
+	{
+		prot_number_steps = app_regs.REG_PROTOCOL_NUMBER_STEPS_32;
+		prot_step_period = app_regs.REG_PROTOCOL_PERIOD_US * STEP_TIMER_TICKS_PER_US;
+		prot_step_period_frac = 0;
+	}
+
+	app_regs.REG_START_PROTOCOL = 0;
+	
+	// revert direction
+	app_write_REG_DIR_STATE(&prev_dir);
+}
+
+void homing_set_state(uint8_t state)
+{
+	app_regs.REG_HOMING_STATE = state;
+	
+	if(app_regs.REG_EVT_ENABLE_EXT & B_EVT_EXT_HOMING)
+		core_func_send_event(ADD_REG_HOMING_STATE, true);
+}
+
+bool homing_switch_pressed(uint8_t direction)
+{
+	return (direction == DIR_FORWARD) ? read_SW_F : read_SW_R;
+}
+
+void homing_back_off(void)
+{
+	uint32_t interval = app_regs.REG_HOMING_FAST_PERIOD_US * STEP_TIMER_TICKS_PER_US;
+	
+	homing_set_state(GM_HOMING_BACK_OFF);
+	motion_start(MOTION_HOMING, !homing_dir, app_regs.REG_HOMING_BACKOFF_STEPS, interval, app_regs.REG_HOMING_ACCELERATION, app_regs.REG_HOMING_ACCELERATION);
+}
+
+void homing_finish(uint8_t state)
+{
+	motion_stop();
+	app_write_REG_DIR_STATE(&prev_dir);
+	homing_set_state(state);
+}
+
+/* Fast approach to the switch, back-off, and slow approach from where the switch is reached again */
+void homing_start(uint8_t direction)
+{
+	uint32_t interval = app_regs.REG_HOMING_FAST_PERIOD_US * STEP_TIMER_TICKS_PER_US;
+	
+	homing_dir = direction;
+	prev_dir = curr_dir;
+	
+	// already on the switch, just back off
+	if(homing_switch_pressed(direction))
+	{
+		homing_back_off();
+		return;
+	}
+	
+	homing_set_state(GM_HOMING_APPROACH);
+	motion_start(MOTION_HOMING, direction, HOMING_APPROACH_STEPS, interval, app_regs.REG_HOMING_ACCELERATION, 0);
+}
+
+/* Called from the step engine when a move of the routine ended without reaching the switch */
+void homing_motion_ended(void)
+{
+	motion_stop();
+	
+	if(app_regs.REG_HOMING_STATE == GM_HOMING_BACK_OFF && !homing_switch_pressed(homing_dir))
+	{
+		// the back-off left the switch behind, so don't wait for the release de-bounce to step towards it again
+		switch_released(homing_dir);
+		
+		// twice the back-off is plenty to reach the switch again
+		homing_set_state(GM_HOMING_REAPPROACH);
+		motion_start(MOTION_HOMING, homing_dir, 2 * (uint32_t)app_regs.REG_HOMING_BACKOFF_STEPS, app_regs.REG_HOMING_SLOW_PERIOD_US * STEP_TIMER_TICKS_PER_US, 0, 0);
+		return;
+	}
+	
+	// the switch didn't release, or it wasn't found again
+	homing_finish(GM_HOMING_FAILED);
+}
+
+/* Called when a switch is pressed, returns true if the homing routine takes care of it */
+bool homing_switch_reached(uint8_t direction)
+{
+	if(!running_protocol || prot_type != MOTION_HOMING || direction != homing_dir)
+		return false;
+	
+	if(app_regs.REG_HOMING_STATE == GM_HOMING_APPROACH)
+	{
+		motion_stop();
+		homing_back_off();
+		return true;
+	}
+	
+	if(app_regs.REG_HOMING_STATE == GM_HOMING_REAPPROACH)
+	{
+		app_regs.REG_POSITION = app_regs.REG_HOMING_POSITION;
+		if(app_regs.REG_EVT_ENABLE & B_EVT_POSITION)
+			core_func_send_event(ADD_REG_POSITION, true);
+		
+		homing_finish(GM_HOMING_DONE);
+		return true;
+	}
+	
+	return false;
+}
+
+bool refill_enabled(void)
+{
+	if(app_regs.REG_REFILL_MODE == GM_REFILL_OFF)
+		return false;
+	
+	// the streams and queues don't have an end to resume to, and there's nothing to refill before the first step
+	return running_protocol && (prot_type == GM_PROTOCOL_STEP || prot_type == GM_PROTOCOL_VOLUME) && prot_steps_done;
+}
+
+/* Called after each step of the infusion */
+bool refill_position_reached(void)
+{
+	if(app_regs.REG_REFILL_MODE != GM_REFILL_POSITION || !refill_enabled())
+		return false;
+	
+	if(refill_infuse_dir == DIR_FORWARD)
+		return app_regs.REG_POSITION >= app_regs.REG_REFILL_END_POSITION;
+	else
+		return app_regs.REG_POSITION <= app_regs.REG_REFILL_END_POSITION;
+}
+
+/* Switches the valve and waits for it to settle, the next phase starts when the wait ends */
+void refill_switch_valve(uint8_t phase, bool to_reservoir)
+{
+	uint32_t delay = (uint32_t)app_regs.REG_REFILL_VALVE_DELAY_MS * STEP_TIMER_TICKS_PER_US * 1000;
+	
+	if((app_regs.REG_DO0_CONFIG & MSK_OUT0_CONF) == GM_OUT0_VALVE)
+	{
+		if(to_reservoir)
+			set_OUT00;
+		else
+			clr_OUT00;
+	}
+	
+	refill_phase = phase;
+	
+	// a move without steps only waits one interval
+	motion_start(MOTION_REFILL, curr_dir, 0, delay ? delay : 1, 0, 0);
+}
+
+/* Stops the infusion at the end of travel and starts the refill */
+void refill_start(void)
+{
+	refill_start_ticks = ts_timer_now();
+	refill_cycle_steps = prot_steps_done;
+	refill_delivered_steps += prot_steps_done;
+	
+	motion_stop();
+	refill_switch_valve(REFILL_VALVE_TO_RESERVOIR, true);
+}
+
+/* Resumes the infusion at the original rate with the steps still to deliver */
+void refill_resume(void)
+{
+	uint32_t remaining = 0;
+	
+	if(prot_number_steps > refill_delivered_steps)
+		remaining = prot_number_steps - refill_delivered_steps;
+	
+	// the back-off left the switch behind
+	if(app_regs.REG_REFILL_MODE == GM_REFILL_SWITCH && !(refill_infuse_dir == DIR_FORWARD ? read_SW_F : read_SW_R))
+		switch_released(refill_infuse_dir);
+	
+	motion_stop();
+	
+	prot_type = refill_infuse_type;
+	app_write_REG_DIR_STATE(&refill_infuse_dir);
+	ramp_plan(remaining, prot_step_period, prot_step_period_frac, app_regs.REG_PROTOCOL_ACCELERATION, app_regs.REG_PROTOCOL_DECELERATION);
+	running_protocol = true;
+	protocol_run();
+	
+	// volume delivered on the cycle that ended, and the time without infusion
+	app_regs.REG_REFILL_CYCLE[0] = (float)refill_cycle_steps * calibration_slope_pl / 1000000.0;
+	app_regs.REG_REFILL_CYCLE[1] = (float)(ts_timer_now() - refill_start_ticks) / (TS_TIMER_TICKS_PER_US * 1000);
+	if(app_regs.REG_EVT_ENABLE_EXT & B_EVT_EXT_REFILL)
+		core_func_send_event(ADD_REG_REFILL_CYCLE, true);
+}
+
+/* Called from the step engine when a phase of the refill ended */
+void refill_motion_ended(void)
+{
+	switch(refill_phase)
+	{
+		case REFILL_VALVE_TO_RESERVOIR:
+			// withdraw what was delivered on this cycle
+			refill_phase = REFILL_WITHDRAW;
+			motion_start(MOTION_REFILL, !refill_infuse_dir, refill_cycle_steps, app_regs.REG_REFILL_PERIOD_US * STEP_TIMER_TICKS_PER_US, app_regs.REG_REFILL_ACCELERATION, app_regs.REG_REFILL_ACCELERATION);
+			break;
+		
+		case REFILL_WITHDRAW:
+			refill_switch_valve(REFILL_VALVE_TO_OUTPUT, false);
+			break;
+		
+		default:
+			refill_resume();
+			break;
+	}
+}
+
+/* Called when a switch is pressed, returns true if the refill cycle takes care of it */
+bool refill_switch_reached(uint8_t direction)
+{
+	// the withdraw reached the other end, go on with the infusion from there
+	if(running_protocol && prot_type == MOTION_REFILL && refill_phase == REFILL_WITHDRAW)
+	{
+		refill_motion_ended();
+		return true;
+	}
+	
+	if(app_regs.REG_REFILL_MODE != GM_REFILL_SWITCH || !refill_enabled() || direction != refill_infuse_dir)
+		return false;
+	
+	refill_start();
+	return true;
+}
+
+/* Starts at the jog period and accelerates to the minimum period for as long as the button is held */
+void jog_start(uint8_t direction)
+{
+	uint32_t period = app_regs.REG_JOG_PERIOD_US;
+	uint32_t speed = 1000000UL / period;
+	
+	// without an acceleration the jog keeps the starting period
+	if(app_regs.REG_JOG_ACCELERATION && app_regs.REG_JOG_MIN_PERIOD_US < period)
+		period = app_regs.REG_JOG_MIN_PERIOD_US;
+	
+	jog_dir = direction;
+	
+	// the button sets the direction, it's kept after the jog
+	prev_dir = direction;
+	
+	ramp_entry_speed_sq = speed * speed;
+	motion_start(MOTION_JOG, direction, JOG_STEPS, period * STEP_TIMER_TICKS_PER_US, app_regs.REG_JOG_ACCELERATION, 0);
+	ramp_entry_speed_sq = 0;
+}
+
+/* Called from the 1 ms callback, the jog stops as soon as its button is released */
+void jog_update(void)
+{
+	bool held = (jog_dir == DIR_FORWARD) ? but_push_long_press : but_pull_long_press;
+	
+	if(!held)
+	{
+		motion_stop();
+		return;
+	}
+	
+	inactivity_counter = 0;
+}
+
+/* Called from the switches interrupt as soon as a switch is pressed, before the de-bounce */
+void switch_asserted(uint8_t direction)
+{
+	if(curr_dir != direction)
+		return;
+	
+	// the homing routine goes on from its switch
+	if(homing_switch_reached(direction))
+		return;
+	
+	// and the infusion refills the syringe
+	if(refill_switch_reached(direction))
+		return;
+	
+	stop_and_reset_protocol();
+	step_period_counter = 0;
+	but_reset_pressed = false;
+	but_reset_dir_change = false;
+}
+
+/* Called once the release is de-bounced */
+void switch_released(uint8_t direction)
+{
+	if(direction == DIR_FORWARD)
+	{
+		switch_f_inhibit = false;
+		sw_f_release_ms = 0;
+		if(switch_f_active)
+		{
+			app_regs.REG_SW_FORWARD_STATE = 0;
+			if(app_regs.REG_EVT_ENABLE & B_EVT_SW_FORWARD_STATE)
+				core_func_send_event(ADD_REG_SW_FORWARD_STATE, true);
+			if((app_regs.REG_DO0_CONFIG & MSK_OUT0_CONF) == GM_OUT0_SWLIMIT)
+				clr_OUT00;
+		}
+		clear_sw_f();
+	}
+	
+	if(direction == DIR_REVERSE)
+	{
+		switch_r_inhibit = false;
+		sw_r_release_ms = 0;
+		if(switch_r_active)
+		{
+			app_regs.REG_SW_REVERSE_STATE = 0;
+			if(app_regs.REG_EVT_ENABLE & B_EVT_SW_REVERSE_STATE)
+				core_func_send_event(ADD_REG_SW_REVERSE_STATE, true);
+			if((app_regs.REG_DO0_CONFIG & MSK_OUT0_CONF) == GM_OUT0_SWLIMIT)
+				clr_OUT00;
+		}
+		clear_sw_r();
+	}
+}
+
+/* Called once the press is de-bounced */
+void switch_pressed(uint8_t direction)
+{
+	if(direction == DIR_FORWARD)
+	{
+		switch_f_active = true;
+		switch_f_inhibit = true;
+		app_regs.REG_SW_FORWARD_STATE = 1;
+	}
+	
+	if(direction == DIR_REVERSE)
+	{
+		switch_r_active = true;
+		switch_r_inhibit = true;
+		app_regs.REG_SW_REVERSE_STATE = 1;
+	}
+	
+	switch_asserted(direction);
+}
+
+void take_step(uint8_t direction)
+{
+	inactivity_counter = 0;
+	
+	app_regs.REG_DIR_STATE = direction;
+	app_regs.REG_STEP_STATE = 1;
+	app_write_REG_DIR_STATE(&app_regs.REG_DIR_STATE);
+	app_write_REG_STEP_STATE(&app_regs.REG_STEP_STATE);
+}
+
+void ts_timer_init(void)
+{
+	EVSYS.CH0MUX = EVSYS_CHMUX_PORTB_PIN0_gc;
+	EVSYS.CH1MUX = EVSYS_CHMUX_TCC1_OVF_gc;
+	// SW_F and BUT_PUSH are captured only to measure the latency of their interrupts
+	EVSYS.CH2MUX = EVSYS_CHMUX_PORTC_PIN4_gc;
+	EVSYS.CH3MUX = EVSYS_CHMUX_PORTD_PIN5_gc;
+	
+	TCD0.CTRLA = TC_CLKSEL_OFF_gc;
+	TCD0.CNT = 0;
+	TCD0.PER = 0xFFFF;
+	TCD0.CTRLB = TC_WGMODE_NORMAL_gc | TC0_CCAEN_bm | TC0_CCBEN_bm | TC0_CCCEN_bm | TC0_CCDEN_bm;
+	// event channel n captures in CCA + n
+	TCD0.CTRLD = TC_EVACT_CAPT_gc | TC_EVSEL_CH0_gc;
+	TCD0.INTFLAGS = 0xFF;
+	TCD0.INTCTRLA = INT_LEVEL_LOW;
+	TCD0.INTCTRLB = INT_LEVEL_LOW | (INT_LEVEL_LOW << 2);
+	TCD0.CTRLA = TC_CLKSEL_DIV8_gc;
+	
+	di0_level = read_IN00 ? 1 : 0;
+}
+
+/* Extends a recent (less than half a wrap) count of TCD0 to 32 bits */
+uint32_t ts_timer_extend(uint16_t count)
+{
+	uint16_t overflows = ts_timer_overflows;
+	
+	// the overflow already happened but wasn't serviced yet
+	if((TCD0.INTFLAGS & TC0_OVFIF_bm) && count < 0x8000)
+		overflows++;
+	
+	return ((uint32_t)overflows << 16) | count;
+}
+
+uint32_t ts_timer_now(void)
+{
+	uint8_t sreg = SREG;
+	uint32_t ticks;
+	
+	cli();
+	ticks = ts_timer_extend(TCD0.CNT);
+	SREG = sreg;
+	
+	return ticks;
+}
+
+void ts_timer_overflow(void)
+{
+	ts_timer_overflows++;
+}
+
+void ts_second_boundary(uint16_t capture)
+{
+	ts_second_start = ts_timer_extend(capture);
+	ts_second_start_valid = true;
+}
+
+/* Converts a tick of TCD0 into a Harp time with microsecond resolution */
+void ts_timer_to_harp(uint32_t ticks, uint32_t * seconds, uint32_t * microseconds)
+{
+	uint32_t now = ts_timer_now();
+	uint32_t second;
+	uint32_t core_us;
+	int32_t us;
+	bool from_second_start = false;
+	
+	// the second may change between both reads
+	do
+	{
+		second = core_func_read_R_TIMESTAMP_SECOND();
+		core_us = (uint32_t)core_func_read_R_TIMESTAMP_MICRO() * 32;
+	} while(second != core_func_read_R_TIMESTAMP_SECOND());
+	
+	// use the captured second boundary if it agrees with the core's counter (e.g. it's
+	// not the case right after the timestamp is written or before the core handles the overflow)
+	if(ts_second_start_valid)
+	{
+		uint32_t now_us = (now - ts_second_start) >> TS_TIMER_TICKS_SHIFT;
+		
+		if(now_us + TS_CORE_TOLERANCE_US >= core_us && now_us <= core_us + TS_CORE_TOLERANCE_US)
+		{
+			us = (int32_t)(ticks - ts_second_start) >> TS_TIMER_TICKS_SHIFT;
+			from_second_start = true;
+		}
+	}
+	
+	// otherwise go back from the current time by the age of the capture
+	if(!from_second_start)
+		us = (int32_t)core_us - (int32_t)((now - ticks) >> TS_TIMER_TICKS_SHIFT);
+	
+	while(us < 0)
+	{
+		us += 1000000;
+		second--;
+	}
+	while(us >= 1000000)
+	{
+		us -= 1000000;
+		second++;
+	}
+	
+	*seconds = second;
+	*microseconds = us;
+}
+
+/* Called from the TCD0 capture interrupt on each DI0 edge */
+void di0_edge_captured(uint16_t capture)
+{
+	uint32_t seconds;
+	uint32_t microseconds;
+	
+	// the PORTB interrupt has a higher priority, so it already ran for this edge
+	cpu_load_latency(CPU_LOAD_LATENCY_PORTB, cpu_portb_entry, capture);
+	
+	// a second boundary captured meanwhile must be taken first
+	if(TCD0.INTFLAGS & TC0_CCBIF_bm)
+	{
+		ts_second_boundary(TCD0.CCB);
+		TCD0.INTFLAGS = TC0_CCBIF_bm;
+	}
+	
+	// the pin may have changed again since the edge, so the level is taken from the edge itself
+	di0_level = !di0_level;
+	
+	if((app_regs.REG_DI0_CONFIG & MSK_DI0_CONF) == GM_DI0_SYNC)
+	{
+		ts_timer_to_harp(ts_timer_extend(capture), &seconds, &microseconds);
+		
+		app_regs.REG_INPUT_STATE = di0_level;
+		app_regs.REG_INPUT_EDGE_TIME[0] = seconds;
+		app_regs.REG_INPUT_EDGE_TIME[1] = microseconds;
+		app_regs.REG_INPUT_EDGE_TIME[2] = di0_level;
+		
+		// both events are timestamped with the capture, the Harp timestamp has a resolution of 32 us and the full one is in EDGE_TIME
+		core_func_update_user_timestamp(seconds, microseconds / 32);
+		
+		if(app_regs.REG_EVT_ENABLE & B_EVT_INPUT_STATE)
+			core_func_send_event(ADD_REG_INPUT_STATE, false);
+		if(app_regs.REG_EVT_ENABLE_EXT & B_EVT_EXT_INPUT_EDGE)
+			core_func_send_event(ADD_REG_INPUT_EDGE_TIME, false);
+	}
+	
+	// with no other edge captured, the pin must be at the level of this one, otherwise an edge was missed
+	if(!(TCD0.INTFLAGS & TC0_CCAIF_bm) && (read_IN00 ? 1 : 0) != di0_level)
+		di0_level = !di0_level;
+}
 
-uint16_t inactivity_counter = 0;
+/* Adds to a counter of REG_CPU_LOAD */
+void cpu_load_count(uint8_t index, uint16_t n)
+{
+	uint16_t count = app_regs.REG_CPU_LOAD[index];
+	
+	app_regs.REG_CPU_LOAD[index] = count > 0xFFFF - n ? 0xFFFF : count + n;
+}
 
-/* Buttons */
-uint8_t but_push_counter_ms = 0;
-uint16_t but_long_push_counter_ms = 0;
-bool but_push_long_press = false;
+uint16_t cpu_load_cycles(uint16_t counts)
+{
+	return counts > 0xFFFF / CPU_LOAD_CYCLES_PER_COUNT ? 0xFFFF : counts * CPU_LOAD_CYCLES_PER_COUNT;
+}
 
-uint8_t but_pull_counter_ms = 0;
-uint16_t but_long_pull_counter_ms = 0;
-bool but_pull_long_press = false;
+/* Keeps the worst latency from an edge captured on TCD0 to the entry of its interrupt */
+void cpu_load_latency(uint8_t index, uint16_t entry, uint16_t capture)
+{
+	uint16_t cycles = cpu_load_cycles(entry - capture);
+	
+	if(cycles > app_regs.REG_CPU_LOAD[index])
+		app_regs.REG_CPU_LOAD[index] = cycles;
+}
 
-uint8_t but_reset_counter_ms = 0;
-bool but_reset_pressed = false;
-bool but_reset_dir_change = false;
+/* Called at the start of each core tick */
+void cpu_load_tick_start(void)
+{
+	uint16_t now = TCD0.CNT;
+	uint16_t elapsed = now - cpu_tick_start;
+	
+	// the ticks are 500 us apart, a gap of one and a half ticks lost at least one (up to a TCD0 wrap, 16 ms)
+	if(cpu_tick_start_valid && elapsed >= CPU_LOAD_CORE_TICK_COUNTS * 3 / 2)
+		cpu_load_count(CPU_LOAD_MISSED_TICKS, (elapsed + CPU_LOAD_CORE_TICK_COUNTS / 2) / CPU_LOAD_CORE_TICK_COUNTS - 1);
+	
+	cpu_tick_start = now;
+	cpu_tick_start_valid = true;
+}
 
-/* Switches */
-bool switch_f_active = false;
-bool switch_r_active = false;
-uint8_t sw_f_counter_ms = 0;
-uint8_t sw_r_counter_ms = 0;
+/* Called at the end of each core tick, the cycles include the interrupts served meanwhile */
+void cpu_load_tick_end(void)
+{
+	uint16_t cycles = cpu_load_cycles(TCD0.CNT - cpu_tick_start);
+	
+	if(!cpu_tick_measured)
+	{
+		app_regs.REG_CPU_LOAD[CPU_LOAD_TICK_MIN] = cycles;
+		app_regs.REG_CPU_LOAD[CPU_LOAD_TICK_MAX] = cycles;
+		cpu_tick_average_x16 = (uint32_t)cycles << 4;
+		cpu_tick_measured = true;
+	}
+	else
+	{
+		if(cycles < app_regs.REG_CPU_LOAD[CPU_LOAD_TICK_MIN])
+			app_regs.REG_CPU_LOAD[CPU_LOAD_TICK_MIN] = cycles;
+		if(cycles > app_regs.REG_CPU_LOAD[CPU_LOAD_TICK_MAX])
+			app_regs.REG_CPU_LOAD[CPU_LOAD_TICK_MAX] = cycles;
+		cpu_tick_average_x16 += cycles - (cpu_tick_average_x16 >> 4);
+	}
+	
+	app_regs.REG_CPU_LOAD[CPU_LOAD_TICK_AVERAGE] = cpu_tick_average_x16 >> 4;
+	
+	cpu_load_sample_tx();
+}
 
-uint8_t curr_dir = DIR_FORWARD;
-uint8_t prev_dir = DIR_FORWARD;
-uint16_t step_period_counter = 0;
+void cpu_load_sample_tx(void)
+{
+	uint8_t sreg = SREG;
+	uint16_t depth;
+	
+	// the UART interrupts move the tail
+	cli();
+	depth = (hwbp_uart_head + HWBP_UART_TXBUFSIZ - hwbp_uart_tail) % HWBP_UART_TXBUFSIZ;
+	SREG = sreg;
+	
+	app_regs.REG_CPU_LOAD[CPU_LOAD_TX_DEPTH] = depth;
+	if(depth > app_regs.REG_CPU_LOAD[CPU_LOAD_TX_DEPTH_MAX])
+		app_regs.REG_CPU_LOAD[CPU_LOAD_TX_DEPTH_MAX] = depth;
+}
 
-bool running_protocol = false;
-uint16_t prot_remaining_steps = 0;
-uint16_t prot_step_period = 0;
+void cpu_load_reset(void)
+{
+	for (uint8_t i = 0; i < CPU_LOAD_LENGTH; i++)
+		app_regs.REG_CPU_LOAD[i] = 0;
+	
+	cpu_tick_measured = false;
+}
 
+/* Starts the interval of the next STEP, the ones played back from DMA aren't timestamped */
+void intervals_mark(void)
+{
+	intervals_last_step = ts_timer_now();
+}
 
-void stop_and_reset_protocol()
+/* Called right after the step engine raised a STEP that ended an interval of interval_ticks */
+void intervals_step(uint32_t interval_ticks)
 {
-	running_protocol = false;
-	//note: + 1 because it starts counting from 1
-	prot_remaining_steps = app_regs.REG_PROTOCOL_NUMBER_STEPS + 1;
-	prot_step_period = app_regs.REG_PROTOCOL_PERIOD * 2;
-	app_regs.REG_START_PROTOCOL = 0;
+	uint32_t now = ts_timer_now();
+	uint32_t ticks = now - intervals_last_step;
+	uint32_t interval_us = (ticks + TS_TIMER_TICKS_PER_US / 2) >> TS_TIMER_TICKS_SHIFT;
+	int32_t deviation = ticks - interval_ticks;
+	uint32_t deviation_us;
+	uint8_t bin = 0;
 	
-	// revert direction
-	app_write_REG_DIR_STATE(&prev_dir);
+	intervals_last_step = now;
+	
+	// bins of 1, 2, 4, ... 64 us and more on each side of the one within a microsecond
+	deviation_us = (deviation < 0 ? -deviation : deviation) >> TS_TIMER_TICKS_SHIFT;
+	while(deviation_us && bin < STEP_JITTER_BINS / 2)
+	{
+		deviation_us >>= 1;
+		bin++;
+	}
+	bin = deviation < 0 ? STEP_JITTER_BINS / 2 - bin : STEP_JITTER_BINS / 2 + bin;
+	
+	if(app_regs.REG_STEP_JITTER[bin] != 0xFFFFFFFF)
+		app_regs.REG_STEP_JITTER[bin]++;
+	
+	if(app_regs.REG_STEP_INTERVALS[INTERVALS_COUNT] == 0 || interval_us < app_regs.REG_STEP_INTERVALS[INTERVALS_MIN_US])
+		app_regs.REG_STEP_INTERVALS[INTERVALS_MIN_US] = interval_us;
+	if(interval_us > app_regs.REG_STEP_INTERVALS[INTERVALS_MAX_US])
+		app_regs.REG_STEP_INTERVALS[INTERVALS_MAX_US] = interval_us;
+	
+	// the mean is taken when the register is read
+	app_regs.REG_STEP_INTERVALS[INTERVALS_COUNT]++;
+	intervals_sum_ticks += ticks;
 }
 
-void switch_pressed(uint8_t direction)
+void intervals_update_mean(void)
 {
-	if(direction == DIR_FORWARD)
+	uint8_t sreg = SREG;
+	uint32_t count;
+	uint64_t sum;
+	
+	// the STEPs are counted from the step engine interrupt
+	cli();
+	count = app_regs.REG_STEP_INTERVALS[INTERVALS_COUNT];
+	sum = intervals_sum_ticks;
+	SREG = sreg;
+	
+	if(count)
+		app_regs.REG_STEP_INTERVALS[INTERVALS_MEAN_US] = (div_u64_u32(sum, count, 0) + TS_TIMER_TICKS_PER_US / 2) >> TS_TIMER_TICKS_SHIFT;
+}
+
+void intervals_reset(void)
+{
+	uint8_t sreg = SREG;
+	
+	cli();
+	for (uint8_t i = 0; i < INTERVALS_LENGTH; i++)
+		app_regs.REG_STEP_INTERVALS[i] = 0;
+	for (uint8_t i = 0; i < STEP_JITTER_BINS; i++)
+		app_regs.REG_STEP_JITTER[i] = 0;
+	intervals_sum_ticks = 0;
+	SREG = sreg;
+}
+
+/* Returns the microseconds until the Harp time, saturated when farther than about half an hour */
+int32_t schedule_time_to(uint32_t seconds, uint32_t microseconds)
+{
+	uint32_t now_seconds;
+	uint32_t now_microseconds;
+	int32_t delta_seconds;
+	
+	ts_timer_to_harp(ts_timer_now(), &now_seconds, &now_microseconds);
+	
+	delta_seconds = (int32_t)(seconds - now_seconds);
+	if(delta_seconds > 2000)
+		return INT32_MAX;
+	if(delta_seconds < -2000)
+		return INT32_MIN;
+	
+	return delta_seconds * 1000000L + (int32_t)microseconds - (int32_t)now_microseconds;
+}
+
+void schedule_disarm(void)
+{
+	TCD1.CTRLA = TC_CLKSEL_OFF_gc;
+	TCD1.INTCTRLA = INT_LEVEL_OFF;
+	TCD1.INTFLAGS = 0xFF;
+	schedule_armed = false;
+}
+
+bool schedule_push(uint32_t seconds, uint32_t microseconds, uint8_t address, uint32_t value)
+{
+	uint8_t sreg = SREG;
+	uint8_t i;
+	
+	cli();
+	
+	if(schedule_count >= SCHEDULE_SIZE)
 	{
-		switch_f_active = true;
-		app_regs.REG_SW_FORWARD_STATE = 1;
+		SREG = sreg;
+		return false;
 	}
 	
-	if(direction == DIR_REVERSE)
+	// commands with the same time are fired in the order they were received
+	for(i = schedule_count; i > 0; i--)
 	{
-		switch_r_active = true;
-		app_regs.REG_SW_REVERSE_STATE = 1;
+		if((int32_t)(schedule[i-1].seconds - seconds) < 0 ||
+		   (schedule[i-1].seconds == seconds && schedule[i-1].microseconds <= microseconds))
+			break;
+		schedule[i] = schedule[i-1];
 	}
 	
-	if(curr_dir == direction)
+	schedule[i].seconds = seconds;
+	schedule[i].microseconds = microseconds;
+	schedule[i].value = value;
+	schedule[i].address = address;
+	schedule_count++;
+	
+	// the timer may be armed for a later command
+	if(i == 0 && schedule_armed)
+		schedule_disarm();
+	
+	SREG = sreg;
+	
+	app_regs.REG_SCHEDULE_COUNT = schedule_count;
+	
+	return true;
+}
+
+void schedule_clear(void)
+{
+	uint8_t sreg = SREG;
+	
+	cli();
+	schedule_disarm();
+	schedule_count = 0;
+	SREG = sreg;
+	
+	app_regs.REG_SCHEDULE_COUNT = 0;
+}
+
+/* Pops the command at the head and writes its register */
+void schedule_fire(void)
+{
+	ScheduledCommand command;
+	uint8_t sreg = SREG;
+	int32_t lateness;
+	uint8_t i;
+	
+	cli();
+	
+	if(schedule_count == 0)
 	{
-		stop_and_reset_protocol();
-		step_period_counter = 0;
-		but_reset_pressed = false;
-		but_reset_dir_change = false;
+		SREG = sreg;
+		return;
 	}
+	
+	command = schedule[0];
+	for(i = 1; i < schedule_count; i++)
+		schedule[i-1] = schedule[i];
+	schedule_count--;
+	
+	SREG = sreg;
+	
+	lateness = schedule_time_to(command.seconds, command.microseconds);
+	lateness = (lateness == INT32_MIN) ? INT32_MAX : -lateness;
+	if(lateness < 0)
+		lateness = 0;
+	
+	app_regs.REG_SCHEDULE_STATS[2] = lateness;
+	if((uint32_t)lateness > app_regs.REG_SCHEDULE_STATS[1])
+		app_regs.REG_SCHEDULE_STATS[1] = lateness;
+	if(lateness > SCHEDULE_LATE_US)
+		app_regs.REG_SCHEDULE_STATS[0]++;
+	
+	// the value is only checked by the register when the command fires
+	if(!(*app_func_wr_pointer[command.address - APP_REGS_ADD_MIN])(&command.value))
+		app_regs.REG_SCHEDULE_STATS[3]++;
+	
+	app_regs.REG_SCHEDULE_COUNT = schedule_count;
+	if(app_regs.REG_EVT_ENABLE_EXT & B_EVT_EXT_SCHEDULE)
+		core_func_send_event(ADD_REG_SCHEDULE_COUNT, true);
 }
 
-void take_step(uint8_t direction)
+/* Fires the commands that are due and arms the one-shot timer for the next one when it's close */
+void schedule_check(void)
 {
-	inactivity_counter = 0;
+	int32_t time_to;
 	
-	app_regs.REG_DIR_STATE = direction;
-	app_regs.REG_STEP_STATE = 1;
-	app_write_REG_DIR_STATE(&app_regs.REG_DIR_STATE);
-	app_write_REG_STEP_STATE(&app_regs.REG_STEP_STATE);
+	while(schedule_count && !schedule_armed)
+	{
+		time_to = schedule_time_to(schedule[0].seconds, schedule[0].microseconds);
+		
+		if(time_to > SCHEDULE_ARM_WINDOW_US)
+			return;
+		
+		if(time_to < SCHEDULE_MIN_ARM_US)
+		{
+			schedule_fire();
+			continue;
+		}
+		
+		schedule_armed = true;
+		TCD1.CTRLA = TC_CLKSEL_OFF_gc;
+		TCD1.CTRLB = TC_WGMODE_NORMAL_gc;
+		TCD1.CNT = 0;
+		TCD1.PER = (uint16_t)time_to * TS_TIMER_TICKS_PER_US - 1;
+		TCD1.INTFLAGS = 0xFF;
+		TCD1.INTCTRLA = INT_LEVEL_LOW;
+		TCD1.CTRLA = TC_CLKSEL_DIV8_gc;
+	}
+}
+
+/* Called from the TCD1 interrupt when the command at the head is due */
+void schedule_timer_expired(void)
+{
+	schedule_disarm();
+	schedule_fire();
+	schedule_check();
+}
+
+/* Sends the steps made since the last report as a single event */
+void step_report_flush(void)
+{
+	uint8_t sreg = SREG;
+	
+	// steps can be made from several interrupt levels
+	cli();
+	app_regs.REG_STEP_DELTA = step_report_delta;
+	step_report_delta = 0;
+	SREG = sreg;
+	
+	step_report_ms = 0;
+	
+	if(app_regs.REG_STEP_DELTA == 0)
+		return;
+	
+	if(app_regs.REG_EVT_ENABLE & B_EVT_STEP_STATE)
+		core_func_send_event(ADD_REG_STEP_DELTA, true);
+	
+	if(app_regs.REG_EVT_ENABLE & B_EVT_POSITION)
+		core_func_send_event(ADD_REG_POSITION, true);
+}
+
+/* Called for the steps made when the step reports are decimated */
+void step_report_count(int16_t steps)
+{
+	step_report_delta += steps;
+	
+	if(app_regs.REG_STEP_REPORT_STEPS == 0)
+		return;
+	
+	if(step_report_delta >= app_regs.REG_STEP_REPORT_STEPS || step_report_delta <= -(int32_t)app_regs.REG_STEP_REPORT_STEPS)
+		step_report_flush();
+}
+
+/* Steps done and left by the running protocol, the caller masks the step engine interrupt */
+void progress_counts(uint32_t * done, uint32_t * remaining)
+{
+	uint8_t i;
+	
+	// the refill moves don't deliver anything
+	*done = refill_delivered_steps;
+	if(prot_type != MOTION_REFILL)
+		*done += prot_steps_done;
+	
+	*remaining = 0;
+	if(prot_type == GM_PROTOCOL_QUEUE)
+	{
+		*remaining = prot_queue_seg_remaining;
+		for(i = prot_queue_tail + 1; i != prot_queue_head; i++)
+			*remaining += prot_queue[i & PROTOCOL_QUEUE_MASK].steps;
+	}
+	else if(prot_type != GM_PROTOCOL_STREAM && prot_number_steps > *done)
+		*remaining = prot_number_steps - *done;
+}
+
+/* Updates the progress register from the step engine counters, the ETA assumes the cruise rate */
+void progress_update(void)
+{
+	uint8_t sreg = SREG;
+	uint32_t done;
+	uint32_t remaining;
+	uint64_t ticks;
+	uint8_t i;
+	
+	// the step engine and the playback update the counters from their interrupts
+	cli();
+	progress_counts(&done, &remaining);
+	if(prot_type == GM_PROTOCOL_QUEUE)
+	{
+		ticks = (uint64_t)prot_queue_seg_remaining * prot_queue[prot_queue_tail & PROTOCOL_QUEUE_MASK].interval_ticks;
+		for(i = prot_queue_tail + 1; i != prot_queue_head; i++)
+			ticks += (uint64_t)prot_queue[i & PROTOCOL_QUEUE_MASK].steps * prot_queue[i & PROTOCOL_QUEUE_MASK].interval_ticks + prot_queue[i & PROTOCOL_QUEUE_MASK].dwell_ticks;
+	}
+	else
+		ticks = (uint64_t)remaining * prot_step_period;
+	SREG = sreg;
+	
+	app_regs.REG_PROTOCOL_PROGRESS[0] = done;
+	app_regs.REG_PROTOCOL_PROGRESS[1] = remaining;
+	app_regs.REG_PROTOCOL_PROGRESS[2] = mul_div(done, calibration_slope_pl, 1000);
+	app_regs.REG_PROTOCOL_PROGRESS[3] = div_u64_u32(ticks, STEP_TIMER_TICKS_PER_US * 1000, 0);
+}
+
+void progress_start(void)
+{
+	progress_active = true;
+	progress_ms = 0;
+	progress_last_percent = 0;
+}
+
+/* Called when the protocol stops, before its parameters are reloaded */
+void progress_stop(void)
+{
+	if(!progress_active)
+		return;
+	
+	progress_active = false;
+	progress_update();
+	progress_final = true;
+}
+
+void progress_send(void)
+{
+	progress_ms = 0;
+	
+	if(app_regs.REG_EVT_ENABLE_EXT & B_EVT_EXT_PROGRESS)
+		core_func_send_event(ADD_REG_PROTOCOL_PROGRESS, true);
+}
+
+/* Reports the progress every PROGRESS_PERIOD ms and every PROGRESS_PERCENT % of the protocol */
+void progress_tick_1ms(void)
+{
+	uint8_t sreg;
+	uint32_t done;
+	uint32_t remaining;
+	uint8_t percent;
+	bool due = false;
+	
+	// without a decimation there are no progress events at all
+	if(!app_regs.REG_PROGRESS_PERIOD && !app_regs.REG_PROGRESS_PERCENT)
+	{
+		progress_final = false;
+		return;
+	}
+	
+	if(progress_final)
+	{
+		progress_final = false;
+		progress_send();
+	}
+	
+	if(!progress_active)
+		return;
+	
+	if(app_regs.REG_PROGRESS_PERIOD && ++progress_ms >= app_regs.REG_PROGRESS_PERIOD)
+		due = true;
+	
+	if(app_regs.REG_PROGRESS_PERCENT)
+	{
+		sreg = SREG;
+		cli();
+		progress_counts(&done, &remaining);
+		SREG = sreg;
+		
+		if(done + remaining)
+		{
+			percent = mul_div(done, 100, done + remaining);
+			if(percent >= progress_last_percent + app_regs.REG_PROGRESS_PERCENT)
+			{
+				progress_last_percent = percent;
+				due = true;
+			}
+		}
+	}
+	
+	if(due)
+	{
+		progress_update();
+		progress_send();
+	}
+}
+
+/* Packs the states of the STEP_STATE, DIR_STATE, SW_*_STATE, INPUT_STATE and PROTOCOL_STATE registers */
+void status_update(void)
+{
+	uint8_t sreg = SREG;
+	int32_t position;
+	uint8_t flags = 0;
+	
+	// the position is moved from several interrupt levels
+	cli();
+	position = app_regs.REG_POSITION;
+	SREG = sreg;
+	
+	// STEP pulses are far shorter than the tick, so report whether there were steps since the last snapshot
+	if(position != status_last_position)
+		flags |= B_STATUS_STEPPING;
+	if(app_regs.REG_DIR_STATE)
+		flags |= B_STATUS_DIR;
+	if(app_regs.REG_SW_FORWARD_STATE)
+		flags |= B_STATUS_SW_FORWARD;
+	if(app_regs.REG_SW_REVERSE_STATE)
+		flags |= B_STATUS_SW_REVERSE;
+	if(app_regs.REG_INPUT_STATE & B_DI0)
+		flags |= B_STATUS_INPUT;
+	if(app_regs.REG_PROTOCOL_STATE)
+		flags |= B_STATUS_PROTOCOL;
+	
+	app_regs.REG_STATUS[0] = flags;
+	app_regs.REG_STATUS[1] = (uint32_t)position;
+}
+
+/* Called on every tick, sends one snapshot for all the states that changed */
+void status_tick_1ms(void)
+{
+	status_update();
+	status_last_position = (int32_t)app_regs.REG_STATUS[1];
+	
+	if(app_regs.REG_STATUS[0] == status_last_flags)
+		return;
+	
+	status_last_flags = app_regs.REG_STATUS[0];
+	core_func_send_event(ADD_REG_STATUS, true);
+}
+
+/* Moves the steps made while following DI0 into the position */
+void di0_follow_flush(void)
+{
+	uint8_t sreg = SREG;
+	int16_t steps;
+	uint8_t overrun;
+	
+	cli();
+	steps = di0_follow_steps;
+	di0_follow_steps = 0;
+	overrun = di0_follow_overrun;
+	di0_follow_overrun = 0;
+	SREG = sreg;
+	
+	if(overrun)
+	{
+		if(app_regs.REG_SWITCH_OVERRUN_STEPS > 0xFFFF - overrun)
+			app_regs.REG_SWITCH_OVERRUN_STEPS = 0xFFFF;
+		else
+			app_regs.REG_SWITCH_OVERRUN_STEPS += overrun;
+	}
+	
+	if(steps == 0)
+		return;
+	
+	// same weight and phase as the steps written to STEP_STATE
+	app_regs.REG_POSITION += (int32_t)steps * microstep_weight;
+	microstep_phase = (microstep_phase + steps * (16 >> app_regs.REG_MICROSTEP_EFFECTIVE)) & 0x0F;
+	
+	if (STEP_REPORT_DECIMATED)
+		step_report_count(steps * microstep_weight);
+	else if(app_regs.REG_EVT_ENABLE & B_EVT_POSITION)
+		core_func_send_event(ADD_REG_POSITION, true);
 }
 
 void clear_step()
@@ -237,6 +2792,8 @@ void core_callback_initialize_hardware(void)
 	
 	clear_sw_f();
 	clear_sw_r();
+	
+	ts_timer_init();
 }
 
 void core_callback_reset_registers(void)
@@ -254,13 +2811,63 @@ void core_callback_reset_registers(void)
 	
 	app_regs.REG_PROTOCOL_DIRECTION = DIR_FORWARD;
 	app_regs.REG_PROTOCOL_NUMBER_STEPS = 15;
+	app_regs.REG_PROTOCOL_NUMBER_STEPS_32 = 15;
+	app_regs.REG_POSITION = 0;
+	app_regs.REG_PROTOCOL_QUEUE_COUNT = 0;
+	app_regs.REG_STREAM_UNDERRUN_COUNT = 0;
 	app_regs.REG_PROTOCOL_FLOWRATE = 0.5;
 	app_regs.REG_PROTOCOL_PERIOD = 10;
+	app_regs.REG_PROTOCOL_PERIOD_US = 10000;
+	app_regs.REG_PROTOCOL_ACCELERATION = 0;
+	app_regs.REG_PROTOCOL_DECELERATION = 0;
+	app_regs.REG_STREAM_RATE = 0;
+	app_regs.REG_STREAM_PERIOD = 10;
+	app_regs.REG_STREAM_UNDERRUN_MODE = GM_STREAM_UNDERRUN_HOLD;
+	app_regs.REG_STEP_REPORT_STEPS = 0;
+	app_regs.REG_STEP_REPORT_PERIOD = 0;
+	app_regs.REG_STEP_DELTA = 0;
+	app_regs.REG_SCHEDULE_COUNT = 0;
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_SCHEDULE_STATS[i] = 0;
+	cpu_load_reset();
+	intervals_reset();
+	app_regs.REG_MICROSTEP_AUTO_RATE = 2000;
+	app_regs.REG_HOMING = GM_HOMING_STOP;
+	app_regs.REG_HOMING_STATE = GM_HOMING_IDLE;
+	app_regs.REG_HOMING_FAST_PERIOD_US = 500;
+	app_regs.REG_HOMING_SLOW_PERIOD_US = 5000;
+	app_regs.REG_HOMING_ACCELERATION = 2000;
+	app_regs.REG_HOMING_BACKOFF_STEPS = 200;
+	app_regs.REG_HOMING_POSITION = 0;
+	app_regs.REG_SWITCH_OVERRUN_STEPS = 0;
+	app_regs.REG_REFILL_MODE = GM_REFILL_OFF;
+	app_regs.REG_REFILL_END_POSITION = 0;
+	app_regs.REG_REFILL_PERIOD_US = 500;
+	app_regs.REG_REFILL_ACCELERATION = 2000;
+	app_regs.REG_REFILL_VALVE_DELAY_MS = 20;
+	app_regs.REG_REFILL_CYCLE[0] = 0;
+	app_regs.REG_REFILL_CYCLE[1] = 0;
+	app_regs.REG_JOG_PERIOD_US = 1000;
+	app_regs.REG_JOG_ACCELERATION = 2000;
+	app_regs.REG_JOG_MIN_PERIOD_US = 250;
+	app_regs.REG_PROTOCOL_NEXT_PERIOD_US = 10000;
+	app_regs.REG_PROTOCOL_NEXT_STEPS = 0;
+	app_regs.REG_PROTOCOL_NEXT_DIRECTION = DIR_FORWARD;
+	app_regs.REG_PROTOCOL_COMMIT = 0;
+	for(uint8_t i = 0; i < 4; i++)
+		app_regs.REG_PROTOCOL_PROGRESS[i] = 0;
+	app_regs.REG_PROGRESS_PERIOD = 0;
+	app_regs.REG_PROGRESS_PERCENT = 0;
+	app_regs.REG_STATUS[0] = 0;
+	app_regs.REG_STATUS[1] = 0;
+	app_regs.REG_STEP_PLAYBACK = 0;
 	app_regs.REG_PROTOCOL_VOLUME = 0.5;
-	app_regs.REG_PROTOCOL_TYPE = 0;
-	// TODO: missing calibration values
+	app_regs.REG_PROTOCOL_TYPE = GM_PROTOCOL_STEP;
+	app_regs.REG_CALIBRATION_VALUE_1 = 0;
+	app_regs.REG_CALIBRATION_VALUE_2 = 1;
 	
 	app_regs.REG_EVT_ENABLE = (B_EVT_STEP_STATE | B_EVT_DIR_STATE | B_EVT_SW_FORWARD_STATE | B_EVT_SW_REVERSE_STATE | B_EVT_INPUT_STATE | B_EVT_PROTOCOL_STATE);
+	app_regs.REG_EVT_ENABLE_EXT = (B_EVT_EXT_MICROSTEP | B_EVT_EXT_HOMING | B_EVT_EXT_REFILL | B_EVT_EXT_PROTOCOL_COMMIT | B_EVT_EXT_PROGRESS | B_EVT_EXT_INPUT_EDGE);
 }
 
 void core_callback_registers_were_reinitialized(void)
@@ -271,6 +2878,14 @@ void core_callback_registers_were_reinitialized(void)
 	
 	app_regs.REG_STEP_STATE = 0;
 	app_regs.REG_DIR_STATE = 0;
+	app_regs.REG_POSITION = 0;
+	app_regs.REG_PROTOCOL_QUEUE_COUNT = 0;
+	app_regs.REG_STREAM_UNDERRUN_COUNT = 0;
+	app_regs.REG_STEP_DELTA = 0;
+	schedule_clear();
+	app_regs.REG_HOMING = GM_HOMING_STOP;
+	app_regs.REG_HOMING_STATE = GM_HOMING_IDLE;
+	app_regs.REG_SWITCH_OVERRUN_STEPS = 0;
 	app_regs.REG_SW_FORWARD_STATE = 0;
 	app_regs.REG_SW_REVERSE_STATE = 0;
 	app_regs.REG_INPUT_STATE = 0;
@@ -284,7 +2899,15 @@ void core_callback_registers_were_reinitialized(void)
 	app_write_REG_DO0_CONFIG(&app_regs.REG_DO0_CONFIG);
 	app_write_REG_DO1_CONFIG(&app_regs.REG_DO1_CONFIG);
 	app_write_REG_DI0_CONFIG(&app_regs.REG_DI0_CONFIG);
+	
+	/* Update the fixed-point copies of the volume protocol */
+	app_write_REG_PROTOCOL_FLOWRATE(&app_regs.REG_PROTOCOL_FLOWRATE);
+	app_write_REG_PROTOCOL_VOLUME(&app_regs.REG_PROTOCOL_VOLUME);
+	app_write_REG_CALIBRATION_VALUE_1(&app_regs.REG_CALIBRATION_VALUE_1);
+	app_write_REG_CALIBRATION_VALUE_2(&app_regs.REG_CALIBRATION_VALUE_2);
+	app_read_REG_PROTOCOL_CONFIG();
 
+	app_write_REG_MICROSTEP_AUTO_RATE(&app_regs.REG_MICROSTEP_AUTO_RATE);
 	app_write_REG_MOTOR_MICROSTEP(&app_regs.REG_MOTOR_MICROSTEP);
 	clr_EN_DRIVER;
 	
@@ -329,6 +2952,8 @@ void core_callback_device_to_speed(void) {}
 
 void core_callback_t_before_exec(void) 
 {
+	cpu_load_tick_start();
+	
 	//FIXME: ugly fix for clearing long button presses if still active
 	if(read_BUT_PUSH)
 		clear_but_push();
@@ -337,28 +2962,10 @@ void core_callback_t_before_exec(void)
 
 	if(running_protocol)
 	{
+		// protocol steps are generated by the step engine (TCC0), only clear steps from other sources
 		++step_period_counter;
 		if(step_period_counter == STEP_UPTIME_HALF_MILLISECONDS)
 			clear_step();
-			
-		if(step_period_counter >= prot_step_period)
-		{
-			step_period_counter = 0;
-			// make step if there are still steps remaining in the current running protocol
-			if(--prot_remaining_steps)
-			{
-				app_regs.REG_DIR_STATE = curr_dir;
-				app_regs.REG_STEP_STATE = 1;
-				app_write_REG_DIR_STATE(&app_regs.REG_DIR_STATE);
-				app_write_REG_STEP_STATE(&app_regs.REG_STEP_STATE);
-			}
-			else
-			{
-				// we reached the end, lets stop everything and reset variables
-				app_regs.REG_START_PROTOCOL = 0;
-				app_write_REG_START_PROTOCOL(&app_regs.REG_START_PROTOCOL);
-			}
-		}
 	}
 	else
 	{
@@ -383,31 +2990,16 @@ void core_callback_t_before_exec(void)
 				}
 				
 				take_step(curr_dir);
-				
-				// if reset was pressed, we don't really want to do anything else
-				return;
-			}
-			
-			// prevent steps on long press only if switch on the same direction is active
-			if(but_push_long_press && !switch_f_active)
-			{
-				app_regs.REG_DIR_STATE = DIR_FORWARD;
-				app_regs.REG_STEP_STATE = 1;
-				app_write_REG_DIR_STATE(&app_regs.REG_DIR_STATE);
-				app_write_REG_STEP_STATE(&app_regs.REG_STEP_STATE);
 			}
 			
-			if(but_pull_long_press && !switch_r_active)
-			{
-				app_regs.REG_DIR_STATE = DIR_REVERSE;
-				app_regs.REG_STEP_STATE = 1;
-				app_write_REG_DIR_STATE(&app_regs.REG_DIR_STATE);
-				app_write_REG_STEP_STATE(&app_regs.REG_STEP_STATE);
-			}
+			// long presses jog on the step engine, see jog_start()
 		}
 	}
 }
-void core_callback_t_after_exec(void) {}
+void core_callback_t_after_exec(void)
+{
+	cpu_load_tick_end();
+}
 void core_callback_t_new_second(void)
 {
 	if((app_regs.REG_DO1_CONFIG & MSK_OUT1_CONF) == GM_OUT1_DATA_SEC)
@@ -419,11 +3011,35 @@ void core_callback_t_500us(void) {}
 	
 void core_callback_t_1ms(void) 
 {
+	if(schedule_count)
+		schedule_check();
+	
+	if(di0_follow_steps || di0_follow_overrun)
+	{
+		di0_follow_flush();
+		inactivity_counter = 0;
+	}
+	
+	if(app_regs.REG_STEP_REPORT_PERIOD && ++step_report_ms >= app_regs.REG_STEP_REPORT_PERIOD)
+		step_report_flush();
+	
+	if(running_protocol && prot_type == GM_PROTOCOL_STREAM)
+		stream_tick_1ms();
+	
+	if(running_protocol && prot_type == MOTION_JOG)
+		jog_update();
+	
+	progress_tick_1ms();
+	
+	if(app_regs.REG_EVT_ENABLE_EXT & B_EVT_EXT_STATUS)
+		status_tick_1ms();
+	
 	// disable motor if there's no activity for a while
 	++inactivity_counter;
 	if(inactivity_counter == INACTIVITY_TIME)
 	{
-		app_write_REG_ENABLE_MOTOR_DRIVER(0);
+		uint8_t disable = 0;
+		app_write_REG_ENABLE_MOTOR_DRIVER(&disable);
 		inactivity_counter = 0;
 	}
 	
@@ -464,6 +3080,13 @@ void core_callback_t_1ms(void)
 		}
 	}
 	
+	/* De-bounce the release of the switches */
+	if(sw_f_release_ms && !read_SW_F && !--sw_f_release_ms)
+		switch_released(DIR_FORWARD);
+	
+	if(sw_r_release_ms && !read_SW_R && !--sw_r_release_ms)
+		switch_released(DIR_REVERSE);
+	
 	/* handle buttons */
 	/* De-bounce PUSH button */
 	if(but_push_counter_ms)
@@ -506,6 +3129,10 @@ void core_callback_t_1ms(void)
 			if(!--but_long_push_counter_ms)
 			{
 				but_push_long_press = true;
+				
+				// jog except on active switch on same direction and reset was pressed
+				if(!running_protocol && !switch_f_active && !but_reset_pressed)
+					jog_start(DIR_FORWARD);
 			}
 		}
 		else
@@ -554,6 +3181,10 @@ void core_callback_t_1ms(void)
 			if(!--but_long_pull_counter_ms)
 			{
 				but_pull_long_press = true;
+				
+				// jog except on active switch on same direction and reset was pressed
+				if(!running_protocol && !switch_r_active && !but_reset_pressed)
+					jog_start(DIR_REVERSE);
 			}
 		}
 		else
@@ -11,6 +11,43 @@ extern uint8_t prev_dir;
 extern uint8_t step_period_counter;
 extern bool running_protocol;
 extern void stop_and_reset_protocol();
+extern void start_protocol();
+extern uint32_t prot_flowrate_nl;
+extern uint32_t prot_volume_nl;
+extern int32_t calibration_offset_nl;
+extern uint32_t calibration_slope_pl;
+extern uint32_t prot_steps_done;
+extern uint64_t prot_elapsed_ticks;
+extern uint8_t protocol_queue_count(void);
+extern bool protocol_queue_push(uint32_t steps, uint32_t interval_us, uint8_t direction, uint32_t dwell_us);
+extern void protocol_queue_clear(void);
+extern bool stream_push(int32_t rate_msps);
+extern void step_report_flush(void);
+extern void step_report_count(int16_t steps);
+extern uint16_t app_regs_n_elements[];
+extern volatile uint8_t schedule_count;
+extern bool schedule_push(uint32_t seconds, uint32_t microseconds, uint8_t address, uint32_t value);
+extern void schedule_clear(void);
+extern void schedule_check(void);
+extern bool microstep_auto;
+extern uint8_t microstep_weight;
+extern uint8_t microstep_phase;
+extern uint32_t microstep_auto_min_interval;
+extern void microstep_set_pins(uint8_t mode);
+extern uint8_t prot_type;
+extern void homing_start(uint8_t direction);
+extern void motion_stop(void);
+extern void protocol_commit(uint8_t fields);
+extern bool progress_active;
+extern void progress_update(void);
+extern void status_update(void);
+extern volatile bool switch_f_inhibit;
+extern volatile bool switch_r_inhibit;
+extern bool playback_active;
+extern void cpu_load_reset(void);
+extern void cpu_load_sample_tx(void);
+extern void intervals_update_mean(void);
+extern void intervals_reset(void);
 
 void (*app_func_rd_pointer[])(void) = {
 	&app_read_REG_ENABLE_MOTOR_DRIVER,
@@ -36,7 +73,59 @@ void (*app_func_rd_pointer[])(void) = {
 	&app_read_REG_EVT_ENABLE,
 	&app_read_REG_SET_BOARD_TYPE,
 	&app_read_REG_PROTOCOL_STATE,
-	&app_read_REG_PROTOCOL_DIRECTION
+	&app_read_REG_PROTOCOL_DIRECTION,
+	&app_read_REG_PROTOCOL_PERIOD_US,
+	&app_read_REG_PROTOCOL_ACCELERATION,
+	&app_read_REG_PROTOCOL_DECELERATION,
+	&app_read_REG_PROTOCOL_AVERAGE_RATE,
+	&app_read_REG_PROTOCOL_NUMBER_STEPS_32,
+	&app_read_REG_POSITION,
+	&app_read_REG_PROTOCOL_QUEUE_SEGMENT,
+	&app_read_REG_PROTOCOL_QUEUE_COUNT,
+	&app_read_REG_STREAM_RATE,
+	&app_read_REG_STREAM_PERIOD,
+	&app_read_REG_STREAM_UNDERRUN_MODE,
+	&app_read_REG_STREAM_UNDERRUN_COUNT,
+	&app_read_REG_STEP_REPORT_STEPS,
+	&app_read_REG_STEP_REPORT_PERIOD,
+	&app_read_REG_STEP_DELTA,
+	&app_read_REG_INPUT_EDGE_TIME,
+	&app_read_REG_SCHEDULE_COMMAND,
+	&app_read_REG_SCHEDULE_COUNT,
+	&app_read_REG_SCHEDULE_STATS,
+	&app_read_REG_MICROSTEP_EFFECTIVE,
+	&app_read_REG_MICROSTEP_AUTO_RATE,
+	&app_read_REG_EVT_ENABLE_EXT,
+	&app_read_REG_HOMING,
+	&app_read_REG_HOMING_STATE,
+	&app_read_REG_HOMING_FAST_PERIOD_US,
+	&app_read_REG_HOMING_SLOW_PERIOD_US,
+	&app_read_REG_HOMING_ACCELERATION,
+	&app_read_REG_HOMING_BACKOFF_STEPS,
+	&app_read_REG_HOMING_POSITION,
+	&app_read_REG_SWITCH_OVERRUN_STEPS,
+	&app_read_REG_REFILL_MODE,
+	&app_read_REG_REFILL_END_POSITION,
+	&app_read_REG_REFILL_PERIOD_US,
+	&app_read_REG_REFILL_ACCELERATION,
+	&app_read_REG_REFILL_VALVE_DELAY_MS,
+	&app_read_REG_REFILL_CYCLE,
+	&app_read_REG_JOG_PERIOD_US,
+	&app_read_REG_JOG_ACCELERATION,
+	&app_read_REG_JOG_MIN_PERIOD_US,
+	&app_read_REG_PROTOCOL_NEXT_PERIOD_US,
+	&app_read_REG_PROTOCOL_NEXT_STEPS,
+	&app_read_REG_PROTOCOL_NEXT_DIRECTION,
+	&app_read_REG_PROTOCOL_COMMIT,
+	&app_read_REG_PROTOCOL_CONFIG,
+	&app_read_REG_PROTOCOL_PROGRESS,
+	&app_read_REG_PROGRESS_PERIOD,
+	&app_read_REG_PROGRESS_PERCENT,
+	&app_read_REG_STATUS,
+	&app_read_REG_STEP_PLAYBACK,
+	&app_read_REG_CPU_LOAD,
+	&app_read_REG_STEP_INTERVALS,
+	&app_read_REG_STEP_JITTER
 };
 
 bool (*app_func_wr_pointer[])(void*) = {
@@ -63,10 +152,77 @@ bool (*app_func_wr_pointer[])(void*) = {
 	&app_write_REG_EVT_ENABLE,
 	&app_write_REG_SET_BOARD_TYPE,
 	&app_write_REG_PROTOCOL_STATE,
-	&app_write_REG_PROTOCOL_DIRECTION
+	&app_write_REG_PROTOCOL_DIRECTION,
+	&app_write_REG_PROTOCOL_PERIOD_US,
+	&app_write_REG_PROTOCOL_ACCELERATION,
+	&app_write_REG_PROTOCOL_DECELERATION,
+	&app_write_REG_PROTOCOL_AVERAGE_RATE,
+	&app_write_REG_PROTOCOL_NUMBER_STEPS_32,
+	&app_write_REG_POSITION,
+	&app_write_REG_PROTOCOL_QUEUE_SEGMENT,
+	&app_write_REG_PROTOCOL_QUEUE_COUNT,
+	&app_write_REG_STREAM_RATE,
+	&app_write_REG_STREAM_PERIOD,
+	&app_write_REG_STREAM_UNDERRUN_MODE,
+	&app_write_REG_STREAM_UNDERRUN_COUNT,
+	&app_write_REG_STEP_REPORT_STEPS,
+	&app_write_REG_STEP_REPORT_PERIOD,
+	&app_write_REG_STEP_DELTA,
+	&app_write_REG_INPUT_EDGE_TIME,
+	&app_write_REG_SCHEDULE_COMMAND,
+	&app_write_REG_SCHEDULE_COUNT,
+	&app_write_REG_SCHEDULE_STATS,
+	&app_write_REG_MICROSTEP_EFFECTIVE,
+	&app_write_REG_MICROSTEP_AUTO_RATE,
+	&app_write_REG_EVT_ENABLE_EXT,
+	&app_write_REG_HOMING,
+	&app_write_REG_HOMING_STATE,
+	&app_write_REG_HOMING_FAST_PERIOD_US,
+	&app_write_REG_HOMING_SLOW_PERIOD_US,
+	&app_write_REG_HOMING_ACCELERATION,
+	&app_write_REG_HOMING_BACKOFF_STEPS,
+	&app_write_REG_HOMING_POSITION,
+	&app_write_REG_SWITCH_OVERRUN_STEPS,
+	&app_write_REG_REFILL_MODE,
+	&app_write_REG_REFILL_END_POSITION,
+	&app_write_REG_REFILL_PERIOD_US,
+	&app_write_REG_REFILL_ACCELERATION,
+	&app_write_REG_REFILL_VALVE_DELAY_MS,
+	&app_write_REG_REFILL_CYCLE,
+	&app_write_REG_JOG_PERIOD_US,
+	&app_write_REG_JOG_ACCELERATION,
+	&app_write_REG_JOG_MIN_PERIOD_US,
+	&app_write_REG_PROTOCOL_NEXT_PERIOD_US,
+	&app_write_REG_PROTOCOL_NEXT_STEPS,
+	&app_write_REG_PROTOCOL_NEXT_DIRECTION,
+	&app_write_REG_PROTOCOL_COMMIT,
+	&app_write_REG_PROTOCOL_CONFIG,
+	&app_write_REG_PROTOCOL_PROGRESS,
+	&app_write_REG_PROGRESS_PERIOD,
+	&app_write_REG_PROGRESS_PERCENT,
+	&app_write_REG_STATUS,
+	&app_write_REG_STEP_PLAYBACK,
+	&app_write_REG_CPU_LOAD,
+	&app_write_REG_STEP_INTERVALS,
+	&app_write_REG_STEP_JITTER
 };
 
 
+/************************************************************************/
+/* Fixed-point conversion                                               */
+/************************************************************************/
+/* Converts a positive float to an integer in units of 1/scale, rounded and saturated */
+static uint32_t float_to_fixed(float value, uint32_t scale)
+{
+	float scaled = value * scale + 0.5;
+	
+	if (scaled >= 4294967295.0)
+		return 0xFFFFFFFF;
+	
+	return (uint32_t)scaled;
+}
+
+
 /************************************************************************/
 /* REG_ENABLE_MOTOR_DRIVER                                              */
 /************************************************************************/
@@ -100,11 +256,18 @@ bool app_write_REG_START_PROTOCOL(void *a)
 	
 	//NOTE: after enabling the protocol, even if those values change they	
 	//		will only be updated after stopping and starting the protocol again
+	//		(use the PROTOCOL_NEXT registers and PROTOCOL_COMMIT to change a running protocol)
 	stop_and_reset_protocol();
 	
 	// prevent activating protocol if the switch for the same direction is active
 	if( reg > 0 )
 	{
+		// nothing to execute
+		if(app_regs.REG_PROTOCOL_TYPE == GM_PROTOCOL_QUEUE && protocol_queue_count() == 0)
+		{
+			return false;
+		}
+		
 		// forward switch and forward direction
 		if(read_SW_F && app_regs.REG_PROTOCOL_DIRECTION)
 		{
@@ -125,6 +288,7 @@ bool app_write_REG_START_PROTOCOL(void *a)
 	{
 		prev_dir = curr_dir;
 		app_write_REG_DIR_STATE(&app_regs.REG_PROTOCOL_DIRECTION);
+		start_protocol();
 	}
 
 	app_regs.REG_START_PROTOCOL = reg;
@@ -165,28 +329,47 @@ bool app_write_REG_STEP_STATE(void *a)
 		}
 		
 		// only allow steps if the switch on the same direction is not active
-		if(!read_SW_F && curr_dir == 1)
+		if(!read_SW_F && !switch_f_inhibit && curr_dir == 1)
 		{
 			set_STEP;
+			app_regs.REG_POSITION += microstep_weight;
+			microstep_phase = (microstep_phase + (16 >> app_regs.REG_MICROSTEP_EFFECTIVE)) & 0x0F;
+			if (STEP_REPORT_DECIMATED)
+				step_report_count(microstep_weight);
 			if((app_regs.REG_DO1_CONFIG & MSK_OUT1_CONF) == GM_OUT1_STEP_STATE)
 			{
 				set_OUT01;
 			}
 		}
-		if(!read_SW_R && curr_dir == 0)
+		if(!read_SW_R && !switch_r_inhibit && curr_dir == 0)
 		{
 			set_STEP;
+			app_regs.REG_POSITION -= microstep_weight;
+			microstep_phase = (microstep_phase - (16 >> app_regs.REG_MICROSTEP_EFFECTIVE)) & 0x0F;
+			if (STEP_REPORT_DECIMATED)
+				step_report_count(-(int16_t)microstep_weight);
 			if((app_regs.REG_DO1_CONFIG & MSK_OUT1_CONF) == GM_OUT1_STEP_STATE)
 			{
 				set_OUT01;
 			}
 		}
+		
+		// steps still requested towards a switch after it was pressed
+		if((switch_f_inhibit && curr_dir == 1) || (switch_r_inhibit && curr_dir == 0))
+		{
+			if(app_regs.REG_SWITCH_OVERRUN_STEPS != 0xFFFF)
+				app_regs.REG_SWITCH_OVERRUN_STEPS++;
+		}
 	}
 	
-	if(app_regs.REG_ENABLE_MOTOR_DRIVER == B_MOTOR_ENABLE)
+	// when decimated, the steps are reported by step_report_flush()
+	if(app_regs.REG_ENABLE_MOTOR_DRIVER == B_MOTOR_ENABLE && !STEP_REPORT_DECIMATED)
 	{
 		if (app_regs.REG_EVT_ENABLE & B_EVT_STEP_STATE)
 			core_func_send_event(ADD_REG_STEP_STATE, true);
+		
+		if (reg > 0 && (app_regs.REG_EVT_ENABLE & B_EVT_POSITION))
+			core_func_send_event(ADD_REG_POSITION, true);
 	}
 
 	app_regs.REG_STEP_STATE = reg;
@@ -385,6 +568,12 @@ bool app_write_REG_DI0_CONFIG(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
 
+	// when STEP follows the input, its edges must preempt everything else but the communication
+	if((reg & MSK_DI0_CONF) == GM_DI0_FOLLOW_STEP)
+		PORTB.INTCTRL = (PORTB.INTCTRL & ~PORT_INT0LVL_gm) | INT_LEVEL_HIGH;
+	else
+		PORTB.INTCTRL = (PORTB.INTCTRL & ~PORT_INT0LVL_gm) | INT_LEVEL_LOW;
+
 	app_regs.REG_DI0_CONFIG = reg;
 	return true;
 }
@@ -398,41 +587,25 @@ bool app_write_REG_MOTOR_MICROSTEP(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
 	
-	switch (reg)
-	{
-		case GM_STEP_FULL:
-			clr_MS1;
-			clr_MS2;
-			clr_MS3;
-			break;
-		
-		case GM_STEP_HALF:
-			set_MS1;
-			clr_MS2;
-			clr_MS3;
-			break;
-		
-		case GM_STEP_QUARTER:
-			clr_MS1;
-			set_MS2;
-			clr_MS3;
-			break;
-		
-		case GM_STEP_EIGHTH:
-			set_MS1;
-			set_MS2;
-			clr_MS3;
-			break;
-
-		case GM_STEP_SIXTEENTH:
-			set_MS1;
-			set_MS2;
-			set_MS3;
-			break;
-
-		default:
-			return false;
-	}
+	// in the automatic mode steps are counted in sixteenths
+	uint8_t units = (reg == GM_STEP_AUTO) ? GM_STEP_SIXTEENTH : reg;
+	uint8_t current_units = (app_regs.REG_MOTOR_MICROSTEP == GM_STEP_AUTO) ? GM_STEP_SIXTEENTH : app_regs.REG_MOTOR_MICROSTEP;
+	
+	if (reg > GM_STEP_AUTO)
+		return false;
+	
+	// the step engine plans the automatic mode ahead, so it can't be toggled while running
+	if (running_protocol && (reg == GM_STEP_AUTO) != microstep_auto)
+		return false;
+	
+	microstep_auto = (reg == GM_STEP_AUTO);
+	microstep_set_pins(units);
+	
+	// the position is kept in steps of the current mode, so rescale it (GM_STEP_* is log2 of the divider)
+	if (units > current_units)
+		app_regs.REG_POSITION *= (int32_t)1 << (units - current_units);
+	else if (units < current_units)
+		app_regs.REG_POSITION /= (int32_t)1 << (current_units - units);
 	
 	app_regs.REG_MOTOR_MICROSTEP = reg;
 	return true;
@@ -457,6 +630,7 @@ bool app_write_REG_PROTOCOL_NUMBER_STEPS(void *a)
 		return false;
 
 	app_regs.REG_PROTOCOL_NUMBER_STEPS = reg;
+	app_regs.REG_PROTOCOL_NUMBER_STEPS_32 = reg;
 	return true;
 }
 
@@ -479,6 +653,12 @@ bool app_write_REG_PROTOCOL_FLOWRATE(void *a)
 		return false;
 
 	app_regs.REG_PROTOCOL_FLOWRATE = reg;
+	
+	// fixed-point copy used at protocol start, so no float math is needed there
+	prot_flowrate_nl = float_to_fixed(reg, 1000);
+	if (prot_flowrate_nl == 0)
+		prot_flowrate_nl = 1;
+	
 	return true;
 }
 
@@ -500,6 +680,7 @@ bool app_write_REG_PROTOCOL_PERIOD(void *a)
 		return false;
 
 	app_regs.REG_PROTOCOL_PERIOD = reg;
+	app_regs.REG_PROTOCOL_PERIOD_US = (uint32_t)reg * 1000;
 	return true;
 }
 
@@ -521,6 +702,7 @@ bool app_write_REG_PROTOCOL_VOLUME(void *a)
 		return false;
 
 	app_regs.REG_PROTOCOL_VOLUME = reg;
+	prot_volume_nl = float_to_fixed(reg, 1000);
 	return true;
 }
 
@@ -537,6 +719,9 @@ void app_read_REG_PROTOCOL_TYPE(void)
 bool app_write_REG_PROTOCOL_TYPE(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > GM_PROTOCOL_STREAM)
+		return false;
 
 	app_regs.REG_PROTOCOL_TYPE = reg;
 	return true;
@@ -554,9 +739,20 @@ void app_read_REG_CALIBRATION_VALUE_1(void)
 
 bool app_write_REG_CALIBRATION_VALUE_1(void *a)
 {
-	uint8_t reg = *((uint8_t*)a);
+	float reg = *((float*)a);
+	
+	/* Check range */
+	if (reg <= -2147483.0 || reg >= 2147483.0)
+		return false;
 
 	app_regs.REG_CALIBRATION_VALUE_1 = reg;
+	
+	// offset in nL, rounded to the nearest value
+	if (reg < 0)
+		calibration_offset_nl = -(int32_t)float_to_fixed(-reg, 1000);
+	else
+		calibration_offset_nl = float_to_fixed(reg, 1000);
+	
 	return true;
 }
 
@@ -572,9 +768,19 @@ void app_read_REG_CALIBRATION_VALUE_2(void)
 
 bool app_write_REG_CALIBRATION_VALUE_2(void *a)
 {
-	uint8_t reg = *((uint8_t*)a);
+	float reg = *((float*)a);
+	
+	/* Check range */
+	if (reg <= 0)
+		return false;
 
 	app_regs.REG_CALIBRATION_VALUE_2 = reg;
+	
+	// slope in pL/step, it can't be zero since it divides the volume
+	calibration_slope_pl = float_to_fixed(reg, 1000000);
+	if (calibration_slope_pl == 0)
+		calibration_slope_pl = 1;
+	
 	return true;
 }
 
@@ -647,4 +853,1163 @@ bool app_write_REG_PROTOCOL_DIRECTION(void *a)
 
 	app_regs.REG_PROTOCOL_DIRECTION = reg;
 	return true;
+}
+
+/************************************************************************/
+/* REG_PROTOCOL_PERIOD_US                                               */
+/************************************************************************/
+void app_read_REG_PROTOCOL_PERIOD_US(void)
+{
+	//app_regs.REG_PROTOCOL_PERIOD_US = 0;
+}
+
+bool app_write_REG_PROTOCOL_PERIOD_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+	
+	/* Check range */
+	if (reg < PROTOCOL_PERIOD_US_MIN || reg > PROTOCOL_PERIOD_US_MAX)
+		return false;
+
+	app_regs.REG_PROTOCOL_PERIOD_US = reg;
+	
+	// keep the period in ms coherent, it can't go below 1 ms
+	if (reg < 1000)
+		app_regs.REG_PROTOCOL_PERIOD = 1;
+	else
+		app_regs.REG_PROTOCOL_PERIOD = reg / 1000;
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PROTOCOL_ACCELERATION                                           */
+/************************************************************************/
+void app_read_REG_PROTOCOL_ACCELERATION(void)
+{
+	//app_regs.REG_PROTOCOL_ACCELERATION = 0;
+}
+
+bool app_write_REG_PROTOCOL_ACCELERATION(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+
+	// zero disables the acceleration ramp
+	app_regs.REG_PROTOCOL_ACCELERATION = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PROTOCOL_DECELERATION                                           */
+/************************************************************************/
+void app_read_REG_PROTOCOL_DECELERATION(void)
+{
+	//app_regs.REG_PROTOCOL_DECELERATION = 0;
+}
+
+bool app_write_REG_PROTOCOL_DECELERATION(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+
+	// zero disables the deceleration ramp
+	app_regs.REG_PROTOCOL_DECELERATION = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PROTOCOL_AVERAGE_RATE                                           */
+/************************************************************************/
+void app_read_REG_PROTOCOL_AVERAGE_RATE(void)
+{
+	uint8_t sreg = SREG;
+	uint32_t steps;
+	uint64_t ticks;
+	
+	// the step engine and the playback update these counters from their interrupts
+	cli();
+	steps = prot_steps_done;
+	ticks = prot_elapsed_ticks;
+	SREG = sreg;
+	
+	if (ticks == 0)
+		app_regs.REG_PROTOCOL_AVERAGE_RATE = 0;
+	else
+		app_regs.REG_PROTOCOL_AVERAGE_RATE = (float)steps * (STEP_TIMER_TICKS_PER_US * 1000000.0) / (float)ticks;
+}
+
+bool app_write_REG_PROTOCOL_AVERAGE_RATE(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_PROTOCOL_NUMBER_STEPS_32                                        */
+/************************************************************************/
+void app_read_REG_PROTOCOL_NUMBER_STEPS_32(void)
+{
+	//app_regs.REG_PROTOCOL_NUMBER_STEPS_32 = 0;
+}
+
+bool app_write_REG_PROTOCOL_NUMBER_STEPS_32(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+	
+	/* Check range */
+	if (reg == 0)
+		return false;
+
+	app_regs.REG_PROTOCOL_NUMBER_STEPS_32 = reg;
+	
+	// keep the 16 bits register coherent, saturated to its maximum
+	app_regs.REG_PROTOCOL_NUMBER_STEPS = reg > 0xFFFF ? 0xFFFF : reg;
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_POSITION                                                        */
+/************************************************************************/
+void app_read_REG_POSITION(void)
+{
+	//app_regs.REG_POSITION = 0;
+}
+
+bool app_write_REG_POSITION(void *a)
+{
+	int32_t reg = *((int32_t*)a);
+
+	// redefines the current position, the motor doesn't move
+	app_regs.REG_POSITION = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PROTOCOL_QUEUE_SEGMENT                                          */
+/************************************************************************/
+void app_read_REG_PROTOCOL_QUEUE_SEGMENT(void)
+{
+	//app_regs.REG_PROTOCOL_QUEUE_SEGMENT[0] = 0;
+}
+
+bool app_write_REG_PROTOCOL_QUEUE_SEGMENT(void *a)
+{
+	uint32_t *reg = ((uint32_t*)a);
+	
+	/* Check range */
+	if (reg[0] == 0)
+		return false;
+	if (reg[1] < PROTOCOL_PERIOD_US_MIN || reg[1] > PROTOCOL_PERIOD_US_MAX)
+		return false;
+	if (reg[2] > 1)
+		return false;
+	if (reg[3] > PROTOCOL_PERIOD_US_MAX)
+		return false;
+	
+	// appends the segment to the queue, even while it is running
+	if (!protocol_queue_push(reg[0], reg[1], reg[2], reg[3]))
+		return false;
+
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_PROTOCOL_QUEUE_SEGMENT[i] = reg[i];
+	
+	app_regs.REG_PROTOCOL_QUEUE_COUNT = protocol_queue_count();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PROTOCOL_QUEUE_COUNT                                            */
+/************************************************************************/
+void app_read_REG_PROTOCOL_QUEUE_COUNT(void)
+{
+	app_regs.REG_PROTOCOL_QUEUE_COUNT = protocol_queue_count();
+}
+
+bool app_write_REG_PROTOCOL_QUEUE_COUNT(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	// only clearing the queue is allowed, and not while it's being executed
+	if (reg != 0 || running_protocol)
+		return false;
+	
+	protocol_queue_clear();
+
+	app_regs.REG_PROTOCOL_QUEUE_COUNT = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_STREAM_RATE                                                     */
+/************************************************************************/
+void app_read_REG_STREAM_RATE(void)
+{
+	//app_regs.REG_STREAM_RATE = 0;
+}
+
+bool app_write_REG_STREAM_RATE(void *a)
+{
+	float reg = *((float*)a);
+	uint32_t rate;
+	
+	/* Check range */
+	if (!(reg >= -STREAM_RATE_MAX && reg <= STREAM_RATE_MAX))
+		return false;
+	
+	// fixed-point copy in millisteps/s, the step engine never touches floats
+	rate = float_to_fixed(reg < 0 ? -reg : reg, 1000);
+	
+	if (!stream_push(reg < 0 ? -(int32_t)rate : (int32_t)rate))
+		return false;
+
+	app_regs.REG_STREAM_RATE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_STREAM_PERIOD                                                   */
+/************************************************************************/
+void app_read_REG_STREAM_PERIOD(void)
+{
+	//app_regs.REG_STREAM_PERIOD = 0;
+}
+
+bool app_write_REG_STREAM_PERIOD(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	/* Check range */
+	if (reg < 1 || reg > 1000)
+		return false;
+
+	app_regs.REG_STREAM_PERIOD = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_STREAM_UNDERRUN_MODE                                            */
+/************************************************************************/
+void app_read_REG_STREAM_UNDERRUN_MODE(void)
+{
+	//app_regs.REG_STREAM_UNDERRUN_MODE = 0;
+}
+
+bool app_write_REG_STREAM_UNDERRUN_MODE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_STREAM_UNDERRUN)
+		return false;
+
+	app_regs.REG_STREAM_UNDERRUN_MODE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_STREAM_UNDERRUN_COUNT                                           */
+/************************************************************************/
+void app_read_REG_STREAM_UNDERRUN_COUNT(void)
+{
+	//app_regs.REG_STREAM_UNDERRUN_COUNT = 0;
+}
+
+bool app_write_REG_STREAM_UNDERRUN_COUNT(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_STEP_REPORT_STEPS                                               */
+/************************************************************************/
+void app_read_REG_STEP_REPORT_STEPS(void)
+{
+	//app_regs.REG_STEP_REPORT_STEPS = 0;
+}
+
+bool app_write_REG_STEP_REPORT_STEPS(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	// report what was accumulated with the previous configuration
+	step_report_flush();
+
+	app_regs.REG_STEP_REPORT_STEPS = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_STEP_REPORT_PERIOD                                              */
+/************************************************************************/
+void app_read_REG_STEP_REPORT_PERIOD(void)
+{
+	//app_regs.REG_STEP_REPORT_PERIOD = 0;
+}
+
+bool app_write_REG_STEP_REPORT_PERIOD(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	// report what was accumulated with the previous configuration
+	step_report_flush();
+
+	app_regs.REG_STEP_REPORT_PERIOD = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_STEP_DELTA                                                      */
+/************************************************************************/
+void app_read_REG_STEP_DELTA(void)
+{
+	//app_regs.REG_STEP_DELTA = 0;
+}
+
+bool app_write_REG_STEP_DELTA(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_INPUT_EDGE_TIME                                                 */
+/************************************************************************/
+void app_read_REG_INPUT_EDGE_TIME(void)
+{
+	//app_regs.REG_INPUT_EDGE_TIME[0] = 0;
+}
+
+bool app_write_REG_INPUT_EDGE_TIME(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_SCHEDULE_COMMAND                                                */
+/************************************************************************/
+void app_read_REG_SCHEDULE_COMMAND(void)
+{
+	//app_regs.REG_SCHEDULE_COMMAND[0] = 0;
+}
+
+bool app_write_REG_SCHEDULE_COMMAND(void *a)
+{
+	uint32_t *reg = ((uint32_t*)a);
+	
+	/* Check range */
+	if (reg[1] >= 1000000)
+		return false;
+	if (reg[2] < APP_REGS_ADD_MIN || reg[2] > APP_REGS_ADD_MAX)
+		return false;
+	
+	// only single element registers can be scheduled, and not the schedule itself
+	if (app_regs_n_elements[reg[2] - APP_REGS_ADD_MIN] != 1)
+		return false;
+	if (reg[2] == ADD_REG_SCHEDULE_COUNT || reg[2] == ADD_REG_SCHEDULE_STATS)
+		return false;
+	
+	if (!schedule_push(reg[0], reg[1], reg[2], reg[3]))
+		return false;
+	
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_SCHEDULE_COMMAND[i] = reg[i];
+	
+	// fires it right away if it's already due
+	schedule_check();
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SCHEDULE_COUNT                                                  */
+/************************************************************************/
+void app_read_REG_SCHEDULE_COUNT(void)
+{
+	app_regs.REG_SCHEDULE_COUNT = schedule_count;
+}
+
+bool app_write_REG_SCHEDULE_COUNT(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	// only clearing the schedule is allowed
+	if (reg != 0)
+		return false;
+	
+	schedule_clear();
+	
+	app_regs.REG_SCHEDULE_COUNT = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SCHEDULE_STATS                                                  */
+/************************************************************************/
+void app_read_REG_SCHEDULE_STATS(void)
+{
+	//app_regs.REG_SCHEDULE_STATS[0] = 0;
+}
+
+bool app_write_REG_SCHEDULE_STATS(void *a)
+{
+	// any write resets the statistics
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_SCHEDULE_STATS[i] = 0;
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_MICROSTEP_EFFECTIVE                                             */
+/************************************************************************/
+void app_read_REG_MICROSTEP_EFFECTIVE(void)
+{
+	//app_regs.REG_MICROSTEP_EFFECTIVE = 0;
+}
+
+bool app_write_REG_MICROSTEP_EFFECTIVE(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_MICROSTEP_AUTO_RATE                                             */
+/************************************************************************/
+void app_read_REG_MICROSTEP_AUTO_RATE(void)
+{
+	//app_regs.REG_MICROSTEP_AUTO_RATE = 0;
+}
+
+bool app_write_REG_MICROSTEP_AUTO_RATE(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	/* Check range */
+	if (reg < MICROSTEP_AUTO_RATE_MIN || reg > STREAM_RATE_MAX)
+		return false;
+	
+	microstep_auto_min_interval = (STEP_TIMER_TICKS_PER_US * 1000000UL) / reg;
+	
+	app_regs.REG_MICROSTEP_AUTO_RATE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_EVT_ENABLE_EXT                                                  */
+/************************************************************************/
+void app_read_REG_EVT_ENABLE_EXT(void)
+{
+	//app_regs.REG_EVT_ENABLE_EXT = 0;
+}
+
+bool app_write_REG_EVT_ENABLE_EXT(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	app_regs.REG_EVT_ENABLE_EXT = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_HOMING                                                          */
+/************************************************************************/
+void app_read_REG_HOMING(void)
+{
+	//app_regs.REG_HOMING = 0;
+}
+
+bool app_write_REG_HOMING(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > GM_HOMING_REVERSE)
+		return false;
+	
+	// user protocols must be stopped first
+	if (running_protocol && prot_type != MOTION_HOMING)
+		return false;
+	
+	if (reg == GM_HOMING_STOP)
+	{
+		if (running_protocol)
+			stop_and_reset_protocol();
+	}
+	else
+	{
+		// restarts from the approach if it was already running
+		if (running_protocol)
+			motion_stop();
+		
+		homing_start(reg == GM_HOMING_FORWARD ? 1 : 0);
+	}
+	
+	app_regs.REG_HOMING = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_HOMING_STATE                                                    */
+/************************************************************************/
+void app_read_REG_HOMING_STATE(void)
+{
+	//app_regs.REG_HOMING_STATE = 0;
+}
+
+bool app_write_REG_HOMING_STATE(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_HOMING_FAST_PERIOD_US                                           */
+/************************************************************************/
+void app_read_REG_HOMING_FAST_PERIOD_US(void)
+{
+	//app_regs.REG_HOMING_FAST_PERIOD_US = 0;
+}
+
+bool app_write_REG_HOMING_FAST_PERIOD_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+	
+	/* Check range */
+	if (reg < PROTOCOL_PERIOD_US_MIN || reg > PROTOCOL_PERIOD_US_MAX)
+		return false;
+	
+	app_regs.REG_HOMING_FAST_PERIOD_US = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_HOMING_SLOW_PERIOD_US                                           */
+/************************************************************************/
+void app_read_REG_HOMING_SLOW_PERIOD_US(void)
+{
+	//app_regs.REG_HOMING_SLOW_PERIOD_US = 0;
+}
+
+bool app_write_REG_HOMING_SLOW_PERIOD_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+	
+	/* Check range */
+	if (reg < PROTOCOL_PERIOD_US_MIN || reg > PROTOCOL_PERIOD_US_MAX)
+		return false;
+	
+	app_regs.REG_HOMING_SLOW_PERIOD_US = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_HOMING_ACCELERATION                                             */
+/************************************************************************/
+void app_read_REG_HOMING_ACCELERATION(void)
+{
+	//app_regs.REG_HOMING_ACCELERATION = 0;
+}
+
+bool app_write_REG_HOMING_ACCELERATION(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	app_regs.REG_HOMING_ACCELERATION = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_HOMING_BACKOFF_STEPS                                            */
+/************************************************************************/
+void app_read_REG_HOMING_BACKOFF_STEPS(void)
+{
+	//app_regs.REG_HOMING_BACKOFF_STEPS = 0;
+}
+
+bool app_write_REG_HOMING_BACKOFF_STEPS(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	/* Check range */
+	if (reg == 0)
+		return false;
+	
+	app_regs.REG_HOMING_BACKOFF_STEPS = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_HOMING_POSITION                                                 */
+/************************************************************************/
+void app_read_REG_HOMING_POSITION(void)
+{
+	//app_regs.REG_HOMING_POSITION = 0;
+}
+
+bool app_write_REG_HOMING_POSITION(void *a)
+{
+	int32_t reg = *((int32_t*)a);
+	
+	app_regs.REG_HOMING_POSITION = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SWITCH_OVERRUN_STEPS                                            */
+/************************************************************************/
+void app_read_REG_SWITCH_OVERRUN_STEPS(void)
+{
+	//app_regs.REG_SWITCH_OVERRUN_STEPS = 0;
+}
+
+bool app_write_REG_SWITCH_OVERRUN_STEPS(void *a)
+{
+	// any write resets the counter
+	app_regs.REG_SWITCH_OVERRUN_STEPS = 0;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_REFILL_MODE                                                     */
+/************************************************************************/
+void app_read_REG_REFILL_MODE(void)
+{
+	//app_regs.REG_REFILL_MODE = 0;
+}
+
+bool app_write_REG_REFILL_MODE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > GM_REFILL_POSITION)
+		return false;
+	
+	app_regs.REG_REFILL_MODE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_REFILL_END_POSITION                                             */
+/************************************************************************/
+void app_read_REG_REFILL_END_POSITION(void)
+{
+	//app_regs.REG_REFILL_END_POSITION = 0;
+}
+
+bool app_write_REG_REFILL_END_POSITION(void *a)
+{
+	int32_t reg = *((int32_t*)a);
+	
+	app_regs.REG_REFILL_END_POSITION = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_REFILL_PERIOD_US                                                */
+/************************************************************************/
+void app_read_REG_REFILL_PERIOD_US(void)
+{
+	//app_regs.REG_REFILL_PERIOD_US = 0;
+}
+
+bool app_write_REG_REFILL_PERIOD_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+	
+	/* Check range */
+	if (reg < PROTOCOL_PERIOD_US_MIN || reg > PROTOCOL_PERIOD_US_MAX)
+		return false;
+	
+	app_regs.REG_REFILL_PERIOD_US = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_REFILL_ACCELERATION                                             */
+/************************************************************************/
+void app_read_REG_REFILL_ACCELERATION(void)
+{
+	//app_regs.REG_REFILL_ACCELERATION = 0;
+}
+
+bool app_write_REG_REFILL_ACCELERATION(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	app_regs.REG_REFILL_ACCELERATION = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_REFILL_VALVE_DELAY_MS                                           */
+/************************************************************************/
+void app_read_REG_REFILL_VALVE_DELAY_MS(void)
+{
+	//app_regs.REG_REFILL_VALVE_DELAY_MS = 0;
+}
+
+bool app_write_REG_REFILL_VALVE_DELAY_MS(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	app_regs.REG_REFILL_VALVE_DELAY_MS = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_REFILL_CYCLE                                                    */
+/************************************************************************/
+void app_read_REG_REFILL_CYCLE(void)
+{
+	//app_regs.REG_REFILL_CYCLE[0] = 0;
+}
+
+bool app_write_REG_REFILL_CYCLE(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_JOG_PERIOD_US                                                   */
+/************************************************************************/
+void app_read_REG_JOG_PERIOD_US(void)
+{
+	//app_regs.REG_JOG_PERIOD_US = 0;
+}
+
+bool app_write_REG_JOG_PERIOD_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+	
+	/* Check range */
+	if (reg < PROTOCOL_PERIOD_US_MIN || reg > PROTOCOL_PERIOD_US_MAX)
+		return false;
+	
+	app_regs.REG_JOG_PERIOD_US = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_JOG_ACCELERATION                                                */
+/************************************************************************/
+void app_read_REG_JOG_ACCELERATION(void)
+{
+	//app_regs.REG_JOG_ACCELERATION = 0;
+}
+
+bool app_write_REG_JOG_ACCELERATION(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	app_regs.REG_JOG_ACCELERATION = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_JOG_MIN_PERIOD_US                                               */
+/************************************************************************/
+void app_read_REG_JOG_MIN_PERIOD_US(void)
+{
+	//app_regs.REG_JOG_MIN_PERIOD_US = 0;
+}
+
+bool app_write_REG_JOG_MIN_PERIOD_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+	
+	/* Check range */
+	if (reg < PROTOCOL_PERIOD_US_MIN || reg > PROTOCOL_PERIOD_US_MAX)
+		return false;
+	
+	app_regs.REG_JOG_MIN_PERIOD_US = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PROTOCOL_NEXT_PERIOD_US                                         */
+/************************************************************************/
+void app_read_REG_PROTOCOL_NEXT_PERIOD_US(void)
+{
+	//app_regs.REG_PROTOCOL_NEXT_PERIOD_US = 0;
+}
+
+bool app_write_REG_PROTOCOL_NEXT_PERIOD_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+	
+	/* Check range */
+	if (reg < PROTOCOL_PERIOD_US_MIN || reg > PROTOCOL_PERIOD_US_MAX)
+		return false;
+	
+	app_regs.REG_PROTOCOL_NEXT_PERIOD_US = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PROTOCOL_NEXT_STEPS                                             */
+/************************************************************************/
+void app_read_REG_PROTOCOL_NEXT_STEPS(void)
+{
+	//app_regs.REG_PROTOCOL_NEXT_STEPS = 0;
+}
+
+bool app_write_REG_PROTOCOL_NEXT_STEPS(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+	
+	app_regs.REG_PROTOCOL_NEXT_STEPS = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PROTOCOL_NEXT_DIRECTION                                         */
+/************************************************************************/
+void app_read_REG_PROTOCOL_NEXT_DIRECTION(void)
+{
+	//app_regs.REG_PROTOCOL_NEXT_DIRECTION = 0;
+}
+
+bool app_write_REG_PROTOCOL_NEXT_DIRECTION(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > 1)
+		return false;
+	
+	app_regs.REG_PROTOCOL_NEXT_DIRECTION = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PROTOCOL_COMMIT                                                 */
+/************************************************************************/
+void app_read_REG_PROTOCOL_COMMIT(void)
+{
+	//app_regs.REG_PROTOCOL_COMMIT = 0;
+}
+
+bool app_write_REG_PROTOCOL_COMMIT(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~(B_COMMIT_PERIOD | B_COMMIT_STEPS | B_COMMIT_DIRECTION))
+		return false;
+	
+	// only the step and volume protocols run a profile that can be replanned
+	if (reg && !(running_protocol && (prot_type == GM_PROTOCOL_STEP || prot_type == GM_PROTOCOL_VOLUME)))
+		return false;
+	
+	// the playback plans whole blocks ahead, so there's no step boundary to pick it up
+	if (reg && playback_active)
+		return false;
+	
+	// replaces a commit that wasn't picked up yet, zero cancels it
+	protocol_commit(reg);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PROTOCOL_CONFIG                                                 */
+/************************************************************************/
+void app_read_REG_PROTOCOL_CONFIG(void)
+{
+	app_regs.REG_PROTOCOL_CONFIG[CONFIG_PROTOCOL_TYPE] = app_regs.REG_PROTOCOL_TYPE;
+	app_regs.REG_PROTOCOL_CONFIG[CONFIG_PROTOCOL_DIRECTION] = app_regs.REG_PROTOCOL_DIRECTION;
+	app_regs.REG_PROTOCOL_CONFIG[CONFIG_NUMBER_STEPS] = app_regs.REG_PROTOCOL_NUMBER_STEPS_32;
+	app_regs.REG_PROTOCOL_CONFIG[CONFIG_PERIOD_US] = app_regs.REG_PROTOCOL_PERIOD_US;
+	app_regs.REG_PROTOCOL_CONFIG[CONFIG_FLOWRATE_NL] = prot_flowrate_nl;
+	app_regs.REG_PROTOCOL_CONFIG[CONFIG_VOLUME_NL] = prot_volume_nl;
+	app_regs.REG_PROTOCOL_CONFIG[CONFIG_CALIBRATION_OFFSET_NL] = (uint32_t)calibration_offset_nl;
+	app_regs.REG_PROTOCOL_CONFIG[CONFIG_CALIBRATION_SLOPE_PL] = calibration_slope_pl;
+	app_regs.REG_PROTOCOL_CONFIG[CONFIG_ACCELERATION] = app_regs.REG_PROTOCOL_ACCELERATION;
+	app_regs.REG_PROTOCOL_CONFIG[CONFIG_DECELERATION] = app_regs.REG_PROTOCOL_DECELERATION;
+	app_regs.REG_PROTOCOL_CONFIG[CONFIG_MICROSTEP] = app_regs.REG_MOTOR_MICROSTEP;
+	app_regs.REG_PROTOCOL_CONFIG[CONFIG_DI0] = app_regs.REG_DI0_CONFIG;
+	app_regs.REG_PROTOCOL_CONFIG[CONFIG_DO0] = app_regs.REG_DO0_CONFIG;
+	app_regs.REG_PROTOCOL_CONFIG[CONFIG_DO1] = app_regs.REG_DO1_CONFIG;
+	app_regs.REG_PROTOCOL_CONFIG[CONFIG_EVT_ENABLE] = app_regs.REG_EVT_ENABLE;
+}
+
+/* Writes each element through the handler of its register, stops on the first one refused */
+static bool protocol_config_apply(uint32_t *reg)
+{
+	uint8_t u8;
+	uint16_t u16;
+	float f;
+	
+	u8 = reg[CONFIG_PROTOCOL_TYPE];
+	if (!app_write_REG_PROTOCOL_TYPE(&u8))
+		return false;
+	u8 = reg[CONFIG_PROTOCOL_DIRECTION];
+	if (!app_write_REG_PROTOCOL_DIRECTION(&u8))
+		return false;
+	if (!app_write_REG_PROTOCOL_NUMBER_STEPS_32(&reg[CONFIG_NUMBER_STEPS]))
+		return false;
+	if (!app_write_REG_PROTOCOL_PERIOD_US(&reg[CONFIG_PERIOD_US]))
+		return false;
+	
+	f = reg[CONFIG_FLOWRATE_NL] / 1000.0;
+	if (!app_write_REG_PROTOCOL_FLOWRATE(&f))
+		return false;
+	f = reg[CONFIG_VOLUME_NL] / 1000.0;
+	if (!app_write_REG_PROTOCOL_VOLUME(&f))
+		return false;
+	f = (int32_t)reg[CONFIG_CALIBRATION_OFFSET_NL] / 1000.0;
+	if (!app_write_REG_CALIBRATION_VALUE_1(&f))
+		return false;
+	f = reg[CONFIG_CALIBRATION_SLOPE_PL] / 1000000.0;
+	if (!app_write_REG_CALIBRATION_VALUE_2(&f))
+		return false;
+	
+	// the float registers only mirror the fixed-point values, which are used as given
+	prot_flowrate_nl = reg[CONFIG_FLOWRATE_NL];
+	prot_volume_nl = reg[CONFIG_VOLUME_NL];
+	calibration_offset_nl = (int32_t)reg[CONFIG_CALIBRATION_OFFSET_NL];
+	calibration_slope_pl = reg[CONFIG_CALIBRATION_SLOPE_PL];
+	
+	u16 = reg[CONFIG_ACCELERATION];
+	if (!app_write_REG_PROTOCOL_ACCELERATION(&u16))
+		return false;
+	u16 = reg[CONFIG_DECELERATION];
+	if (!app_write_REG_PROTOCOL_DECELERATION(&u16))
+		return false;
+	
+	u8 = reg[CONFIG_DI0];
+	if (!app_write_REG_DI0_CONFIG(&u8))
+		return false;
+	u8 = reg[CONFIG_DO0];
+	if (!app_write_REG_DO0_CONFIG(&u8))
+		return false;
+	u8 = reg[CONFIG_DO1];
+	if (!app_write_REG_DO1_CONFIG(&u8))
+		return false;
+	u8 = reg[CONFIG_EVT_ENABLE];
+	if (!app_write_REG_EVT_ENABLE(&u8))
+		return false;
+	
+	// last, since it rescales the position and so can't be undone exactly
+	u8 = reg[CONFIG_MICROSTEP];
+	return app_write_REG_MOTOR_MICROSTEP(&u8);
+}
+
+bool app_write_REG_PROTOCOL_CONFIG(void *a)
+{
+	uint32_t *reg = ((uint32_t*)a);
+	uint32_t previous[CONFIG_LENGTH];
+	
+	// the protocol registers are only latched at start, so don't change them under a running one
+	if (running_protocol)
+		return false;
+	
+	/* Check every element before applying any of them */
+	if (reg[CONFIG_PROTOCOL_TYPE] > GM_PROTOCOL_STREAM)
+		return false;
+	if (reg[CONFIG_PROTOCOL_DIRECTION] > 1)
+		return false;
+	if (reg[CONFIG_NUMBER_STEPS] == 0)
+		return false;
+	if (reg[CONFIG_PERIOD_US] < PROTOCOL_PERIOD_US_MIN || reg[CONFIG_PERIOD_US] > PROTOCOL_PERIOD_US_MAX)
+		return false;
+	if (reg[CONFIG_FLOWRATE_NL] == 0 || reg[CONFIG_VOLUME_NL] == 0 || reg[CONFIG_CALIBRATION_SLOPE_PL] == 0)
+		return false;
+	if (reg[CONFIG_ACCELERATION] > 0xFFFF || reg[CONFIG_DECELERATION] > 0xFFFF)
+		return false;
+	if (reg[CONFIG_MICROSTEP] > GM_STEP_AUTO)
+		return false;
+	if (reg[CONFIG_DI0] > MSK_DI0_CONF || reg[CONFIG_DO0] > MSK_OUT0_CONF || reg[CONFIG_DO1] > MSK_OUT1_CONF)
+		return false;
+	if (reg[CONFIG_EVT_ENABLE] > 0xFF)
+		return false;
+	
+	/* Apply through the handlers, a refusal puts the previous configuration back so it's never half applied */
+	app_read_REG_PROTOCOL_CONFIG();
+	for (uint8_t i = 0; i < CONFIG_LENGTH; i++)
+		previous[i] = app_regs.REG_PROTOCOL_CONFIG[i];
+	
+	if (!protocol_config_apply(reg))
+	{
+		protocol_config_apply(previous);
+		return false;
+	}
+	
+	for (uint8_t i = 0; i < CONFIG_LENGTH; i++)
+		app_regs.REG_PROTOCOL_CONFIG[i] = reg[i];
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PROTOCOL_PROGRESS                                               */
+/************************************************************************/
+void app_read_REG_PROTOCOL_PROGRESS(void)
+{
+	// the last values are kept once the protocol stops
+	if (progress_active)
+		progress_update();
+}
+
+bool app_write_REG_PROTOCOL_PROGRESS(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_PROGRESS_PERIOD                                                 */
+/************************************************************************/
+void app_read_REG_PROGRESS_PERIOD(void)
+{
+	//app_regs.REG_PROGRESS_PERIOD = 0;
+}
+
+bool app_write_REG_PROGRESS_PERIOD(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	// zero disables the periodic reports
+	app_regs.REG_PROGRESS_PERIOD = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PROGRESS_PERCENT                                                */
+/************************************************************************/
+void app_read_REG_PROGRESS_PERCENT(void)
+{
+	//app_regs.REG_PROGRESS_PERCENT = 0;
+}
+
+bool app_write_REG_PROGRESS_PERCENT(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > 100)
+		return false;
+	
+	// zero disables the reports on progress
+	app_regs.REG_PROGRESS_PERCENT = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_STATUS                                                          */
+/************************************************************************/
+void app_read_REG_STATUS(void)
+{
+	status_update();
+}
+
+bool app_write_REG_STATUS(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_STEP_PLAYBACK                                                   */
+/************************************************************************/
+void app_read_REG_STEP_PLAYBACK(void)
+{
+	//app_regs.REG_STEP_PLAYBACK = 0;
+}
+
+bool app_write_REG_STEP_PLAYBACK(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > 1)
+		return false;
+	
+	// used from the next start of a protocol
+	app_regs.REG_STEP_PLAYBACK = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CPU_LOAD                                                        */
+/************************************************************************/
+void app_read_REG_CPU_LOAD(void)
+{
+	cpu_load_sample_tx();
+}
+
+bool app_write_REG_CPU_LOAD(void *a)
+{
+	// any write resets the statistics
+	cpu_load_reset();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_STEP_INTERVALS                                                  */
+/************************************************************************/
+void app_read_REG_STEP_INTERVALS(void)
+{
+	intervals_update_mean();
+}
+
+bool app_write_REG_STEP_INTERVALS(void *a)
+{
+	// any write resets the intervals and their histogram
+	intervals_reset();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_STEP_JITTER                                                     */
+/************************************************************************/
+void app_read_REG_STEP_JITTER(void)
+{
+	//app_regs.REG_STEP_JITTER[0] = 0;
+}
+
+bool app_write_REG_STEP_JITTER(void *a)
+{
+	// any write resets the histogram and the intervals
+	intervals_reset();
+	return true;
 }
\ No newline at end of file
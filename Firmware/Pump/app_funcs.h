@@ -44,6 +44,58 @@ void app_read_REG_EVT_ENABLE(void);
 void app_read_REG_SET_BOARD_TYPE(void);
 void app_read_REG_PROTOCOL_STATE(void);
 void app_read_REG_PROTOCOL_DIRECTION(void);
+void app_read_REG_PROTOCOL_PERIOD_US(void);
+void app_read_REG_PROTOCOL_ACCELERATION(void);
+void app_read_REG_PROTOCOL_DECELERATION(void);
+void app_read_REG_PROTOCOL_AVERAGE_RATE(void);
+void app_read_REG_PROTOCOL_NUMBER_STEPS_32(void);
+void app_read_REG_POSITION(void);
+void app_read_REG_PROTOCOL_QUEUE_SEGMENT(void);
+void app_read_REG_PROTOCOL_QUEUE_COUNT(void);
+void app_read_REG_STREAM_RATE(void);
+void app_read_REG_STREAM_PERIOD(void);
+void app_read_REG_STREAM_UNDERRUN_MODE(void);
+void app_read_REG_STREAM_UNDERRUN_COUNT(void);
+void app_read_REG_STEP_REPORT_STEPS(void);
+void app_read_REG_STEP_REPORT_PERIOD(void);
+void app_read_REG_STEP_DELTA(void);
+void app_read_REG_INPUT_EDGE_TIME(void);
+void app_read_REG_SCHEDULE_COMMAND(void);
+void app_read_REG_SCHEDULE_COUNT(void);
+void app_read_REG_SCHEDULE_STATS(void);
+void app_read_REG_MICROSTEP_EFFECTIVE(void);
+void app_read_REG_MICROSTEP_AUTO_RATE(void);
+void app_read_REG_EVT_ENABLE_EXT(void);
+void app_read_REG_HOMING(void);
+void app_read_REG_HOMING_STATE(void);
+void app_read_REG_HOMING_FAST_PERIOD_US(void);
+void app_read_REG_HOMING_SLOW_PERIOD_US(void);
+void app_read_REG_HOMING_ACCELERATION(void);
+void app_read_REG_HOMING_BACKOFF_STEPS(void);
+void app_read_REG_HOMING_POSITION(void);
+void app_read_REG_SWITCH_OVERRUN_STEPS(void);
+void app_read_REG_REFILL_MODE(void);
+void app_read_REG_REFILL_END_POSITION(void);
+void app_read_REG_REFILL_PERIOD_US(void);
+void app_read_REG_REFILL_ACCELERATION(void);
+void app_read_REG_REFILL_VALVE_DELAY_MS(void);
+void app_read_REG_REFILL_CYCLE(void);
+void app_read_REG_JOG_PERIOD_US(void);
+void app_read_REG_JOG_ACCELERATION(void);
+void app_read_REG_JOG_MIN_PERIOD_US(void);
+void app_read_REG_PROTOCOL_NEXT_PERIOD_US(void);
+void app_read_REG_PROTOCOL_NEXT_STEPS(void);
+void app_read_REG_PROTOCOL_NEXT_DIRECTION(void);
+void app_read_REG_PROTOCOL_COMMIT(void);
+void app_read_REG_PROTOCOL_CONFIG(void);
+void app_read_REG_PROTOCOL_PROGRESS(void);
+void app_read_REG_PROGRESS_PERIOD(void);
+void app_read_REG_PROGRESS_PERCENT(void);
+void app_read_REG_STATUS(void);
+void app_read_REG_STEP_PLAYBACK(void);
+void app_read_REG_CPU_LOAD(void);
+void app_read_REG_STEP_INTERVALS(void);
+void app_read_REG_STEP_JITTER(void);
 
 bool app_write_REG_ENABLE_MOTOR_DRIVER(void *a);
 bool app_write_REG_START_PROTOCOL(void *a);
@@ -69,6 +121,58 @@ bool app_write_REG_EVT_ENABLE(void *a);
 bool app_write_REG_SET_BOARD_TYPE(void *a);
 bool app_write_REG_PROTOCOL_STATE(void *a);
 bool app_write_REG_PROTOCOL_DIRECTION(void *a);
+bool app_write_REG_PROTOCOL_PERIOD_US(void *a);
+bool app_write_REG_PROTOCOL_ACCELERATION(void *a);
+bool app_write_REG_PROTOCOL_DECELERATION(void *a);
+bool app_write_REG_PROTOCOL_AVERAGE_RATE(void *a);
+bool app_write_REG_PROTOCOL_NUMBER_STEPS_32(void *a);
+bool app_write_REG_POSITION(void *a);
+bool app_write_REG_PROTOCOL_QUEUE_SEGMENT(void *a);
+bool app_write_REG_PROTOCOL_QUEUE_COUNT(void *a);
+bool app_write_REG_STREAM_RATE(void *a);
+bool app_write_REG_STREAM_PERIOD(void *a);
+bool app_write_REG_STREAM_UNDERRUN_MODE(void *a);
+bool app_write_REG_STREAM_UNDERRUN_COUNT(void *a);
+bool app_write_REG_STEP_REPORT_STEPS(void *a);
+bool app_write_REG_STEP_REPORT_PERIOD(void *a);
+bool app_write_REG_STEP_DELTA(void *a);
+bool app_write_REG_INPUT_EDGE_TIME(void *a);
+bool app_write_REG_SCHEDULE_COMMAND(void *a);
+bool app_write_REG_SCHEDULE_COUNT(void *a);
+bool app_write_REG_SCHEDULE_STATS(void *a);
+bool app_write_REG_MICROSTEP_EFFECTIVE(void *a);
+bool app_write_REG_MICROSTEP_AUTO_RATE(void *a);
+bool app_write_REG_EVT_ENABLE_EXT(void *a);
+bool app_write_REG_HOMING(void *a);
+bool app_write_REG_HOMING_STATE(void *a);
+bool app_write_REG_HOMING_FAST_PERIOD_US(void *a);
+bool app_write_REG_HOMING_SLOW_PERIOD_US(void *a);
+bool app_write_REG_HOMING_ACCELERATION(void *a);
+bool app_write_REG_HOMING_BACKOFF_STEPS(void *a);
+bool app_write_REG_HOMING_POSITION(void *a);
+bool app_write_REG_SWITCH_OVERRUN_STEPS(void *a);
+bool app_write_REG_REFILL_MODE(void *a);
+bool app_write_REG_REFILL_END_POSITION(void *a);
+bool app_write_REG_REFILL_PERIOD_US(void *a);
+bool app_write_REG_REFILL_ACCELERATION(void *a);
+bool app_write_REG_REFILL_VALVE_DELAY_MS(void *a);
+bool app_write_REG_REFILL_CYCLE(void *a);
+bool app_write_REG_JOG_PERIOD_US(void *a);
+bool app_write_REG_JOG_ACCELERATION(void *a);
+bool app_write_REG_JOG_MIN_PERIOD_US(void *a);
+bool app_write_REG_PROTOCOL_NEXT_PERIOD_US(void *a);
+bool app_write_REG_PROTOCOL_NEXT_STEPS(void *a);
+bool app_write_REG_PROTOCOL_NEXT_DIRECTION(void *a);
+bool app_write_REG_PROTOCOL_COMMIT(void *a);
+bool app_write_REG_PROTOCOL_CONFIG(void *a);
+bool app_write_REG_PROTOCOL_PROGRESS(void *a);
+bool app_write_REG_PROGRESS_PERIOD(void *a);
+bool app_write_REG_PROGRESS_PERCENT(void *a);
+bool app_write_REG_STATUS(void *a);
+bool app_write_REG_STEP_PLAYBACK(void *a);
+bool app_write_REG_CPU_LOAD(void *a);
+bool app_write_REG_STEP_INTERVALS(void *a);
+bool app_write_REG_STEP_JITTER(void *a);
 
 
 #endif /* _APP_FUNCTIONS_H_ */
\ No newline at end of file
@@ -79,12 +79,64 @@ uint8_t app_regs_type[] = {
 	TYPE_U16,
 	TYPE_FLOAT,
 	TYPE_U8,
+	TYPE_FLOAT,
+	TYPE_FLOAT,
+	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
+	TYPE_U32,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_FLOAT,
+	TYPE_U32,
+	TYPE_I32,
+	TYPE_U32,
 	TYPE_U8,
+	TYPE_FLOAT,
+	TYPE_U16,
 	TYPE_U8,
-	TYPE_U8
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_I32,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_I32,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_I32,
+	TYPE_U32,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_FLOAT,
+	TYPE_U32,
+	TYPE_U16,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U32,
+	TYPE_U32
 };
 
 uint16_t app_regs_n_elements[] = {
@@ -111,7 +163,59 @@ uint16_t app_regs_n_elements[] = {
 	1,
 	1,
 	1,
-	1
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	4,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	3,
+	4,
+	1,
+	4,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	2,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	15,
+	4,
+	1,
+	1,
+	2,
+	1,
+	10,
+	4,
+	15
 };
 
 uint8_t *app_regs_pointer[] = {
@@ -138,5 +242,57 @@ uint8_t *app_regs_pointer[] = {
 	(uint8_t*)(&app_regs.REG_EVT_ENABLE),
 	(uint8_t*)(&app_regs.REG_SET_BOARD_TYPE),
 	(uint8_t*)(&app_regs.REG_PROTOCOL_STATE),
-	(uint8_t*)(&app_regs.REG_PROTOCOL_DIRECTION)
+	(uint8_t*)(&app_regs.REG_PROTOCOL_DIRECTION),
+	(uint8_t*)(&app_regs.REG_PROTOCOL_PERIOD_US),
+	(uint8_t*)(&app_regs.REG_PROTOCOL_ACCELERATION),
+	(uint8_t*)(&app_regs.REG_PROTOCOL_DECELERATION),
+	(uint8_t*)(&app_regs.REG_PROTOCOL_AVERAGE_RATE),
+	(uint8_t*)(&app_regs.REG_PROTOCOL_NUMBER_STEPS_32),
+	(uint8_t*)(&app_regs.REG_POSITION),
+	(uint8_t*)(app_regs.REG_PROTOCOL_QUEUE_SEGMENT),
+	(uint8_t*)(&app_regs.REG_PROTOCOL_QUEUE_COUNT),
+	(uint8_t*)(&app_regs.REG_STREAM_RATE),
+	(uint8_t*)(&app_regs.REG_STREAM_PERIOD),
+	(uint8_t*)(&app_regs.REG_STREAM_UNDERRUN_MODE),
+	(uint8_t*)(&app_regs.REG_STREAM_UNDERRUN_COUNT),
+	(uint8_t*)(&app_regs.REG_STEP_REPORT_STEPS),
+	(uint8_t*)(&app_regs.REG_STEP_REPORT_PERIOD),
+	(uint8_t*)(&app_regs.REG_STEP_DELTA),
+	(uint8_t*)(app_regs.REG_INPUT_EDGE_TIME),
+	(uint8_t*)(app_regs.REG_SCHEDULE_COMMAND),
+	(uint8_t*)(&app_regs.REG_SCHEDULE_COUNT),
+	(uint8_t*)(app_regs.REG_SCHEDULE_STATS),
+	(uint8_t*)(&app_regs.REG_MICROSTEP_EFFECTIVE),
+	(uint8_t*)(&app_regs.REG_MICROSTEP_AUTO_RATE),
+	(uint8_t*)(&app_regs.REG_EVT_ENABLE_EXT),
+	(uint8_t*)(&app_regs.REG_HOMING),
+	(uint8_t*)(&app_regs.REG_HOMING_STATE),
+	(uint8_t*)(&app_regs.REG_HOMING_FAST_PERIOD_US),
+	(uint8_t*)(&app_regs.REG_HOMING_SLOW_PERIOD_US),
+	(uint8_t*)(&app_regs.REG_HOMING_ACCELERATION),
+	(uint8_t*)(&app_regs.REG_HOMING_BACKOFF_STEPS),
+	(uint8_t*)(&app_regs.REG_HOMING_POSITION),
+	(uint8_t*)(&app_regs.REG_SWITCH_OVERRUN_STEPS),
+	(uint8_t*)(&app_regs.REG_REFILL_MODE),
+	(uint8_t*)(&app_regs.REG_REFILL_END_POSITION),
+	(uint8_t*)(&app_regs.REG_REFILL_PERIOD_US),
+	(uint8_t*)(&app_regs.REG_REFILL_ACCELERATION),
+	(uint8_t*)(&app_regs.REG_REFILL_VALVE_DELAY_MS),
+	(uint8_t*)(app_regs.REG_REFILL_CYCLE),
+	(uint8_t*)(&app_regs.REG_JOG_PERIOD_US),
+	(uint8_t*)(&app_regs.REG_JOG_ACCELERATION),
+	(uint8_t*)(&app_regs.REG_JOG_MIN_PERIOD_US),
+	(uint8_t*)(&app_regs.REG_PROTOCOL_NEXT_PERIOD_US),
+	(uint8_t*)(&app_regs.REG_PROTOCOL_NEXT_STEPS),
+	(uint8_t*)(&app_regs.REG_PROTOCOL_NEXT_DIRECTION),
+	(uint8_t*)(&app_regs.REG_PROTOCOL_COMMIT),
+	(uint8_t*)(app_regs.REG_PROTOCOL_CONFIG),
+	(uint8_t*)(app_regs.REG_PROTOCOL_PROGRESS),
+	(uint8_t*)(&app_regs.REG_PROGRESS_PERIOD),
+	(uint8_t*)(&app_regs.REG_PROGRESS_PERCENT),
+	(uint8_t*)(app_regs.REG_STATUS),
+	(uint8_t*)(&app_regs.REG_STEP_PLAYBACK),
+	(uint8_t*)(app_regs.REG_CPU_LOAD),
+	(uint8_t*)(app_regs.REG_STEP_INTERVALS),
+	(uint8_t*)(app_regs.REG_STEP_JITTER)
 };
\ No newline at end of file
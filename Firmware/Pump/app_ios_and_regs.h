@@ -131,12 +131,64 @@ typedef struct
 	uint16_t REG_PROTOCOL_PERIOD;
 	float REG_PROTOCOL_VOLUME;
 	uint8_t REG_PROTOCOL_TYPE;
-	uint8_t REG_CALIBRATION_VALUE_1;
-	uint8_t REG_CALIBRATION_VALUE_2;
+	float REG_CALIBRATION_VALUE_1;
+	float REG_CALIBRATION_VALUE_2;
 	uint8_t REG_EVT_ENABLE;
 	uint8_t REG_SET_BOARD_TYPE;
 	uint8_t REG_PROTOCOL_STATE;
 	uint8_t REG_PROTOCOL_DIRECTION;
+	uint32_t REG_PROTOCOL_PERIOD_US;
+	uint16_t REG_PROTOCOL_ACCELERATION;
+	uint16_t REG_PROTOCOL_DECELERATION;
+	float REG_PROTOCOL_AVERAGE_RATE;
+	uint32_t REG_PROTOCOL_NUMBER_STEPS_32;
+	int32_t REG_POSITION;
+	uint32_t REG_PROTOCOL_QUEUE_SEGMENT[4];
+	uint8_t REG_PROTOCOL_QUEUE_COUNT;
+	float REG_STREAM_RATE;
+	uint16_t REG_STREAM_PERIOD;
+	uint8_t REG_STREAM_UNDERRUN_MODE;
+	uint16_t REG_STREAM_UNDERRUN_COUNT;
+	uint16_t REG_STEP_REPORT_STEPS;
+	uint16_t REG_STEP_REPORT_PERIOD;
+	int32_t REG_STEP_DELTA;
+	uint32_t REG_INPUT_EDGE_TIME[3];
+	uint32_t REG_SCHEDULE_COMMAND[4];
+	uint8_t REG_SCHEDULE_COUNT;
+	uint32_t REG_SCHEDULE_STATS[4];
+	uint8_t REG_MICROSTEP_EFFECTIVE;
+	uint16_t REG_MICROSTEP_AUTO_RATE;
+	uint8_t REG_EVT_ENABLE_EXT;
+	uint8_t REG_HOMING;
+	uint8_t REG_HOMING_STATE;
+	uint32_t REG_HOMING_FAST_PERIOD_US;
+	uint32_t REG_HOMING_SLOW_PERIOD_US;
+	uint16_t REG_HOMING_ACCELERATION;
+	uint16_t REG_HOMING_BACKOFF_STEPS;
+	int32_t REG_HOMING_POSITION;
+	uint16_t REG_SWITCH_OVERRUN_STEPS;
+	uint8_t REG_REFILL_MODE;
+	int32_t REG_REFILL_END_POSITION;
+	uint32_t REG_REFILL_PERIOD_US;
+	uint16_t REG_REFILL_ACCELERATION;
+	uint16_t REG_REFILL_VALVE_DELAY_MS;
+	float REG_REFILL_CYCLE[2];
+	uint32_t REG_JOG_PERIOD_US;
+	uint16_t REG_JOG_ACCELERATION;
+	uint32_t REG_JOG_MIN_PERIOD_US;
+	uint32_t REG_PROTOCOL_NEXT_PERIOD_US;
+	uint32_t REG_PROTOCOL_NEXT_STEPS;
+	uint8_t REG_PROTOCOL_NEXT_DIRECTION;
+	uint8_t REG_PROTOCOL_COMMIT;
+	uint32_t REG_PROTOCOL_CONFIG[15];
+	uint32_t REG_PROTOCOL_PROGRESS[4];
+	uint16_t REG_PROGRESS_PERIOD;
+	uint8_t REG_PROGRESS_PERCENT;
+	uint32_t REG_STATUS[2];
+	uint8_t REG_STEP_PLAYBACK;
+	uint16_t REG_CPU_LOAD[10];
+	uint32_t REG_STEP_INTERVALS[4];
+	uint32_t REG_STEP_JITTER[15];
 } AppRegs;
 
 /************************************************************************/
@@ -161,12 +213,64 @@ typedef struct
 #define ADD_REG_PROTOCOL_PERIOD             47 // U16    Period for each step in ms [1;65535]
 #define ADD_REG_PROTOCOL_VOLUME             48 // FLOAT  Volume value in uL ]0;max_float[
 #define ADD_REG_PROTOCOL_TYPE               49 // U8     Step-based (0) or Volume-based protocol (1)
-#define ADD_REG_CALIBRATION_VALUE_1         50 // U8     Calibration value 1
-#define ADD_REG_CALIBRATION_VALUE_2         51 // U8     Calibration value 2
+#define ADD_REG_CALIBRATION_VALUE_1         50 // FLOAT  Calibration offset in uL (volume = slope * steps + offset)
+#define ADD_REG_CALIBRATION_VALUE_2         51 // FLOAT  Calibration slope in uL/step ]0;max_float[
 #define ADD_REG_EVT_ENABLE                  52 // U8     Enable the Events
 #define ADD_REG_SET_BOARD_TYPE              53 // U8     Type of the board
 #define ADD_REG_PROTOCOL_STATE              54 // U8     State of the protocol (running or stopped)
 #define ADD_REG_PROTOCOL_DIRECTION          55 // U8     Protocol direction
+#define ADD_REG_PROTOCOL_PERIOD_US          56 // U32    Period for each step in us [100;65535000]
+#define ADD_REG_PROTOCOL_ACCELERATION       57 // U16    Protocol acceleration in steps/s^2 (0 disables the ramp)
+#define ADD_REG_PROTOCOL_DECELERATION       58 // U16    Protocol deceleration in steps/s^2 (0 disables the ramp)
+#define ADD_REG_PROTOCOL_AVERAGE_RATE       59 // FLOAT  Achieved average step rate of the protocol in steps/s
+#define ADD_REG_PROTOCOL_NUMBER_STEPS_32    60 // U32    Number of steps [1;4294967295]
+#define ADD_REG_POSITION                    61 // I32    Absolute position in steps of the current microstep mode
+#define ADD_REG_PROTOCOL_QUEUE_SEGMENT      62 // U32    Appends a segment to the protocol queue [steps, interval in us, direction, dwell in us]
+#define ADD_REG_PROTOCOL_QUEUE_COUNT        63 // U8     Number of segments in the protocol queue, write 0 to clear it
+#define ADD_REG_STREAM_RATE                 64 // FLOAT  Appends a rate setpoint in steps/s to the streaming FIFO, negative is reverse
+#define ADD_REG_STREAM_PERIOD               65 // U16    Period in ms at which setpoints are taken from the FIFO [1;1000]
+#define ADD_REG_STREAM_UNDERRUN_MODE        66 // U8     Behavior when the FIFO is empty (hold the last rate or decay to zero)
+#define ADD_REG_STREAM_UNDERRUN_COUNT       67 // U16    Number of FIFO underruns since the stream started
+#define ADD_REG_STEP_REPORT_STEPS           68 // U16    Reports the steps made every N steps (0 disables)
+#define ADD_REG_STEP_REPORT_PERIOD          69 // U16    Reports the steps made every M ms (0 disables)
+#define ADD_REG_STEP_DELTA                  70 // I32    Net steps made since the last report, negative is reverse
+#define ADD_REG_INPUT_EDGE_TIME             71 // U32    Capture time and level of the last DI0 edge [seconds, microseconds, level]
+#define ADD_REG_SCHEDULE_COMMAND            72 // U32    Writes a register at a Harp time [seconds, microseconds, address, value]
+#define ADD_REG_SCHEDULE_COUNT              73 // U8     Number of scheduled commands (writing 0 clears them)
+#define ADD_REG_SCHEDULE_STATS              74 // U32    Fires [late count, max lateness us, last lateness us, refused count]
+#define ADD_REG_MICROSTEP_EFFECTIVE         75 // U8     Microstep mode used by the driver
+#define ADD_REG_MICROSTEP_AUTO_RATE         76 // U16    STEP rate above which the automatic mode goes coarser [steps/s]
+#define ADD_REG_EVT_ENABLE_EXT              77 // U8     Enable the events that don't fit EVT_ENABLE
+#define ADD_REG_HOMING                      78 // U8     Starts the homing routine towards a switch (0 stops it)
+#define ADD_REG_HOMING_STATE                79 // U8     Phase of the homing routine
+#define ADD_REG_HOMING_FAST_PERIOD_US       80 // U32    Step period of the approach and back-off in us
+#define ADD_REG_HOMING_SLOW_PERIOD_US       81 // U32    Step period of the slow re-approach in us
+#define ADD_REG_HOMING_ACCELERATION         82 // U16    Acceleration of the approach and back-off in steps/s^2 (0 disables)
+#define ADD_REG_HOMING_BACKOFF_STEPS        83 // U16    Steps moved away from the switch before the re-approach
+#define ADD_REG_HOMING_POSITION             84 // I32    Position set when the switch is reached again
+#define ADD_REG_SWITCH_OVERRUN_STEPS        85 // U16    Steps requested towards a switch after it was pressed
+#define ADD_REG_REFILL_MODE                 86 // U8     End of travel that starts a refill of the syringe
+#define ADD_REG_REFILL_END_POSITION         87 // I32    Position where the infusion ends with GM_REFILL_POSITION
+#define ADD_REG_REFILL_PERIOD_US            88 // U32    Step period of the refill in us
+#define ADD_REG_REFILL_ACCELERATION         89 // U16    Acceleration of the refill in steps/s^2 (0 disables)
+#define ADD_REG_REFILL_VALVE_DELAY_MS       90 // U16    Time for the valve to settle after switching in ms
+#define ADD_REG_REFILL_CYCLE                91 // Float  Last refill cycle [volume delivered, dead time in ms]
+#define ADD_REG_JOG_PERIOD_US               92 // U32    Step period when a button starts to jog in us
+#define ADD_REG_JOG_ACCELERATION            93 // U16    Acceleration of the jog in steps/s^2 (0 keeps the starting period)
+#define ADD_REG_JOG_MIN_PERIOD_US           94 // U32    Step period the jog accelerates to in us (maximum speed)
+#define ADD_REG_PROTOCOL_NEXT_PERIOD_US     95 // U32    Step period in us applied to the running protocol on commit
+#define ADD_REG_PROTOCOL_NEXT_STEPS         96 // U32    Steps left to the running protocol applied on commit
+#define ADD_REG_PROTOCOL_NEXT_DIRECTION     97 // U8     Direction of the running protocol applied on commit
+#define ADD_REG_PROTOCOL_COMMIT             98 // U8     Applies the NEXT registers to the running protocol on the next step
+#define ADD_REG_PROTOCOL_CONFIG             99 // U32    Protocol and IO configuration written at once (see CONFIG_*)
+#define ADD_REG_PROTOCOL_PROGRESS           100 // U32    Progress of the protocol [steps done, steps left, volume delivered in nl, ETA in ms]
+#define ADD_REG_PROGRESS_PERIOD             101 // U16    Sends PROTOCOL_PROGRESS every N ms while a protocol runs (0 disables)
+#define ADD_REG_PROGRESS_PERCENT            102 // U8     Sends PROTOCOL_PROGRESS every N % of the protocol (0 disables)
+#define ADD_REG_STATUS                      103 // U32    Snapshot of the device states [STATUS flags, position]
+#define ADD_REG_STEP_PLAYBACK               104 // U8     Plays the STEPs of the step and volume protocols from DMA when possible
+#define ADD_REG_CPU_LOAD                    105 // U16    CPU load and interrupt latencies (see CPU_LOAD_*), any write resets it
+#define ADD_REG_STEP_INTERVALS              106 // U32    Intervals between the STEPs since the protocol started [count, min us, max us, mean us]
+#define ADD_REG_STEP_JITTER                 107 // U32    Histogram of the deviations of the STEP intervals from the commanded ones (see STEP_JITTER_BINS)
 
 /************************************************************************/
 /* PWM Generator registers' memory limits                               */
@@ -176,8 +280,8 @@ typedef struct
 /************************************************************************/
 /* Memory limits */
 #define APP_REGS_ADD_MIN                    0x20
-#define APP_REGS_ADD_MAX                    0x37
-#define APP_NBYTES_OF_REG_BANK              32
+#define APP_REGS_ADD_MAX                    0x6B
+#define APP_NBYTES_OF_REG_BANK              386
 
 /************************************************************************/
 /* Registers' bits                                                      */
@@ -196,6 +300,7 @@ typedef struct
 #define MSK_OUT0_CONF                      (3<<0)       // Select OUT0 function
 #define GM_OUT0_SOFTWARE                   (0<<0)       // Digital output controlled by software
 #define GM_OUT0_SWLIMIT                    (1<<0)       // Either limits reached (register SW_FORWARD_STATE OR SW_REVERSE_STATE)
+#define GM_OUT0_VALVE                      (2<<0)       // Switches the refill valve, set while refilling
 #define MSK_OUT1_CONF                      (3<<0)       // Select OUT1 function
 #define GM_OUT1_SOFTWARE                   (0<<0)       // Digital output controlled by software (SET_DO1 and CLEAR_DO1)
 #define GM_OUT1_DATA_SEC                   (1<<0)       // Toggles each second when is acquiring
@@ -204,22 +309,123 @@ typedef struct
 #define GM_DI0_SYNC                        (0<<0)       // Use as a pure digital input
 #define GM_DI0_RISE_FALL_UPDATE_STEP       (1<<0)       // Update STEP with a rising edge
 #define GM_DI0_RISE_START_PROTOCOL         (2<<0)       // Will trigger the predefined protocol on a rising edge
+#define GM_DI0_FOLLOW_STEP                 (3<<0)       // STEP follows the input from a high priority interrupt
 #define MSK_MICROSTEP                      (7<<0)       // 
 #define GM_STEP_FULL                       (0<<0)       // Full step (2 phase)
 #define GM_STEP_HALF                       (1<<0)       // Half step
 #define GM_STEP_QUARTER                    (2<<0)       // Quarter step
 #define GM_STEP_EIGHTH                     (3<<0)       // Eighth step
 #define GM_STEP_SIXTEENTH                  (4<<0)       // Sixteenth step
+#define GM_STEP_AUTO                       (5<<0)       // Picked from the step rate, steps are counted in sixteenths
 #define B_EVT_STEP_STATE                   (1<<0)       // Event of register STEP_STATE
 #define B_EVT_DIR_STATE                    (1<<1)       // Event of register DIR_STATE
 #define B_EVT_SW_FORWARD_STATE             (1<<2)       // Event of register SW_FORWARD_STATE
 #define B_EVT_SW_REVERSE_STATE             (1<<3)       // Event of register SW_REVERSE_STATE
 #define B_EVT_INPUT_STATE                  (1<<4)       // Event of register INPUT_STATE
 #define B_EVT_PROTOCOL_STATE               (1<<5)       // Event of register PROTOCOL_STATE
+#define B_EVT_POSITION                     (1<<6)       // Event of register POSITION
+#define B_EVT_PROTOCOL_QUEUE               (1<<7)       // Event of register PROTOCOL_QUEUE_COUNT
+#define B_EVT_EXT_MICROSTEP                (1<<0)       // Event of register MICROSTEP_EFFECTIVE
+#define B_EVT_EXT_HOMING                   (1<<1)       // Event of register HOMING_STATE
+#define B_EVT_EXT_REFILL                   (1<<2)       // Event of register REFILL_CYCLE
+#define B_EVT_EXT_PROTOCOL_COMMIT          (1<<3)       // Event of register PROTOCOL_COMMIT
+#define B_EVT_EXT_PROGRESS                 (1<<4)       // Event of register PROTOCOL_PROGRESS
+#define B_EVT_EXT_STATUS                   (1<<5)       // Event of register STATUS, sent on the tick after a state changed
+#define B_EVT_EXT_SCHEDULE                 (1<<6)       // Event of register SCHEDULE_COUNT, sent when a command fires
+#define B_EVT_EXT_INPUT_EDGE               (1<<7)       // Event of register INPUT_EDGE_TIME, sent with INPUT_STATE on GM_DI0_SYNC
 #define MSK_BOARD_TYPE                     (3<<0)       // 
 #define GM_PUMP                            (0<<0)       // 
 #define GM_FISH_FEEDER                     (1<<0)       // 
 #define GM_STEP_MOTOR                      (2<<0)       // 
 #define B_PROTOCOL_STATE                   (1<<0)       // Status of the Protocol
+#define MSK_PROTOCOL_TYPE                  (3<<0)       // 
+#define GM_PROTOCOL_STEP                   (0<<0)       // Step-based protocol
+#define GM_PROTOCOL_VOLUME                 (1<<0)       // Volume-based protocol
+#define GM_PROTOCOL_QUEUE                  (2<<0)       // Executes the segments of the protocol queue
+#define GM_PROTOCOL_STREAM                 (3<<0)       // Follows the rate setpoints written to the streaming FIFO
+#define MSK_STREAM_UNDERRUN                (1<<0)       // 
+#define GM_STREAM_UNDERRUN_HOLD            (0<<0)       // Keep the last rate
+#define GM_STREAM_UNDERRUN_DECAY           (1<<0)       // Halve the rate on every period without a setpoint
+#define MSK_HOMING                         (3<<0)       // Homing command
+#define GM_HOMING_STOP                     (0<<0)       // Stops the homing routine
+#define GM_HOMING_FORWARD                  (1<<0)       // Homes on the forward switch
+#define GM_HOMING_REVERSE                  (2<<0)       // Homes on the reverse switch
+#define GM_HOMING_IDLE                     0            // Never started
+#define GM_HOMING_APPROACH                 1            // Fast approach to the switch
+#define GM_HOMING_BACK_OFF                 2            // Moving away from the switch
+#define GM_HOMING_REAPPROACH               3            // Slow approach to the switch
+#define GM_HOMING_DONE                     4            // Position set on the switch
+#define GM_HOMING_FAILED                   5            // Stopped, or the switch was not found
+#define MSK_REFILL_MODE                    (3<<0)       // End of travel of the infusion
+#define GM_REFILL_OFF                      (0<<0)       // The protocol stops at the end of travel
+#define GM_REFILL_SWITCH                   (1<<0)       // Refills when the switch in the infusion direction is reached
+#define GM_REFILL_POSITION                 (2<<0)       // Refills when REFILL_END_POSITION is reached
+#define B_COMMIT_PERIOD                    (1<<0)       // Applies PROTOCOL_NEXT_PERIOD_US
+#define B_COMMIT_STEPS                     (1<<1)       // Applies PROTOCOL_NEXT_STEPS
+#define B_COMMIT_DIRECTION                 (1<<2)       // Applies PROTOCOL_NEXT_DIRECTION
+#define B_STATUS_STEPPING                  (1<<0)       // Steps were made since the last snapshot
+#define B_STATUS_DIR                       (1<<1)       // Register DIR_STATE
+#define B_STATUS_SW_FORWARD                (1<<2)       // Register SW_FORWARD_STATE
+#define B_STATUS_SW_REVERSE                (1<<3)       // Register SW_REVERSE_STATE
+#define B_STATUS_INPUT                     (1<<4)       // Register INPUT_STATE
+#define B_STATUS_PROTOCOL                  (1<<5)       // Register PROTOCOL_STATE
+
+#define PROTOCOL_PERIOD_US_MIN             100          // Minimum step period in us
+#define PROTOCOL_PERIOD_US_MAX             65535000     // Maximum step period in us (same as REG_PROTOCOL_PERIOD)
+
+#define STREAM_RATE_MAX                    10000        // Maximum streaming rate in steps/s (one step every PROTOCOL_PERIOD_US_MIN)
+#define MICROSTEP_AUTO_RATE_MIN            100          // Minimum STEP rate for the automatic microstep mode in steps/s
+#define DIR_FORWARD                        1            // Value of DIR_STATE towards the forward switch
+#define DIR_REVERSE                        0            // Value of DIR_STATE towards the reverse switch
+#define MOTION_HOMING                      0x10         // Step engine running the homing routine (after the GM_PROTOCOL_* types)
+#define MOTION_REFILL                      0x11         // Step engine running the refill of the syringe
+#define MOTION_JOG                         0x12         // Step engine running the jog of the buttons
+
+/* Elements of REG_PROTOCOL_CONFIG */
+#define CONFIG_PROTOCOL_TYPE               0            // PROTOCOL_TYPE
+#define CONFIG_PROTOCOL_DIRECTION          1            // PROTOCOL_DIRECTION
+#define CONFIG_NUMBER_STEPS                2            // PROTOCOL_NUMBER_STEPS_32
+#define CONFIG_PERIOD_US                   3            // PROTOCOL_PERIOD_US
+#define CONFIG_FLOWRATE_NL                 4            // PROTOCOL_FLOWRATE in nL/s
+#define CONFIG_VOLUME_NL                   5            // PROTOCOL_VOLUME in nL
+#define CONFIG_CALIBRATION_OFFSET_NL       6            // CALIBRATION_VALUE_1 in nL (signed)
+#define CONFIG_CALIBRATION_SLOPE_PL        7            // CALIBRATION_VALUE_2 in pL/step
+#define CONFIG_ACCELERATION                8            // PROTOCOL_ACCELERATION
+#define CONFIG_DECELERATION                9            // PROTOCOL_DECELERATION
+#define CONFIG_MICROSTEP                   10           // MOTOR_MICROSTEP
+#define CONFIG_DI0                         11           // DI0_CONFIG
+#define CONFIG_DO0                         12           // DO0_CONFIG
+#define CONFIG_DO1                         13           // DO1_CONFIG
+#define CONFIG_EVT_ENABLE                  14           // EVT_ENABLE
+#define CONFIG_LENGTH                      15
+
+/* Elements of REG_CPU_LOAD, all saturate at 65535 */
+#define CPU_LOAD_TICK_MIN                  0            // Minimum CPU cycles used by a core tick (500 us, 16000 cycles)
+#define CPU_LOAD_TICK_AVERAGE              1            // Average CPU cycles used by a core tick, over about 16 ticks
+#define CPU_LOAD_TICK_MAX                  2            // Maximum CPU cycles used by a core tick
+#define CPU_LOAD_LATENCY_PORTB             3            // Worst CPU cycles from a DI0 edge to its interrupt
+#define CPU_LOAD_LATENCY_PORTC             4            // Worst CPU cycles from a SW_F edge to its interrupt
+#define CPU_LOAD_LATENCY_PORTD             5            // Worst CPU cycles from a BUT_PUSH edge to its interrupt
+#define CPU_LOAD_MISSED_TICKS              6            // Core ticks that didn't run on time
+#define CPU_LOAD_LATE_STEPS                7            // Protocol STEPs raised after the end of their pulse
+#define CPU_LOAD_TX_DEPTH                  8            // Bytes waiting on the core's TX buffer
+#define CPU_LOAD_TX_DEPTH_MAX              9            // Maximum bytes waiting on the core's TX buffer
+#define CPU_LOAD_LENGTH                    10
+
+/* Elements of REG_STEP_INTERVALS, of the STEPs raised by the step engine */
+#define INTERVALS_COUNT                    0            // Intervals measured
+#define INTERVALS_MIN_US                   1            // Shortest interval in us
+#define INTERVALS_MAX_US                   2            // Longest interval in us
+#define INTERVALS_MEAN_US                  3            // Mean interval in us, updated when read
+#define INTERVALS_LENGTH                   4
+
+// REG_STEP_JITTER bin 7 counts the intervals within 1 us of the commanded one, bins 6 to 0 the ones
+// shorter by 1, 2, 4, 8, 16, 32 and 64 or more us and bins 8 to 14 the ones longer by the same amounts
+#define STEP_JITTER_BINS                   15
+
+// steps are reported in batches (STEP_DELTA) instead of on each STEP edge
+#define STEP_REPORT_DECIMATED              (app_regs.REG_STEP_REPORT_STEPS || app_regs.REG_STEP_REPORT_PERIOD)
+
+#define STEP_TIMER_TICKS_PER_US            4            // The step engine timer is clocked at 32 MHz / 8 (250 ns per tick)
 
 #endif /* _APP_REGS_H_ */
\ No newline at end of file
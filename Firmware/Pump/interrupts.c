@@ -11,44 +11,146 @@ extern AppRegs app_regs;
 extern bool but_reset_pressed;
 extern bool but_reset_dir_change;
 extern bool running_protocol;
+extern uint8_t curr_dir;
 extern bool switch_f_active;
 extern bool switch_r_active;
+extern volatile bool switch_f_inhibit;
+extern volatile bool switch_r_inhibit;
 extern void switch_pressed(uint8_t direction);
 
 /************************************************************************/
 /* Interrupts from Timers                                               */
 /************************************************************************/
-// ISR(TCC0_OVF_vect, ISR_NAKED)
-// ISR(TCD0_OVF_vect, ISR_NAKED)
 // ISR(TCE0_OVF_vect, ISR_NAKED)
 // ISR(TCF0_OVF_vect, ISR_NAKED)
 // 
-// ISR(TCC0_CCA_vect, ISR_NAKED)
-// ISR(TCD0_CCA_vect, ISR_NAKED)
 // ISR(TCE0_CCA_vect, ISR_NAKED)
 // ISR(TCF0_CCA_vect, ISR_NAKED)
 // 
-// ISR(TCD1_OVF_vect, ISR_NAKED)
-// 
 // ISR(TCD1_CCA_vect, ISR_NAKED)
 
+/************************************************************************/
+/* Step engine (TCC0)                                                   */
+/************************************************************************/
+extern void step_timer_overflow(void);
+extern void clear_step();
+
+ISR(TCC0_OVF_vect, ISR_NAKED)
+{
+	step_timer_overflow();
+	reti();
+}
+
+ISR(TCC0_CCA_vect, ISR_NAKED)
+{
+	// end of the STEP pulse
+	clear_step();
+	reti();
+}
+
+/************************************************************************/
+/* Step playback (TCE0 + DMA)                                           */
+/************************************************************************/
+extern void playback_block_done(uint8_t half);
+
+ISR(DMA_CH2_vect, ISR_NAKED)
+{
+	playback_block_done(0);
+	reti();
+}
+
+ISR(DMA_CH3_vect, ISR_NAKED)
+{
+	playback_block_done(1);
+	reti();
+}
+
+/************************************************************************/
+/* Timestamp timer (TCD0)                                               */
+/************************************************************************/
+extern void ts_timer_overflow(void);
+extern void ts_second_boundary(uint16_t capture);
+extern void di0_edge_captured(uint16_t capture);
+
+ISR(TCD0_OVF_vect, ISR_NAKED)
+{
+	ts_timer_overflow();
+	reti();
+}
+
+ISR(TCD0_CCA_vect, ISR_NAKED)
+{
+	// DI0 edge
+	di0_edge_captured(TCD0.CCA);
+	reti();
+}
+
+ISR(TCD0_CCB_vect, ISR_NAKED)
+{
+	// TCC1 overflow, the core's second boundary
+	ts_second_boundary(TCD0.CCB);
+	reti();
+}
+
+/************************************************************************/
+/* Scheduled commands (TCD1)                                            */
+/************************************************************************/
+extern void schedule_timer_expired(void);
+
+ISR(TCD1_OVF_vect, ISR_NAKED)
+{
+	schedule_timer_expired();
+	reti();
+}
+
 /************************************************************************/ 
 /* IN00                                                                 */
 /************************************************************************/
 uint8_t previous_in0;
 
-ISR(PORTB_INT0_vect, ISR_NAKED)
+extern volatile int16_t di0_follow_steps;
+extern volatile uint8_t di0_follow_overrun;
+extern volatile uint16_t cpu_portb_entry;
+
+// not naked, at the HIGH level of GM_DI0_FOLLOW_STEP it preempts the other interrupts and must save their context
+ISR(PORTB_INT0_vect)
 {
 	uint8_t aux = read_IN00;
-
-	if((app_regs.REG_DI0_CONFIG & MSK_DI0_CONF) == GM_DI0_SYNC )
+	
+	// the latency is taken against the capture of the edge, on the TCD0 interrupt
+	cpu_portb_entry = TCD0.CNT;
+	
+	// fast path, STEP follows the input and everything else is done later on the 1 ms callback
+	if((app_regs.REG_DI0_CONFIG & MSK_DI0_CONF) == GM_DI0_FOLLOW_STEP && app_regs.REG_ENABLE_MOTOR_DRIVER)
 	{
-		app_regs.REG_INPUT_STATE = aux;
-		app_write_REG_INPUT_STATE(&app_regs.REG_INPUT_STATE);
-		core_func_send_event(ADD_REG_INPUT_STATE, true);
+		if(aux)
+		{
+			// only allow steps if the switch on the same direction is not active
+			if(curr_dir == DIR_FORWARD ? !(read_SW_F || switch_f_inhibit) : !(read_SW_R || switch_r_inhibit))
+			{
+				set_STEP;
+				di0_follow_steps += curr_dir == DIR_FORWARD ? 1 : -1;
+			}
+			else if(di0_follow_overrun != 0xFF)
+			{
+				// steps still requested towards a switch after it was pressed, counted in SWITCH_OVERRUN_STEPS later
+				di0_follow_overrun++;
+			}
+		}
+		else
+		{
+			clr_STEP;
+		}
+		
+		previous_in0 = aux;
+		return;
 	}
+
+	// on GM_DI0_SYNC, the edge is reported with its capture time from the TCD0 interrupt
 	
-	if((app_regs.REG_DI0_CONFIG & MSK_DI0_CONF) == GM_DI0_RISE_FALL_UPDATE_STEP )
+	// the first step while following the input enables the motor driver
+	if((app_regs.REG_DI0_CONFIG & MSK_DI0_CONF) == GM_DI0_RISE_FALL_UPDATE_STEP ||
+	   (app_regs.REG_DI0_CONFIG & MSK_DI0_CONF) == GM_DI0_FOLLOW_STEP)
 	{
 		// transition from low to high
 		if(previous_in0 == 0 && aux == 1)
@@ -71,43 +173,58 @@ ISR(PORTB_INT0_vect, ISR_NAKED)
 	}
 	
 	previous_in0 = aux;
-	
-	reti();
 }
 
 
 /************************************************************************/ 
 /* SW_F, SW_R, TYPE0 & TYPE1                                            */
 /************************************************************************/
-extern void clear_sw_f();
-extern void clear_sw_r();
+extern uint8_t sw_f_release_ms;
+extern uint8_t sw_r_release_ms;
+extern void switch_asserted(uint8_t direction);
+extern void cpu_load_latency(uint8_t index, uint16_t entry, uint16_t capture);
+
+// the release is de-bounced on the 1 ms callback
+#define SWITCH_RELEASE_MS 50
 
 ISR(PORTC_INT0_vect, ISR_NAKED)
 {
-	if(!(read_SW_F))
+	uint16_t entry = TCD0.CNT;
+	
+	// SW_F edges are captured on TCD0 CCC
+	if(TCD0.INTFLAGS & TC0_CCCIF_bm)
+	{
+		cpu_load_latency(CPU_LOAD_LATENCY_PORTC, entry, TCD0.CCC);
+		TCD0.INTFLAGS = TC0_CCCIF_bm;
+	}
+	
+	// a press stops the steps towards the switch right away, only its report is de-bounced
+	if(read_SW_F)
 	{
-		if(switch_f_active)
+		sw_f_release_ms = 0;
+		if(!switch_f_inhibit)
 		{
-			app_regs.REG_SW_FORWARD_STATE = 0;
-			if(app_regs.REG_EVT_ENABLE & B_EVT_SW_FORWARD_STATE)
-				core_func_send_event(ADD_REG_SW_FORWARD_STATE, true);
-			if((app_regs.REG_DO0_CONFIG & MSK_OUT0_CONF) == GM_OUT0_SWLIMIT)
-				clr_OUT00;
+			switch_f_inhibit = true;
+			switch_asserted(1);
 		}
-		clear_sw_f();
+	}
+	else if(switch_f_inhibit && !sw_f_release_ms)
+	{
+		sw_f_release_ms = SWITCH_RELEASE_MS;
 	}
 	
-	if(!(read_SW_R))
+	if(read_SW_R)
 	{
-		if(switch_r_active)
+		sw_r_release_ms = 0;
+		if(!switch_r_inhibit)
 		{
-			app_regs.REG_SW_REVERSE_STATE = 0;
-			if(app_regs.REG_EVT_ENABLE & B_EVT_SW_REVERSE_STATE)
-				core_func_send_event(ADD_REG_SW_REVERSE_STATE, true);
-			if((app_regs.REG_DO0_CONFIG & MSK_OUT0_CONF) == GM_OUT0_SWLIMIT)
-				clr_OUT00;
+			switch_r_inhibit = true;
+			switch_asserted(0);
 		}
-		clear_sw_r();
+	}
+	else if(switch_r_inhibit && !sw_r_release_ms)
+	{
+		sw_r_release_ms = SWITCH_RELEASE_MS;
 	}
 
 	reti();
@@ -122,6 +239,15 @@ extern void clear_but_pull();
 
 ISR(PORTD_INT0_vect, ISR_NAKED)
 {
+	uint16_t entry = TCD0.CNT;
+	
+	// BUT_PUSH edges are captured on TCD0 CCD
+	if(TCD0.INTFLAGS & TC0_CCDIF_bm)
+	{
+		cpu_load_latency(CPU_LOAD_LATENCY_PORTD, entry, TCD0.CCD);
+		TCD0.INTFLAGS = TC0_CCDIF_bm;
+	}
+	
 	if(!(read_BUT_PUSH))
 	{
 		clear_but_push();
@@ -0,0 +1,13 @@
+/* Stand-in for avr-libc's interrupt.h, the simulator calls the ISRs as plain functions */
+#ifndef _SIM_AVR_INTERRUPT_H_
+#define _SIM_AVR_INTERRUPT_H_
+
+// interrupts never preempt the firmware on the simulator, so there's nothing to mask
+#define sei()
+#define cli()
+
+#define ISR_NAKED
+#define ISR(vector, ...) void vector##_handler(void)
+#define reti() return
+
+#endif /* _SIM_AVR_INTERRUPT_H_ */
@@ -0,0 +1,237 @@
+/* Stand-in for the ATxmega128A4U register file, used by the host simulator */
+#ifndef _SIM_AVR_IO_H_
+#define _SIM_AVR_IO_H_
+
+#include <stdint.h>
+
+/************************************************************************/
+/* Peripherals                                                          */
+/************************************************************************/
+typedef struct
+{
+	volatile uint8_t DIR, DIRSET, DIRCLR, DIRTGL;
+	volatile uint8_t OUT, OUTSET, OUTCLR, OUTTGL;
+	volatile uint8_t IN, INTCTRL, INT0MASK, INT1MASK, INTFLAGS, REMAP;
+	volatile uint8_t PIN0CTRL, PIN1CTRL, PIN2CTRL, PIN3CTRL, PIN4CTRL, PIN5CTRL, PIN6CTRL, PIN7CTRL;
+} PORT_t;
+
+// the interrupt flags are cleared by writing ones, so the simulator keeps SIM_FLAGS_MARKER set on them
+// and takes a value without it as a write of the firmware (see sim_hw.c)
+#define SIM_FLAGS_MARKER 0x100
+
+typedef struct
+{
+	volatile uint8_t CTRLA, CTRLB, CTRLC, CTRLD, CTRLE, INTCTRLA, INTCTRLB;
+	volatile uint8_t CTRLFCLR, CTRLFSET, CTRLGCLR, CTRLGSET, TEMP;
+	volatile uint16_t INTFLAGS;
+	volatile uint16_t CNT, PER, CCA, CCB, CCC, CCD;
+	volatile uint16_t PERBUF, CCABUF, CCBBUF, CCCBUF, CCDBUF;
+} TC0_t;
+
+typedef struct
+{
+	volatile uint8_t CTRLA, CTRLB, CTRLC, CTRLD, CTRLE, INTCTRLA, INTCTRLB;
+	volatile uint8_t CTRLFCLR, CTRLFSET, CTRLGCLR, CTRLGSET, TEMP;
+	volatile uint16_t INTFLAGS;
+	volatile uint16_t CNT, PER, CCA, CCB;
+	volatile uint16_t PERBUF, CCABUF, CCBBUF;
+} TC1_t;
+
+typedef struct
+{
+	volatile uint8_t CH0MUX, CH1MUX, CH2MUX, CH3MUX, CH4MUX, CH5MUX, CH6MUX, CH7MUX;
+	volatile uint8_t CH0CTRL, CH1CTRL, CH2CTRL, CH3CTRL, CH4CTRL, CH5CTRL, CH6CTRL, CH7CTRL;
+	volatile uint8_t STROBE, DATA;
+} EVSYS_t;
+
+typedef struct
+{
+	volatile uint8_t CTRLA, CTRLB, ADDRCTRL, TRIGSRC;
+	volatile uint16_t TRFCNT;
+	volatile uint8_t REPCNT;
+	volatile uint8_t SRCADDR0, SRCADDR1, SRCADDR2;
+	volatile uint8_t DESTADDR0, DESTADDR1, DESTADDR2;
+} DMA_CH_t;
+
+typedef struct
+{
+	volatile uint8_t CTRL, INTFLAGS, STATUS;
+	DMA_CH_t CH0, CH1, CH2, CH3;
+} DMA_t;
+
+typedef struct
+{
+	volatile uint8_t STATUS, INTPRI, CTRL;
+} PMIC_t;
+
+typedef struct
+{
+	volatile uint8_t CTRLA, CTRLB;
+} ADC_t;
+
+// every access to a port first applies the writes of the previous one, so each pin change is seen
+#define SIM_PORTA 0
+#define SIM_PORTB 1
+#define SIM_PORTC 2
+#define SIM_PORTD 3
+#define SIM_PORTE 4
+#define SIM_PORTR 5
+#define SIM_N_PORTS 6
+PORT_t * sim_port_access(uint8_t index);
+
+#define PORTA (*sim_port_access(SIM_PORTA))
+#define PORTB (*sim_port_access(SIM_PORTB))
+#define PORTC (*sim_port_access(SIM_PORTC))
+#define PORTD (*sim_port_access(SIM_PORTD))
+#define PORTE (*sim_port_access(SIM_PORTE))
+#define PORTR (*sim_port_access(SIM_PORTR))
+
+extern TC0_t TCC0, TCD0, TCE0;
+extern TC1_t TCC1, TCD1;
+extern EVSYS_t EVSYS;
+extern DMA_t DMA;
+extern PMIC_t PMIC;
+extern volatile uint8_t SREG;
+
+/************************************************************************/
+/* PMIC                                                                 */
+/************************************************************************/
+#define PMIC_CTRL PMIC.CTRL
+#define PMIC_LOLVLEN_bm 0x01
+#define PMIC_MEDLVLEN_bm 0x02
+#define PMIC_HILVLEN_bm 0x04
+#define PMIC_RREN_bm 0x80
+
+/************************************************************************/
+/* PORT                                                                 */
+/************************************************************************/
+#define PORT_INT0LVL_gm 0x03
+#define PORT_INT1LVL_gm 0x0C
+#define PORT_INT0IF_bm 0x01
+#define PORT_INT1IF_bm 0x02
+#define PORT_ISC_gm 0x07
+#define PORT_ISC_BOTHEDGES_gc 0x00
+#define PORT_ISC_RISING_gc 0x01
+#define PORT_ISC_FALLING_gc 0x02
+#define PORT_ISC_LEVEL_gc 0x03
+#define PORT_ISC_INPUT_DISABLE_gc 0x07
+
+/************************************************************************/
+/* TC                                                                   */
+/************************************************************************/
+#define TC_CLKSEL_gm 0x0F
+#define TC_CLKSEL_OFF_gc 0x00
+#define TC_CLKSEL_DIV1_gc 0x01
+#define TC_CLKSEL_DIV2_gc 0x02
+#define TC_CLKSEL_DIV4_gc 0x03
+#define TC_CLKSEL_DIV8_gc 0x04
+#define TC_CLKSEL_DIV64_gc 0x05
+#define TC_CLKSEL_DIV256_gc 0x06
+#define TC_CLKSEL_DIV1024_gc 0x07
+
+#define TC_WGMODE_gm 0x07
+#define TC_WGMODE_NORMAL_gc 0x00
+#define TC0_CCAEN_bm 0x10
+#define TC0_CCBEN_bm 0x20
+#define TC0_CCCEN_bm 0x40
+#define TC0_CCDEN_bm 0x80
+#define TC1_CCAEN_bm 0x10
+#define TC1_CCBEN_bm 0x20
+
+#define TC_EVACT_gm 0xE0
+#define TC_EVACT_OFF_gc 0x00
+#define TC_EVACT_CAPT_gc 0x20
+#define TC_EVSEL_gm 0x0F
+#define TC_EVSEL_OFF_gc 0x00
+#define TC_EVSEL_CH0_gc 0x08
+#define TC_EVSEL_CH1_gc 0x09
+#define TC_EVSEL_CH2_gc 0x0A
+#define TC_EVSEL_CH3_gc 0x0B
+
+#define TC0_OVFIF_bm 0x01
+#define TC0_ERRIF_bm 0x02
+#define TC0_CCAIF_bm 0x10
+#define TC0_CCBIF_bm 0x20
+#define TC0_CCCIF_bm 0x40
+#define TC0_CCDIF_bm 0x80
+#define TC1_OVFIF_bm 0x01
+#define TC1_CCAIF_bm 0x10
+#define TC1_CCBIF_bm 0x20
+
+/************************************************************************/
+/* EVSYS                                                                */
+/************************************************************************/
+#define EVSYS_CHMUX_OFF_gc 0x00
+#define EVSYS_CHMUX_PORTA_PIN0_gc 0x50
+#define EVSYS_CHMUX_PORTB_PIN0_gc 0x58
+#define EVSYS_CHMUX_PORTC_PIN0_gc 0x60
+#define EVSYS_CHMUX_PORTC_PIN4_gc 0x64
+#define EVSYS_CHMUX_PORTD_PIN0_gc 0x68
+#define EVSYS_CHMUX_PORTD_PIN5_gc 0x6D
+#define EVSYS_CHMUX_PORTE_PIN0_gc 0x70
+#define EVSYS_CHMUX_TCC0_OVF_gc 0xC0
+#define EVSYS_CHMUX_TCC1_OVF_gc 0xC8
+#define EVSYS_CHMUX_TCD0_OVF_gc 0xD0
+#define EVSYS_CHMUX_TCD1_OVF_gc 0xD8
+#define EVSYS_CHMUX_TCE0_OVF_gc 0xE0
+
+/************************************************************************/
+/* DMA                                                                  */
+/************************************************************************/
+#define DMA_ENABLE_bm 0x80
+#define DMA_RESET_bm 0x40
+#define DMA_DBUFMODE_gm 0x0C
+#define DMA_DBUFMODE_DISABLED_gc 0x00
+#define DMA_DBUFMODE_CH01_gc 0x04
+#define DMA_DBUFMODE_CH23_gc 0x08
+#define DMA_DBUFMODE_CH01CH23_gc 0x0C
+#define DMA_PRIMODE_gm 0x03
+#define DMA_PRIMODE_RR0123_gc 0x00
+#define DMA_PRIMODE_CH0123_gc 0x03
+
+#define DMA_CH_ENABLE_bm 0x80
+#define DMA_CH_RESET_bm 0x40
+#define DMA_CH_REPEAT_bm 0x20
+#define DMA_CH_TRFREQ_bm 0x10
+#define DMA_CH_SINGLE_bm 0x04
+#define DMA_CH_BURSTLEN_gm 0x03
+#define DMA_CH_BURSTLEN_1BYTE_gc 0x00
+#define DMA_CH_BURSTLEN_2BYTE_gc 0x01
+#define DMA_CH_BURSTLEN_4BYTE_gc 0x02
+#define DMA_CH_BURSTLEN_8BYTE_gc 0x03
+
+#define DMA_CH_CHBUSY_bm 0x80
+#define DMA_CH_CHPEND_bm 0x40
+#define DMA_CH_ERRIF_bm 0x20
+#define DMA_CH_TRNIF_bm 0x10
+#define DMA_CH_TRNINTLVL_gm 0x03
+#define DMA_CH_TRNINTLVL_OFF_gc 0x00
+#define DMA_CH_TRNINTLVL_LO_gc 0x01
+#define DMA_CH_TRNINTLVL_MED_gc 0x02
+#define DMA_CH_TRNINTLVL_HI_gc 0x03
+
+#define DMA_CH_SRCRELOAD_gm 0xC0
+#define DMA_CH_SRCRELOAD_NONE_gc 0x00
+#define DMA_CH_SRCRELOAD_BLOCK_gc 0x40
+#define DMA_CH_SRCRELOAD_BURST_gc 0x80
+#define DMA_CH_SRCRELOAD_TRANSACTION_gc 0xC0
+#define DMA_CH_SRCDIR_gm 0x30
+#define DMA_CH_SRCDIR_FIXED_gc 0x00
+#define DMA_CH_SRCDIR_INC_gc 0x10
+#define DMA_CH_DESTRELOAD_gm 0x0C
+#define DMA_CH_DESTRELOAD_NONE_gc 0x00
+#define DMA_CH_DESTRELOAD_BLOCK_gc 0x04
+#define DMA_CH_DESTRELOAD_BURST_gc 0x08
+#define DMA_CH_DESTRELOAD_TRANSACTION_gc 0x0C
+#define DMA_CH_DESTDIR_gm 0x03
+#define DMA_CH_DESTDIR_FIXED_gc 0x00
+#define DMA_CH_DESTDIR_INC_gc 0x01
+
+#define DMA_CH_TRIGSRC_OFF_gc 0x00
+#define DMA_CH_TRIGSRC_TCC0_OVF_gc 0x40
+#define DMA_CH_TRIGSRC_TCD0_OVF_gc 0x60
+#define DMA_CH_TRIGSRC_TCE0_OVF_gc 0x80
+#define DMA_CH_TRIGSRC_TCD1_OVF_gc 0x66
+#define DMA_CH_TRIGSRC_TCC1_OVF_gc 0x46
+
+#endif /* _SIM_AVR_IO_H_ */
@@ -0,0 +1,12 @@
+/* Stand-in for avr-libc's delay.h, the busy waits advance the virtual clock */
+#ifndef _SIM_UTIL_DELAY_H_
+#define _SIM_UTIL_DELAY_H_
+
+#include <stdint.h>
+
+void sim_busy_wait_us(uint32_t us);
+
+#define _delay_us(us) sim_busy_wait_us(us)
+#define _delay_ms(ms) sim_busy_wait_us((uint32_t)(ms) * 1000)
+
+#endif /* _SIM_UTIL_DELAY_H_ */
@@ -0,0 +1,104 @@
+/* Host-side simulator of the pump firmware, shared by the stand-ins and the scenario runner */
+#ifndef _SIM_H_
+#define _SIM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <avr/io.h>
+
+#ifndef bool
+	#define bool uint8_t
+#endif
+#ifndef true
+	#define true 1
+	#define false 0
+#endif
+
+/************************************************************************/
+/* Virtual clock                                                        */
+/************************************************************************/
+// the clock counts the 32 MHz CPU cycles, the peripherals are stepped every 8 cycles (one tick of a timer at DIV8)
+#define SIM_F_CPU 32000000UL
+#define SIM_CYCLES_PER_US 32
+#define SIM_STEP_CYCLES 8
+
+// the core runs its callbacks every 500 us
+#define SIM_CORE_TICK_CYCLES (500 * SIM_CYCLES_PER_US)
+
+extern uint64_t sim_cycles;
+
+// the firmware runs in zero virtual time, only the busy waits move the clock
+void sim_busy_wait_us(uint32_t us);
+
+/************************************************************************/
+/* Log                                                                  */
+/************************************************************************/
+// each line is the virtual time in us, a kind (PIN, EVENT, WRITE, READ) and its details
+void sim_log(const char * kind, const char * format, ...);
+void sim_log_to(FILE * file);
+// the benchmark turns the log off, so the formatting isn't timed with the firmware
+extern bool sim_log_enabled;
+// formats the elements of a register as text, signed and float types included
+void sim_format_payload(char * text, size_t size, uint8_t type, const uint8_t * payload, uint16_t n_elements);
+
+/************************************************************************/
+/* Probes                                                               */
+/************************************************************************/
+// host time spent in a function of the firmware, only taken while sim_probing is set
+typedef struct
+{
+	const char * name;
+	uint64_t calls;
+	uint64_t ns_min;
+	uint64_t ns_max;
+	uint64_t ns_total;
+	uint64_t latency_max;       // longest wait in ns from the interrupt being raised, for the vectors
+} SimProbe;
+
+extern bool sim_probing;
+
+uint64_t sim_probe_now(void);
+// accounts a call that started at start, the probe is listed on its first call
+void sim_probe_add(SimProbe * probe, uint64_t start, uint64_t latency);
+// the probes in the order of their first call
+extern SimProbe * sim_probes[];
+extern uint8_t sim_n_probes;
+
+/************************************************************************/
+/* Scenarios (sim_scenario.c)                                           */
+/************************************************************************/
+// runs the commands of a scenario on the device already booted, exits on an error
+void sim_scenario_run(FILE * file, const char * name);
+
+/************************************************************************/
+/* Hardware (sim_hw.c)                                                  */
+/************************************************************************/
+void sim_hw_reset(void);
+// advances the peripherals by SIM_STEP_CYCLES and runs the interrupts raised meanwhile
+void sim_hw_step(void);
+// applies the register writes of the firmware and runs the pending interrupts, called after each entry in the firmware
+void sim_hw_sync(void);
+// applies the pending port writes, so their PIN lines are logged before what the firmware does next
+void sim_hw_apply_ports(void);
+// routes an event system source (EVSYS_CHMUX_*) to the peripherals listening to it
+void sim_hw_event(uint8_t source);
+// drives an input pin from outside the device
+bool sim_pin_set(const char * name, uint8_t level);
+// clears the flags the firmware can't clear on the host after it serviced them (see sim_hw.c)
+void sim_timer_clear_flags(volatile void * timer);
+
+/************************************************************************/
+/* Core (sim_core.c)                                                    */
+/************************************************************************/
+// boots the application, like the bootloader jumping to main()
+void sim_core_boot(void);
+// runs the device for the given number of cycles
+void sim_run(uint64_t cycles);
+// writes and reads an application register, as the host would
+bool sim_write_register(uint8_t address, uint8_t * content, uint16_t n_elements);
+bool sim_read_register(uint8_t address);
+// type and number of elements of an application register, false if it doesn't exist
+bool sim_register_info(uint8_t address, uint8_t * type, uint16_t * n_elements);
+
+#endif /* _SIM_H_ */
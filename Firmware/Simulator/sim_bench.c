@@ -0,0 +1,133 @@
+/* Benchmark of the pump firmware: runs each scenario on a fresh device and reports the time spent in the callbacks and interrupts */
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "sim.h"
+
+/************************************************************************/
+/* Wrapped functions                                                    */
+/************************************************************************/
+// linked with --wrap, so only the calls from the other files are timed (interrupts.c and app.c)
+bool __real_app_write_REG_STEP_STATE(void *a);
+
+bool __wrap_app_write_REG_STEP_STATE(void *a)
+{
+	static SimProbe probe = { "app_write_REG_STEP_STATE" };
+	uint64_t start;
+	bool ok;
+
+	if(!sim_probing)
+		return __real_app_write_REG_STEP_STATE(a);
+
+	start = sim_probe_now();
+	ok = __real_app_write_REG_STEP_STATE(a);
+	sim_probe_add(&probe, start, 0);
+	return ok;
+}
+
+/************************************************************************/
+/* Report                                                               */
+/************************************************************************/
+// every callback and interrupt of a tick must end before the next one
+#define TICK_BUDGET_NS 500000
+
+// ATxmega time over host time, given with -s, scales the max to the device for the headroom
+static double scale = 1.0;
+
+static int compare_probes(const void * a, const void * b)
+{
+	return strcmp((*(SimProbe * const *)a)->name, (*(SimProbe * const *)b)->name);
+}
+
+/* One line per probe, tab separated, so the runs can be compared over commits */
+static void report(const char * scenario)
+{
+	qsort(sim_probes, sim_n_probes, sizeof(sim_probes[0]), compare_probes);
+
+	for(uint8_t i = 0; i < sim_n_probes; i++)
+	{
+		SimProbe * probe = sim_probes[i];
+		double headroom = TICK_BUDGET_NS - probe->ns_max * scale;
+
+		printf("%s\t%s\t%llu\t%llu\t%llu\t%llu\t%llu\t%.0f\t%.1f\n", scenario, probe->name,
+			(unsigned long long)probe->calls,
+			(unsigned long long)probe->ns_min,
+			(unsigned long long)(probe->ns_total / probe->calls),
+			(unsigned long long)probe->ns_max,
+			(unsigned long long)probe->latency_max,
+			headroom,
+			100.0 * headroom / TICK_BUDGET_NS);
+	}
+}
+
+/* Runs a scenario in a child process, the firmware keeps its state in statics that only a new process resets */
+static int bench(const char * path)
+{
+	const char * name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+	char scenario[64];
+	int status;
+	pid_t child;
+
+	snprintf(scenario, sizeof(scenario), "%.*s", (int)strcspn(name, "."), name);
+
+	fflush(stdout);
+	child = fork();
+	if(child < 0)
+	{
+		perror("fork");
+		return 1;
+	}
+
+	if(child == 0)
+	{
+		FILE * file = fopen(path, "r");
+
+		if(!file)
+		{
+			perror(path);
+			exit(1);
+		}
+
+		sim_log_enabled = false;
+		sim_core_boot();
+
+		sim_probing = true;
+		sim_scenario_run(file, path);
+		sim_probing = false;
+
+		report(scenario);
+		fclose(file);
+		exit(0);
+	}
+
+	if(waitpid(child, &status, 0) < 0 || !WIFEXITED(status))
+		return 1;
+
+	return WEXITSTATUS(status);
+}
+
+int main(int argc, char ** argv)
+{
+	int result = 0;
+	int first = 1;
+
+	if(argc > 2 && !strcmp(argv[1], "-s"))
+	{
+		scale = atof(argv[2]);
+		first = 3;
+	}
+
+	if(argc <= first || scale <= 0)
+	{
+		fprintf(stderr, "usage: %s [-s scale] scenario...\n", argv[0]);
+		return 2;
+	}
+
+	printf("scenario\tfunction\tcalls\tmin_ns\tavg_ns\tmax_ns\tmax_latency_ns\theadroom_ns\theadroom_pct\n");
+
+	for(int i = first; i < argc; i++)
+		result |= bench(argv[i]);
+
+	return result;
+}
@@ -0,0 +1,356 @@
+/* Stand-in for the Harp core (hwbp_core.h): boot, timer callbacks, timestamps, events and register access */
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include "sim.h"
+#include "hwbp_core.h"
+#include "hwbp_core_types.h"
+#include "app.h"
+#include "app_ios_and_regs.h"
+
+extern uint8_t app_regs_type[];
+extern uint16_t app_regs_n_elements[];
+extern uint8_t *app_regs_pointer[];
+
+uint64_t sim_cycles = 0;
+
+static FILE * sim_log_file = 0;
+bool sim_log_enabled = true;
+
+bool sim_probing = false;
+SimProbe * sim_probes[64];
+uint8_t sim_n_probes = 0;
+
+// the core callbacks are due at these cycles
+static uint64_t core_next_tick;
+static uint64_t core_next_second;
+static uint32_t core_ticks;
+
+static uint32_t core_user_seconds = 0;
+static uint16_t core_user_useconds = 0;
+
+// the core's TX ring buffer, the replies and events are logged instead so it stays empty
+uint16_t hwbp_uart_head = 0;
+uint16_t hwbp_uart_tail = 0;
+
+/************************************************************************/
+/* Log                                                                  */
+/************************************************************************/
+void sim_log_to(FILE * file)
+{
+	sim_log_file = file;
+}
+
+void sim_log(const char * kind, const char * format, ...)
+{
+	FILE * file = sim_log_file ? sim_log_file : stdout;
+	va_list args;
+
+	if(!sim_log_enabled)
+		return;
+
+	// resolution of 1/32 us, the timers step every 1/4 us
+	fprintf(file, "%12llu.%03u %-5s ", (unsigned long long)(sim_cycles / SIM_CYCLES_PER_US), (unsigned)((sim_cycles % SIM_CYCLES_PER_US) * 1000 / SIM_CYCLES_PER_US), kind);
+
+	va_start(args, format);
+	vfprintf(file, format, args);
+	va_end(args);
+
+	fputc('\n', file);
+}
+
+void sim_format_payload(char * text, size_t size, uint8_t type, const uint8_t * payload, uint16_t n_elements)
+{
+	uint8_t length = type & MSK_TYPE_LEN;
+	size_t used = 0;
+
+	text[0] = 0;
+
+	for(uint16_t i = 0; i < n_elements && used < size; i++, payload += length)
+	{
+		const char * separator = i ? " " : "";
+		int n;
+
+		if(type & MSK_TYPE_FLOAT)
+		{
+			float value;
+			memcpy(&value, payload, sizeof(value));
+			n = snprintf(text + used, size - used, "%s%g", separator, value);
+		}
+		else if(type & MSK_TYPE_INTEGER)
+		{
+			int64_t value = 0;
+			memcpy(&value, payload, length);
+			// sign extension of the narrower types
+			value = (value << (64 - 8 * length)) >> (64 - 8 * length);
+			n = snprintf(text + used, size - used, "%s%lld", separator, (long long)value);
+		}
+		else
+		{
+			uint64_t value = 0;
+			memcpy(&value, payload, length);
+			n = snprintf(text + used, size - used, "%s%llu", separator, (unsigned long long)value);
+		}
+
+		if(n < 0)
+			break;
+		used += n;
+	}
+}
+
+/************************************************************************/
+/* Core functions                                                       */
+/************************************************************************/
+void core_func_start_core (
+    const uint16_t who_am_i,
+    const uint8_t hwH,
+    const uint8_t hwL,
+    const uint8_t fwH,
+    const uint8_t fwL,
+    const uint8_t assembly,
+    uint8_t *pointer_to_app_regs,
+    const uint16_t app_mem_size_to_save,
+    const uint8_t num_of_app_registers,
+    const uint8_t *device_name,
+	const bool	device_is_able_to_repeat_clock,
+	const bool	device_is_able_to_generate_clock,
+	const uint8_t default_timestamp_offset
+	)
+{
+	// same order as the core, the registers start from their defaults since there's no EEPROM
+	core_callback_define_clock_default();
+	sim_hw_sync();
+	core_callback_initialize_hardware();
+	sim_hw_sync();
+	core_callback_reset_registers();
+	sim_hw_sync();
+	core_callback_registers_were_reinitialized();
+	sim_hw_sync();
+}
+
+// the host is connected, so the device is on Active Mode and sends the events
+void core_func_send_event(uint8_t add, bool use_core_timestamp)
+{
+	uint8_t index = add - APP_REGS_ADD_MIN;
+	char text[256];
+
+	if(add < APP_REGS_ADD_MIN || add > APP_REGS_ADD_MAX)
+	{
+		sim_log("EVENT", "%u", add);
+		return;
+	}
+
+	if(!sim_log_enabled)
+		return;
+
+	sim_format_payload(text, sizeof(text), app_regs_type[index], app_regs_pointer[index], app_regs_n_elements[index]);
+	sim_hw_apply_ports();
+
+	if(use_core_timestamp)
+		sim_log("EVENT", "%u %s", add, text);
+	else
+		sim_log("EVENT", "%u %s @%lu.%06lu", add, text, (unsigned long)core_user_seconds, (unsigned long)core_user_useconds * 32);
+}
+
+void core_func_update_user_timestamp(uint32_t seconds, uint16_t useconds)
+{
+	core_user_seconds = seconds;
+	core_user_useconds = useconds;
+}
+
+void core_func_read_user_timestamp(uint32_t *seconds, uint16_t *useconds)
+{
+	*seconds = core_user_seconds;
+	*useconds = core_user_useconds;
+}
+
+void core_func_mark_user_timestamp(void)
+{
+	core_user_seconds = core_func_read_R_TIMESTAMP_SECOND();
+	core_user_useconds = core_func_read_R_TIMESTAMP_MICRO();
+}
+
+uint32_t core_func_read_R_TIMESTAMP_SECOND(void)
+{
+	return sim_cycles / SIM_F_CPU;
+}
+
+// in units of 32 us, like the core's counter
+uint16_t core_func_read_R_TIMESTAMP_MICRO(void)
+{
+	return (sim_cycles % SIM_F_CPU) / (32 * SIM_CYCLES_PER_US);
+}
+
+void sim_busy_wait_us(uint32_t us)
+{
+	sim_cycles += (uint64_t)us * SIM_CYCLES_PER_US;
+}
+
+/************************************************************************/
+/* Probes                                                               */
+/************************************************************************/
+uint64_t sim_probe_now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+void sim_probe_add(SimProbe * probe, uint64_t start, uint64_t latency)
+{
+	uint64_t ns = sim_probe_now() - start;
+
+	if(probe->calls == 0)
+	{
+		if(sim_n_probes == sizeof(sim_probes) / sizeof(sim_probes[0]))
+			return;
+		sim_probes[sim_n_probes++] = probe;
+		probe->ns_min = ns;
+	}
+
+	probe->calls++;
+	probe->ns_total += ns;
+	if(ns < probe->ns_min)
+		probe->ns_min = ns;
+	if(ns > probe->ns_max)
+		probe->ns_max = ns;
+	if(latency > probe->latency_max)
+		probe->latency_max = latency;
+}
+
+/* Runs a callback of the core, timed when probing */
+static void core_run_callback(void (*callback)(void), SimProbe * probe)
+{
+	uint64_t start;
+
+	if(!sim_probing)
+	{
+		callback();
+		return;
+	}
+
+	start = sim_probe_now();
+	callback();
+	sim_probe_add(probe, start, 0);
+}
+
+/************************************************************************/
+/* Virtual clock                                                        */
+/************************************************************************/
+void sim_core_boot(void)
+{
+	sim_cycles = 0;
+	core_ticks = 0;
+	sim_hw_reset();
+
+	hwbp_app_initialize();
+
+	core_next_tick = sim_cycles + SIM_CORE_TICK_CYCLES;
+	core_next_second = (sim_cycles / SIM_F_CPU + 1) * SIM_F_CPU;
+}
+
+static SimProbe probe_before_exec = { "core_callback_t_before_exec" };
+static SimProbe probe_1ms = { "core_callback_t_1ms" };
+static SimProbe probe_500us = { "core_callback_t_500us" };
+static SimProbe probe_after_exec = { "core_callback_t_after_exec" };
+static SimProbe probe_new_second = { "core_callback_t_new_second" };
+// the whole tick, with the interrupts raised meanwhile
+static SimProbe probe_tick = { "tick" };
+
+/* One core tick, the 1 ms and 500 us callbacks alternate */
+static void core_tick(void)
+{
+	uint64_t start = sim_probing ? sim_probe_now() : 0;
+
+	core_run_callback(core_callback_t_before_exec, &probe_before_exec);
+	sim_hw_sync();
+
+	if(core_ticks++ & 1)
+		core_run_callback(core_callback_t_500us, &probe_500us);
+	else
+		core_run_callback(core_callback_t_1ms, &probe_1ms);
+	sim_hw_sync();
+
+	core_run_callback(core_callback_t_after_exec, &probe_after_exec);
+	sim_hw_sync();
+
+	if(sim_probing)
+		sim_probe_add(&probe_tick, start, 0);
+}
+
+void sim_run(uint64_t cycles)
+{
+	uint64_t end = sim_cycles + cycles;
+
+	while(sim_cycles < end)
+	{
+		sim_cycles += SIM_STEP_CYCLES;
+		sim_hw_step();
+
+		// the core's second counter (TCC1) overflows, the timestamp timer captures it through the event system
+		if(sim_cycles >= core_next_second)
+		{
+			core_next_second += SIM_F_CPU;
+			sim_hw_event(EVSYS_CHMUX_TCC1_OVF_gc);
+			sim_hw_sync();
+			core_run_callback(core_callback_t_new_second, &probe_new_second);
+			sim_hw_sync();
+		}
+
+		if(sim_cycles >= core_next_tick)
+		{
+			core_next_tick += SIM_CORE_TICK_CYCLES;
+			core_tick();
+		}
+	}
+}
+
+/************************************************************************/
+/* Register access                                                      */
+/************************************************************************/
+bool sim_register_info(uint8_t address, uint8_t * type, uint16_t * n_elements)
+{
+	if(address < APP_REGS_ADD_MIN || address > APP_REGS_ADD_MAX)
+		return false;
+
+	*type = app_regs_type[address - APP_REGS_ADD_MIN];
+	*n_elements = app_regs_n_elements[address - APP_REGS_ADD_MIN];
+	return true;
+}
+
+bool sim_write_register(uint8_t address, uint8_t * content, uint16_t n_elements)
+{
+	uint8_t type;
+	uint16_t elements;
+	char text[256];
+	bool ok;
+
+	if(!sim_register_info(address, &type, &elements))
+		return false;
+
+	sim_format_payload(text, sizeof(text), type, content, n_elements);
+	ok = core_write_app_register(address, type, content, n_elements);
+	sim_hw_sync();
+
+	sim_log("WRITE", "%u %s %s", address, text, ok ? "ok" : "error");
+	return ok;
+}
+
+bool sim_read_register(uint8_t address)
+{
+	uint8_t type;
+	uint16_t elements;
+	char text[256];
+	bool ok;
+
+	if(!sim_register_info(address, &type, &elements))
+		return false;
+
+	ok = core_read_app_register(address, type);
+	sim_hw_sync();
+
+	sim_format_payload(text, sizeof(text), type, app_regs_pointer[address - APP_REGS_ADD_MIN], elements);
+	sim_log("READ", "%u %s %s", address, text, ok ? "ok" : "error");
+	return ok;
+}
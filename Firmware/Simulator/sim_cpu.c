@@ -0,0 +1,55 @@
+/* Stand-ins for the cpu.h functions of the core library used by the firmware */
+#include "sim.h"
+#include "cpu.h"
+
+/************************************************************************/
+/* IO                                                                   */
+/************************************************************************/
+void io_pin2in(PORT_t* port, uint8_t pin, uint8_t pull, uint8_t sense)
+{
+	port->DIRCLR = 1 << pin;
+	(&port->PIN0CTRL)[pin] = pull | sense;
+}
+
+void io_pin2out(PORT_t* port, uint8_t pin, uint8_t out, bool input_en)
+{
+	port->DIRSET = 1 << pin;
+	(&port->PIN0CTRL)[pin] = out | (input_en ? PORT_ISC_BOTHEDGES_gc : PORT_ISC_INPUT_DISABLE_gc);
+}
+
+void io_set_int(PORT_t* port, uint8_t int_level, uint8_t int_n, uint8_t mask, bool reset_mask)
+{
+	if(int_n == 0)
+	{
+		port->INTCTRL = (port->INTCTRL & ~PORT_INT0LVL_gm) | int_level;
+		port->INT0MASK = reset_mask ? mask : (port->INT0MASK | mask);
+	}
+	else
+	{
+		port->INTCTRL = (port->INTCTRL & ~PORT_INT1LVL_gm) | (int_level << 2);
+		port->INT1MASK = reset_mask ? mask : (port->INT1MASK | mask);
+	}
+}
+
+/************************************************************************/
+/* Timer                                                                */
+/************************************************************************/
+void timer_type0_enable(TC0_t* timer, uint8_t prescaler, uint16_t target_count, uint8_t int_level)
+{
+	timer->CTRLA = TC_CLKSEL_OFF_gc;
+	timer->CTRLB = TC_WGMODE_NORMAL_gc;
+	timer->CNT = 0;
+	timer->PER = target_count;
+	timer->INTCTRLA = int_level;
+	sim_timer_clear_flags(timer);
+	timer->CTRLA = prescaler;
+}
+
+void timer_type0_stop(TC0_t* timer)
+{
+	timer->CTRLA = TC_CLKSEL_OFF_gc;
+	timer->INTCTRLA = INT_LEVEL_OFF;
+	timer->INTCTRLB = INT_LEVEL_OFF;
+	timer->CNT = 0;
+	sim_timer_clear_flags(timer);
+}
@@ -0,0 +1,656 @@
+/* Peripherals of the ATxmega128A4U used by the pump firmware: ports, timers, event system and DMA */
+#include <string.h>
+#include "sim.h"
+
+/************************************************************************/
+/* Register file                                                        */
+/************************************************************************/
+TC0_t TCC0, TCD0, TCE0;
+TC1_t TCC1, TCD1;
+EVSYS_t EVSYS;
+DMA_t DMA;
+PMIC_t PMIC;
+volatile uint8_t SREG;
+
+#define INT_LEVEL_HIGH 3
+
+/************************************************************************/
+/* Interrupt handlers                                                   */
+/************************************************************************/
+// interrupts.c overrides the ones used by the firmware
+#define SIM_VECTOR(vector) void vector##_handler(void) __attribute__((weak)); void vector##_handler(void) {}
+
+SIM_VECTOR(PORTA_INT0_vect)
+SIM_VECTOR(PORTB_INT0_vect)
+SIM_VECTOR(PORTC_INT0_vect)
+SIM_VECTOR(PORTD_INT0_vect)
+SIM_VECTOR(DMA_CH0_vect)
+SIM_VECTOR(DMA_CH1_vect)
+SIM_VECTOR(DMA_CH2_vect)
+SIM_VECTOR(DMA_CH3_vect)
+SIM_VECTOR(TCC0_OVF_vect)
+SIM_VECTOR(TCC0_CCA_vect)
+SIM_VECTOR(TCC0_CCB_vect)
+SIM_VECTOR(TCC0_CCC_vect)
+SIM_VECTOR(TCC0_CCD_vect)
+SIM_VECTOR(TCC1_OVF_vect)
+SIM_VECTOR(TCC1_CCA_vect)
+SIM_VECTOR(TCC1_CCB_vect)
+SIM_VECTOR(TCD0_OVF_vect)
+SIM_VECTOR(TCD0_CCA_vect)
+SIM_VECTOR(TCD0_CCB_vect)
+SIM_VECTOR(TCD0_CCC_vect)
+SIM_VECTOR(TCD0_CCD_vect)
+SIM_VECTOR(TCD1_OVF_vect)
+SIM_VECTOR(TCD1_CCA_vect)
+SIM_VECTOR(TCD1_CCB_vect)
+SIM_VECTOR(TCE0_OVF_vect)
+SIM_VECTOR(TCE0_CCA_vect)
+SIM_VECTOR(TCE0_CCB_vect)
+SIM_VECTOR(TCE0_CCC_vect)
+SIM_VECTOR(TCE0_CCD_vect)
+
+/************************************************************************/
+/* Ports                                                                */
+/************************************************************************/
+typedef struct
+{
+	PORT_t regs;
+	uint8_t out;
+	uint8_t dir;
+	uint8_t ext;        // levels driven from outside the device
+	uint8_t flags;      // interrupt flags, mirrored to INTFLAGS
+} SimPort;
+
+static SimPort sim_ports[SIM_N_PORTS];
+
+typedef struct
+{
+	const char * name;
+	uint8_t port;
+	uint8_t pin;
+	uint8_t idle;       // level driven from outside while nothing is pressed or connected
+} SimPin;
+
+// names of app_ios_and_regs.h, the inputs are the ones the scenarios can drive
+static const SimPin sim_pins[] = {
+	{ "STEP",         SIM_PORTA, 0, 0 },
+	{ "DIR",          SIM_PORTA, 1, 0 },
+	{ "MS1",          SIM_PORTA, 2, 0 },
+	{ "MS2",          SIM_PORTA, 3, 0 },
+	{ "MS3",          SIM_PORTA, 4, 0 },
+	{ "EN_DRIVER",    SIM_PORTA, 5, 0 },
+	{ "SLEEP",        SIM_PORTA, 6, 0 },
+	{ "RESET",        SIM_PORTA, 7, 0 },
+	{ "DI0",          SIM_PORTB, 0, 0 },
+	{ "OUT00",        SIM_PORTB, 1, 0 },
+	{ "OUT01",        SIM_PORTB, 2, 0 },
+	{ "BUF_EN",       SIM_PORTB, 3, 0 },
+	{ "TYPE0",        SIM_PORTC, 0, 0 },
+	{ "TYPE1",        SIM_PORTC, 1, 0 },
+	{ "SW_F",         SIM_PORTC, 4, 0 },
+	{ "SW_R",         SIM_PORTC, 5, 0 },
+	{ "EN_DRIVER_UC", SIM_PORTD, 0, 1 },
+	{ "BUT_PUSH",     SIM_PORTD, 5, 1 },
+	{ "BUT_PULL",     SIM_PORTD, 6, 1 },
+	{ "BUT_RESET",    SIM_PORTD, 7, 1 },
+};
+#define SIM_N_PINS (sizeof(sim_pins) / sizeof(sim_pins[0]))
+
+static void port_update_in(uint8_t index)
+{
+	SimPort * port = &sim_ports[index];
+	uint8_t in = (port->out & port->dir) | (port->ext & ~port->dir);
+	uint8_t changed = in ^ port->regs.IN;
+
+	port->regs.IN = in;
+
+	if(!changed)
+		return;
+
+	for(uint8_t i = 0; i < SIM_N_PINS; i++)
+		if(sim_pins[i].port == index && (changed & (1 << sim_pins[i].pin)))
+			sim_log("PIN", "%s %u", sim_pins[i].name, (in >> sim_pins[i].pin) & 1);
+}
+
+/* Applies the strobes (OUTSET, DIRCLR, ...) written since the last access */
+static void port_apply(uint8_t index)
+{
+	SimPort * port = &sim_ports[index];
+	PORT_t * regs = &port->regs;
+
+	// OUT and DIR hold what was applied last, so a different value was written directly
+	port->out = regs->OUT;
+	port->dir = regs->DIR;
+
+	port->out = ((port->out | regs->OUTSET) & ~regs->OUTCLR) ^ regs->OUTTGL;
+	port->dir = ((port->dir | regs->DIRSET) & ~regs->DIRCLR) ^ regs->DIRTGL;
+	regs->OUTSET = 0;
+	regs->OUTCLR = 0;
+	regs->OUTTGL = 0;
+	regs->DIRSET = 0;
+	regs->DIRCLR = 0;
+	regs->DIRTGL = 0;
+	regs->OUT = port->out;
+	regs->DIR = port->dir;
+	regs->INTFLAGS = port->flags;
+
+	port_update_in(index);
+}
+
+static void ports_apply(void)
+{
+	for(uint8_t i = 0; i < SIM_N_PORTS; i++)
+		port_apply(i);
+}
+
+void sim_hw_apply_ports(void)
+{
+	ports_apply();
+}
+
+PORT_t * sim_port_access(uint8_t index)
+{
+	ports_apply();
+	return &sim_ports[index].regs;
+}
+
+/* Raises the pin change interrupts and events of an input that changed level */
+static void port_pin_changed(uint8_t index, uint8_t pin, uint8_t level)
+{
+	SimPort * port = &sim_ports[index];
+	bool sensed;
+
+	switch((&port->regs.PIN0CTRL)[pin] & PORT_ISC_gm)
+	{
+		case PORT_ISC_BOTHEDGES_gc:
+			sensed = true;
+			break;
+		case PORT_ISC_RISING_gc:
+			sensed = level;
+			break;
+		case PORT_ISC_FALLING_gc:
+		case PORT_ISC_LEVEL_gc:
+			sensed = !level;
+			break;
+		default:
+			sensed = false;
+			break;
+	}
+
+	if(!sensed)
+		return;
+
+	if(port->regs.INT0MASK & (1 << pin))
+		port->flags |= PORT_INT0IF_bm;
+	if(port->regs.INT1MASK & (1 << pin))
+		port->flags |= PORT_INT1IF_bm;
+	port->regs.INTFLAGS = port->flags;
+
+	if(index <= SIM_PORTE)
+		sim_hw_event(EVSYS_CHMUX_PORTA_PIN0_gc + 8 * index + pin);
+}
+
+/************************************************************************/
+/* Timers                                                               */
+/************************************************************************/
+// TC1_t has the same layout as TC0_t up to CCB, so both are handled as TC0_t with fewer channels
+typedef struct
+{
+	TC0_t * regs;
+	uint8_t n_channels;
+	uint8_t flags;              // interrupt flags, mirrored to INTFLAGS with SIM_FLAGS_MARKER
+	uint8_t overflow_event;     // EVSYS_CHMUX_*_OVF_gc
+	uint8_t overflow_trigger;   // DMA_CH_TRIGSRC_*_OVF_gc
+} SimTimer;
+
+enum { SIM_TCC0, SIM_TCC1, SIM_TCD0, SIM_TCD1, SIM_TCE0, SIM_N_TIMERS };
+
+static SimTimer sim_timers[SIM_N_TIMERS] = {
+	{ &TCC0, 4, 0, EVSYS_CHMUX_TCC0_OVF_gc, DMA_CH_TRIGSRC_TCC0_OVF_gc },
+	{ (TC0_t *)&TCC1, 2, 0, EVSYS_CHMUX_TCC1_OVF_gc, DMA_CH_TRIGSRC_TCC1_OVF_gc },
+	{ &TCD0, 4, 0, EVSYS_CHMUX_TCD0_OVF_gc, DMA_CH_TRIGSRC_TCD0_OVF_gc },
+	{ (TC0_t *)&TCD1, 2, 0, EVSYS_CHMUX_TCD1_OVF_gc, DMA_CH_TRIGSRC_TCD1_OVF_gc },
+	{ &TCE0, 4, 0, EVSYS_CHMUX_TCE0_OVF_gc, DMA_CH_TRIGSRC_TCE0_OVF_gc },
+};
+
+static const uint16_t timer_divisions[] = { 0, 1, 2, 4, 8, 64, 256, 1024 };
+
+static void dma_trigger(uint8_t source);
+
+/* Takes the flags cleared by the firmware, a write of ones doesn't leave SIM_FLAGS_MARKER set */
+static void timer_apply(SimTimer * timer)
+{
+	uint16_t written = timer->regs->INTFLAGS;
+
+	if(!(written & SIM_FLAGS_MARKER))
+		timer->flags &= ~written;
+
+	timer->regs->INTFLAGS = SIM_FLAGS_MARKER | timer->flags;
+}
+
+static bool timer_captures(SimTimer * timer, uint8_t channel)
+{
+	return (timer->regs->CTRLD & TC_EVACT_gm) == TC_EVACT_CAPT_gc && (timer->regs->CTRLB & (TC0_CCAEN_bm << channel));
+}
+
+static void timer_tick(SimTimer * timer)
+{
+	TC0_t * regs = timer->regs;
+	volatile uint16_t * cc = &regs->CCA;
+	bool overflow = false;
+
+	if(regs->CNT == regs->PER)
+	{
+		regs->CNT = 0;
+		timer->flags |= TC0_OVFIF_bm;
+		overflow = true;
+	}
+	else
+		regs->CNT++;
+
+	for(uint8_t i = 0; i < timer->n_channels; i++)
+		if(regs->CNT == cc[i] && !timer_captures(timer, i))
+			timer->flags |= TC0_CCAIF_bm << i;
+
+	regs->INTFLAGS = SIM_FLAGS_MARKER | timer->flags;
+
+	if(overflow)
+	{
+		sim_hw_event(timer->overflow_event);
+		dma_trigger(timer->overflow_trigger);
+	}
+}
+
+static void timer_step(SimTimer * timer)
+{
+	uint8_t clksel = timer->regs->CTRLA & TC_CLKSEL_gm;
+	uint16_t division;
+
+	// the event channels as clock source aren't used by the firmware
+	if(clksel == TC_CLKSEL_OFF_gc || clksel > TC_CLKSEL_DIV1024_gc)
+		return;
+
+	division = timer_divisions[clksel];
+
+	// the prescaler runs free, so the timers at the same division tick together
+	if(division <= SIM_STEP_CYCLES)
+	{
+		for(uint8_t n = SIM_STEP_CYCLES / division; n; n--)
+			timer_tick(timer);
+	}
+	else if(sim_cycles % division == 0)
+		timer_tick(timer);
+}
+
+void sim_timer_clear_flags(volatile void * timer)
+{
+	for(uint8_t i = 0; i < SIM_N_TIMERS; i++)
+	{
+		if((volatile void *)sim_timers[i].regs == timer)
+		{
+			sim_timers[i].flags = 0;
+			sim_timers[i].regs->INTFLAGS = SIM_FLAGS_MARKER;
+		}
+	}
+}
+
+/************************************************************************/
+/* Event system                                                         */
+/************************************************************************/
+void sim_hw_event(uint8_t source)
+{
+	volatile uint8_t * mux = &EVSYS.CH0MUX;
+
+	for(uint8_t channel = 0; channel < 8; channel++)
+	{
+		if(source == EVSYS_CHMUX_OFF_gc || mux[channel] != source)
+			continue;
+
+		// a capture on event channel n goes to CCA, n + 1 to CCB and so on
+		for(uint8_t i = 0; i < SIM_N_TIMERS; i++)
+		{
+			SimTimer * timer = &sim_timers[i];
+			uint8_t evsel = timer->regs->CTRLD & TC_EVSEL_gm;
+			uint8_t cc;
+
+			if((timer->regs->CTRLD & TC_EVACT_gm) != TC_EVACT_CAPT_gc || evsel < TC_EVSEL_CH0_gc || channel < evsel - TC_EVSEL_CH0_gc)
+				continue;
+
+			cc = channel - (evsel - TC_EVSEL_CH0_gc);
+			if(cc >= timer->n_channels || !timer_captures(timer, cc))
+				continue;
+
+			(&timer->regs->CCA)[cc] = timer->regs->CNT;
+			timer->flags |= TC0_CCAIF_bm << cc;
+			timer->regs->INTFLAGS = SIM_FLAGS_MARKER | timer->flags;
+		}
+	}
+}
+
+/************************************************************************/
+/* DMA                                                                  */
+/************************************************************************/
+typedef struct
+{
+	DMA_CH_t * regs;
+	bool enabled;           // last state of ENABLE seen, a channel enabled by the firmware starts a new block
+	uint8_t ctrlb;          // last value of CTRLB written by the simulator
+	uint16_t source;        // offsets from the addresses of the channel
+	uint16_t destination;
+} SimDmaChannel;
+
+static SimDmaChannel sim_dma[4] = {
+	{ &DMA.CH0 }, { &DMA.CH1 }, { &DMA.CH2 }, { &DMA.CH3 },
+};
+
+// channels whose interrupt is pending, the firmware clears TRNIF itself
+static uint8_t dma_pending = 0;
+
+/* The firmware gives 16-bit addresses, like on the ATxmega, which are taken in the 64 KB around the statics */
+static volatile uint8_t * dma_address(uint8_t address0, uint8_t address1)
+{
+	uintptr_t base = (uintptr_t)&DMA;
+	uintptr_t address = (base & ~(uintptr_t)0xFFFF) | ((uint16_t)address1 << 8) | address0;
+
+	if(address > base + 0x8000)
+		address -= 0x10000;
+	else if(address + 0x8000 < base)
+		address += 0x10000;
+
+	return (volatile uint8_t *)address;
+}
+
+static void dma_write_ctrlb(SimDmaChannel * channel, uint8_t value)
+{
+	channel->ctrlb = value;
+	channel->regs->CTRLB = value;
+}
+
+static void dma_start_block(SimDmaChannel * channel)
+{
+	channel->enabled = true;
+	channel->source = 0;
+	channel->destination = 0;
+
+	// a read-modify-write that writes back a set flag can't be told from no write at all on the host,
+	// so the flags are also cleared when the channel starts a new block
+	dma_write_ctrlb(channel, channel->ctrlb & ~(DMA_CH_TRNIF_bm | DMA_CH_ERRIF_bm));
+}
+
+/* Takes the flags cleared and the channels enabled by the firmware */
+static void dma_apply(void)
+{
+	for(uint8_t i = 0; i < 4; i++)
+	{
+		SimDmaChannel * channel = &sim_dma[i];
+		uint8_t written = channel->regs->CTRLB;
+		uint8_t flags = DMA_CH_TRNIF_bm | DMA_CH_ERRIF_bm;
+
+		// writing a one clears a flag and writing a zero leaves it
+		if(written != channel->ctrlb)
+			dma_write_ctrlb(channel, (written & ~flags) | (channel->ctrlb & flags & ~written));
+
+		if(!(channel->regs->CTRLA & DMA_CH_ENABLE_bm))
+			channel->enabled = false;
+		else if(!channel->enabled)
+			dma_start_block(channel);
+	}
+}
+
+static void dma_end_block(uint8_t index)
+{
+	SimDmaChannel * channel = &sim_dma[index];
+	uint8_t mode = DMA.CTRL & DMA_DBUFMODE_gm;
+
+	channel->regs->CTRLA &= ~DMA_CH_ENABLE_bm;
+	channel->enabled = false;
+	dma_write_ctrlb(channel, channel->ctrlb | DMA_CH_TRNIF_bm);
+	dma_pending |= 1 << index;
+
+	// on double buffering the other channel of the pair goes on
+	if((index < 2 && (mode == DMA_DBUFMODE_CH01_gc || mode == DMA_DBUFMODE_CH01CH23_gc)) ||
+	   (index >= 2 && (mode == DMA_DBUFMODE_CH23_gc || mode == DMA_DBUFMODE_CH01CH23_gc)))
+	{
+		SimDmaChannel * other = &sim_dma[index ^ 1];
+
+		other->regs->CTRLA |= DMA_CH_ENABLE_bm;
+		dma_start_block(other);
+	}
+}
+
+/* Makes one burst on a channel in single shot mode */
+static void dma_burst(uint8_t index)
+{
+	SimDmaChannel * channel = &sim_dma[index];
+	DMA_CH_t * regs = channel->regs;
+	volatile uint8_t * source = dma_address(regs->SRCADDR0, regs->SRCADDR1);
+	volatile uint8_t * destination = dma_address(regs->DESTADDR0, regs->DESTADDR1);
+	uint8_t length = 1 << (regs->CTRLA & DMA_CH_BURSTLEN_gm);
+	uint8_t control = regs->ADDRCTRL;
+
+	for(uint8_t i = 0; i < length && regs->TRFCNT; i++)
+	{
+		destination[channel->destination] = source[channel->source];
+		if((control & DMA_CH_SRCDIR_gm) == DMA_CH_SRCDIR_INC_gc)
+			channel->source++;
+		if((control & DMA_CH_DESTDIR_gm) == DMA_CH_DESTDIR_INC_gc)
+			channel->destination++;
+		regs->TRFCNT--;
+	}
+
+	if((control & DMA_CH_SRCRELOAD_gm) == DMA_CH_SRCRELOAD_BURST_gc)
+		channel->source = 0;
+	if((control & DMA_CH_DESTRELOAD_gm) == DMA_CH_DESTRELOAD_BURST_gc)
+		channel->destination = 0;
+
+	// the written registers (e.g. OUTTGL) take effect right away
+	ports_apply();
+
+	if(regs->TRFCNT == 0)
+		dma_end_block(index);
+}
+
+static void dma_trigger(uint8_t source)
+{
+	if(!(DMA.CTRL & DMA_ENABLE_bm))
+		return;
+
+	// the channel enabled by a block end waits for the next trigger, like on the ATxmega
+	bool ready[4];
+	for(uint8_t i = 0; i < 4; i++)
+		ready[i] = sim_dma[i].enabled && sim_dma[i].regs->TRIGSRC == source;
+
+	// both priority modes serve the channels in order on a shared trigger
+	for(uint8_t i = 0; i < 4; i++)
+		if(ready[i])
+			dma_burst(i);
+}
+
+/************************************************************************/
+/* Interrupt controller                                                 */
+/************************************************************************/
+typedef struct
+{
+	uint8_t number;                 // position in the vector table, served first within a level
+	const char * name;
+	void (*handler)(void);
+	uint8_t * flags;                // cleared when the vector runs
+	uint8_t mask;
+	volatile uint8_t * control;     // register with the interrupt level
+	uint8_t shift;
+} SimVector;
+
+#define SIM_TIMER_VECTORS_0(n, timer, index) \
+	{ n,     #timer "_OVF_vect", timer##_OVF_vect_handler, &sim_timers[index].flags, TC0_OVFIF_bm, &timer.INTCTRLA, 0 }, \
+	{ n + 2, #timer "_CCA_vect", timer##_CCA_vect_handler, &sim_timers[index].flags, TC0_CCAIF_bm, &timer.INTCTRLB, 0 }, \
+	{ n + 3, #timer "_CCB_vect", timer##_CCB_vect_handler, &sim_timers[index].flags, TC0_CCBIF_bm, &timer.INTCTRLB, 2 }, \
+	{ n + 4, #timer "_CCC_vect", timer##_CCC_vect_handler, &sim_timers[index].flags, TC0_CCCIF_bm, &timer.INTCTRLB, 4 }, \
+	{ n + 5, #timer "_CCD_vect", timer##_CCD_vect_handler, &sim_timers[index].flags, TC0_CCDIF_bm, &timer.INTCTRLB, 6 }
+
+#define SIM_TIMER_VECTORS_1(n, timer, index) \
+	{ n,     #timer "_OVF_vect", timer##_OVF_vect_handler, &sim_timers[index].flags, TC1_OVFIF_bm, &timer.INTCTRLA, 0 }, \
+	{ n + 2, #timer "_CCA_vect", timer##_CCA_vect_handler, &sim_timers[index].flags, TC1_CCAIF_bm, &timer.INTCTRLB, 0 }, \
+	{ n + 3, #timer "_CCB_vect", timer##_CCB_vect_handler, &sim_timers[index].flags, TC1_CCBIF_bm, &timer.INTCTRLB, 2 }
+
+#define SIM_PORT_VECTOR(n, port, index) \
+	{ n, #port "_INT0_vect", port##_INT0_vect_handler, &sim_ports[index].flags, PORT_INT0IF_bm, &sim_ports[index].regs.INTCTRL, 0 }
+
+#define SIM_DMA_VECTOR(n, channel) \
+	{ n, "DMA_CH" #channel "_vect", DMA_CH##channel##_vect_handler, &dma_pending, 1 << channel, &DMA.CH##channel.CTRLB, 0 }
+
+// ATxmega128A4U vector numbers
+static const SimVector sim_vectors[] = {
+	SIM_PORT_VECTOR(2, PORTC, SIM_PORTC),
+	SIM_DMA_VECTOR(6, 0),
+	SIM_DMA_VECTOR(7, 1),
+	SIM_DMA_VECTOR(8, 2),
+	SIM_DMA_VECTOR(9, 3),
+	SIM_TIMER_VECTORS_0(14, TCC0, SIM_TCC0),
+	SIM_TIMER_VECTORS_1(20, TCC1, SIM_TCC1),
+	SIM_PORT_VECTOR(34, PORTB, SIM_PORTB),
+	SIM_TIMER_VECTORS_0(47, TCE0, SIM_TCE0),
+	SIM_PORT_VECTOR(64, PORTD, SIM_PORTD),
+	SIM_PORT_VECTOR(66, PORTA, SIM_PORTA),
+	SIM_TIMER_VECTORS_0(77, TCD0, SIM_TCD0),
+	SIM_TIMER_VECTORS_1(83, TCD1, SIM_TCD1),
+};
+#define SIM_N_VECTORS (sizeof(sim_vectors) / sizeof(sim_vectors[0]))
+
+static SimProbe sim_vector_probes[SIM_N_VECTORS];
+
+static void hw_apply(void)
+{
+	ports_apply();
+	for(uint8_t i = 0; i < SIM_N_TIMERS; i++)
+		timer_apply(&sim_timers[i]);
+	dma_apply();
+}
+
+/* Runs the pending interrupts, highest level first, each one to completion since nothing preempts on the host */
+static void hw_dispatch(void)
+{
+	bool served;
+	uint8_t pending = dma_pending;
+
+	// most steps raise nothing
+	for(uint8_t i = 0; i < SIM_N_TIMERS; i++)
+		pending |= sim_timers[i].flags;
+	for(uint8_t i = 0; i < SIM_N_PORTS; i++)
+		pending |= sim_ports[i].flags;
+	if(!pending)
+		return;
+
+	// the interrupts raised together wait for the ones served before them
+	uint64_t raised = 0;
+
+	do
+	{
+		served = false;
+
+		for(uint8_t level = INT_LEVEL_HIGH; level && !served; level--)
+		{
+			for(uint8_t i = 0; i < SIM_N_VECTORS && !served; i++)
+			{
+				const SimVector * vector = &sim_vectors[i];
+
+				if(!(*vector->flags & vector->mask) || ((*vector->control >> vector->shift) & 0x03) != level)
+					continue;
+
+				*vector->flags &= ~vector->mask;
+				for(uint8_t t = 0; t < SIM_N_TIMERS; t++)
+					sim_timers[t].regs->INTFLAGS = SIM_FLAGS_MARKER | sim_timers[t].flags;
+
+				if(sim_probing)
+				{
+					SimProbe * probe = &sim_vector_probes[i];
+					uint64_t start = sim_probe_now();
+
+					if(!raised)
+						raised = start;
+					probe->name = vector->name;
+					vector->handler();
+					sim_probe_add(probe, start, start - raised);
+				}
+				else
+					vector->handler();
+				hw_apply();
+				served = true;
+			}
+		}
+	} while(served);
+}
+
+/************************************************************************/
+/* Simulator interface                                                  */
+/************************************************************************/
+void sim_hw_reset(void)
+{
+	memset(sim_ports, 0, sizeof(sim_ports));
+	for(uint8_t i = 0; i < SIM_N_PINS; i++)
+		sim_ports[sim_pins[i].port].ext |= sim_pins[i].idle << sim_pins[i].pin;
+	for(uint8_t i = 0; i < SIM_N_PORTS; i++)
+		sim_ports[i].regs.IN = sim_ports[i].ext;
+
+	for(uint8_t i = 0; i < SIM_N_TIMERS; i++)
+	{
+		memset((void *)sim_timers[i].regs, 0, i == SIM_TCC1 || i == SIM_TCD1 ? sizeof(TC1_t) : sizeof(TC0_t));
+		sim_timers[i].regs->PER = 0xFFFF;
+		sim_timers[i].regs->INTFLAGS = SIM_FLAGS_MARKER;
+		sim_timers[i].flags = 0;
+	}
+
+	memset((void *)&EVSYS, 0, sizeof(EVSYS));
+	memset((void *)&DMA, 0, sizeof(DMA));
+	for(uint8_t i = 0; i < 4; i++)
+	{
+		sim_dma[i].enabled = false;
+		sim_dma[i].ctrlb = 0;
+	}
+	dma_pending = 0;
+}
+
+void sim_hw_step(void)
+{
+	for(uint8_t i = 0; i < SIM_N_TIMERS; i++)
+		timer_step(&sim_timers[i]);
+
+	hw_dispatch();
+}
+
+void sim_hw_sync(void)
+{
+	hw_apply();
+	hw_dispatch();
+}
+
+bool sim_pin_set(const char * name, uint8_t level)
+{
+	for(uint8_t i = 0; i < SIM_N_PINS; i++)
+	{
+		const SimPin * pin = &sim_pins[i];
+		SimPort * port = &sim_ports[pin->port];
+		uint8_t mask = 1 << pin->pin;
+		uint8_t before;
+
+		if(strcmp(pin->name, name))
+			continue;
+
+		hw_apply();
+		before = port->regs.IN & mask;
+
+		if(level)
+			port->ext |= mask;
+		else
+			port->ext &= ~mask;
+		port_update_in(pin->port);
+
+		if((port->regs.IN & mask) != before)
+			port_pin_changed(pin->port, pin->pin, level ? 1 : 0);
+
+		hw_dispatch();
+		return true;
+	}
+
+	return false;
+}
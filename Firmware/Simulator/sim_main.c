@@ -0,0 +1,33 @@
+/* Scenario runner of the pump simulator: reads commands from a file (or stdin) and logs the device's activity */
+#include "sim.h"
+
+int main(int argc, char ** argv)
+{
+	FILE * scenario = stdin;
+	const char * name = "stdin";
+
+	if(argc > 2)
+	{
+		fprintf(stderr, "usage: %s [scenario]\n", argv[0]);
+		return 2;
+	}
+
+	if(argc == 2)
+	{
+		name = argv[1];
+		scenario = fopen(argv[1], "r");
+		if(!scenario)
+		{
+			perror(argv[1]);
+			return 1;
+		}
+	}
+
+	sim_core_boot();
+	sim_scenario_run(scenario, name);
+
+	if(scenario != stdin)
+		fclose(scenario);
+
+	return 0;
+}
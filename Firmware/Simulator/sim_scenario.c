@@ -0,0 +1,179 @@
+/* Commands of the scenarios: run, write, read, pin and pulse */
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "hwbp_core_types.h"
+
+#define MAX_LINE 1024
+#define MAX_ELEMENTS 256
+
+static const char * scenario_name;
+static unsigned scenario_line;
+
+static void scenario_error(const char * message, const char * detail)
+{
+	fprintf(stderr, "%s:%u: %s%s%s\n", scenario_name, scenario_line, message, detail ? ": " : "", detail ? detail : "");
+	exit(1);
+}
+
+/* Parses an unsigned number, decimal or 0x hexadecimal */
+static uint64_t parse_unsigned(const char * token)
+{
+	char * end;
+	unsigned long long value;
+
+	if(!token)
+		scenario_error("missing argument", 0);
+
+	value = strtoull(token, &end, 0);
+	if(*end || token[0] == '-')
+		scenario_error("invalid number", token);
+
+	return value;
+}
+
+/* Parses the elements of a register from the remaining tokens, in the register's type */
+static uint16_t parse_payload(uint8_t type, uint8_t * payload, uint16_t max_elements)
+{
+	uint8_t length = type & MSK_TYPE_LEN;
+	uint16_t n = 0;
+	char * token;
+
+	while((token = strtok(0, " \t\r\n")))
+	{
+		char * end;
+
+		if(n == max_elements)
+			scenario_error("too many elements", token);
+
+		if(type & MSK_TYPE_FLOAT)
+		{
+			float value = strtof(token, &end);
+			memcpy(payload, &value, sizeof(value));
+		}
+		else if(type & MSK_TYPE_INTEGER)
+		{
+			long long value = strtoll(token, &end, 0);
+			memcpy(payload, &value, length);
+		}
+		else
+		{
+			unsigned long long value = strtoull(token, &end, 0);
+			memcpy(payload, &value, length);
+		}
+
+		if(*end)
+			scenario_error("invalid value", token);
+
+		payload += length;
+		n++;
+	}
+
+	return n;
+}
+
+/************************************************************************/
+/* Commands                                                             */
+/************************************************************************/
+// run <us>
+static void command_run(void)
+{
+	sim_run(parse_unsigned(strtok(0, " \t\r\n")) * SIM_CYCLES_PER_US);
+}
+
+// write <address> <values...>
+static void command_write(void)
+{
+	static uint8_t payload[MAX_ELEMENTS * 8];
+	uint8_t address = parse_unsigned(strtok(0, " \t\r\n"));
+	uint8_t type;
+	uint16_t n_elements;
+	uint16_t n;
+
+	if(!sim_register_info(address, &type, &n_elements))
+		scenario_error("unknown register", 0);
+
+	n = parse_payload(type, payload, MAX_ELEMENTS);
+	if(n != n_elements)
+		scenario_error("wrong number of elements", 0);
+
+	sim_write_register(address, payload, n);
+}
+
+// read <address>
+static void command_read(void)
+{
+	uint8_t address = parse_unsigned(strtok(0, " \t\r\n"));
+
+	if(!sim_read_register(address))
+		scenario_error("unknown register", 0);
+}
+
+// pin <name> <level>
+static void command_pin(void)
+{
+	char * name = strtok(0, " \t\r\n");
+	uint8_t level = parse_unsigned(strtok(0, " \t\r\n")) ? 1 : 0;
+
+	if(!name || !sim_pin_set(name, level))
+		scenario_error("unknown pin", name);
+}
+
+// pulse <name> <count> <high_us> <low_us>, the pin is left low
+static void command_pulse(void)
+{
+	char * name = strtok(0, " \t\r\n");
+	uint64_t count = parse_unsigned(strtok(0, " \t\r\n"));
+	uint64_t high = parse_unsigned(strtok(0, " \t\r\n"));
+	uint64_t low = parse_unsigned(strtok(0, " \t\r\n"));
+
+	if(!name)
+		scenario_error("missing pin", 0);
+
+	for(uint64_t i = 0; i < count; i++)
+	{
+		if(!sim_pin_set(name, 1))
+			scenario_error("unknown pin", name);
+		sim_run(high * SIM_CYCLES_PER_US);
+		sim_pin_set(name, 0);
+		sim_run(low * SIM_CYCLES_PER_US);
+	}
+}
+
+/************************************************************************/
+/* Scenario                                                             */
+/************************************************************************/
+void sim_scenario_run(FILE * file, const char * name)
+{
+	char line[MAX_LINE];
+
+	scenario_name = name;
+	scenario_line = 0;
+
+	while(fgets(line, sizeof(line), file))
+	{
+		char * command;
+
+		scenario_line++;
+
+		if(strchr(line, '#'))
+			*strchr(line, '#') = 0;
+
+		command = strtok(line, " \t\r\n");
+		if(!command)
+			continue;
+
+		if(!strcmp(command, "run"))
+			command_run();
+		else if(!strcmp(command, "write"))
+			command_write();
+		else if(!strcmp(command, "read"))
+			command_read();
+		else if(!strcmp(command, "pin"))
+			command_pin();
+		else if(!strcmp(command, "pulse"))
+			command_pulse();
+		else
+			scenario_error("unknown command", command);
+	}
+}
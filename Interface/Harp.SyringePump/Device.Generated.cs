@@ -60,7 +60,59 @@ namespace Harp.SyringePump
             { 52, typeof(EnableEvents) },
             { 53, typeof(BoardType) },
             { 54, typeof(Protocol) },
-            { 55, typeof(ProtocolDirection) }
+            { 55, typeof(ProtocolDirection) },
+            { 56, typeof(ProtocolPeriodMicroseconds) },
+            { 57, typeof(ProtocolAcceleration) },
+            { 58, typeof(ProtocolDeceleration) },
+            { 59, typeof(ProtocolAverageRate) },
+            { 60, typeof(ProtocolStepCount32) },
+            { 61, typeof(Position) },
+            { 62, typeof(ProtocolQueueSegment) },
+            { 63, typeof(ProtocolQueueCount) },
+            { 64, typeof(StreamRate) },
+            { 65, typeof(StreamPeriod) },
+            { 66, typeof(StreamUnderrunMode) },
+            { 67, typeof(StreamUnderrunCount) },
+            { 68, typeof(StepReportSteps) },
+            { 69, typeof(StepReportPeriod) },
+            { 70, typeof(StepDelta) },
+            { 71, typeof(DigitalInputEdgeTime) },
+            { 72, typeof(ScheduleCommand) },
+            { 73, typeof(ScheduleCount) },
+            { 74, typeof(ScheduleStatistics) },
+            { 75, typeof(MicrostepEffective) },
+            { 76, typeof(MicrostepAutoRate) },
+            { 77, typeof(EnableEventsExtended) },
+            { 78, typeof(Homing) },
+            { 79, typeof(HomingState) },
+            { 80, typeof(HomingFastPeriod) },
+            { 81, typeof(HomingSlowPeriod) },
+            { 82, typeof(HomingAcceleration) },
+            { 83, typeof(HomingBackoffSteps) },
+            { 84, typeof(HomingPosition) },
+            { 85, typeof(SwitchOverrunSteps) },
+            { 86, typeof(RefillMode) },
+            { 87, typeof(RefillEndPosition) },
+            { 88, typeof(RefillPeriod) },
+            { 89, typeof(RefillAcceleration) },
+            { 90, typeof(RefillValveDelay) },
+            { 91, typeof(RefillCycle) },
+            { 92, typeof(JogPeriod) },
+            { 93, typeof(JogAcceleration) },
+            { 94, typeof(JogMinPeriod) },
+            { 95, typeof(ProtocolNextPeriodMicroseconds) },
+            { 96, typeof(ProtocolNextNumberOfSteps) },
+            { 97, typeof(ProtocolNextDirection) },
+            { 98, typeof(ProtocolCommit) },
+            { 99, typeof(ProtocolConfiguration) },
+            { 100, typeof(ProtocolProgress) },
+            { 101, typeof(ProgressPeriod) },
+            { 102, typeof(ProgressPercent) },
+            { 103, typeof(Status) },
+            { 104, typeof(StepPlayback) },
+            { 105, typeof(CpuLoad) },
+            { 106, typeof(StepIntervals) },
+            { 107, typeof(StepJitter) }
         };
 
         /// <summary>
@@ -142,6 +194,58 @@ namespace Harp.SyringePump
     /// <seealso cref="EnableEvents"/>
     /// <seealso cref="Protocol"/>
     /// <seealso cref="ProtocolDirection"/>
+    /// <seealso cref="ProtocolPeriodMicroseconds"/>
+    /// <seealso cref="ProtocolAcceleration"/>
+    /// <seealso cref="ProtocolDeceleration"/>
+    /// <seealso cref="ProtocolAverageRate"/>
+    /// <seealso cref="ProtocolStepCount32"/>
+    /// <seealso cref="Position"/>
+    /// <seealso cref="ProtocolQueueSegment"/>
+    /// <seealso cref="ProtocolQueueCount"/>
+    /// <seealso cref="StreamRate"/>
+    /// <seealso cref="StreamPeriod"/>
+    /// <seealso cref="StreamUnderrunMode"/>
+    /// <seealso cref="StreamUnderrunCount"/>
+    /// <seealso cref="StepReportSteps"/>
+    /// <seealso cref="StepReportPeriod"/>
+    /// <seealso cref="StepDelta"/>
+    /// <seealso cref="DigitalInputEdgeTime"/>
+    /// <seealso cref="ScheduleCommand"/>
+    /// <seealso cref="ScheduleCount"/>
+    /// <seealso cref="ScheduleStatistics"/>
+    /// <seealso cref="MicrostepEffective"/>
+    /// <seealso cref="MicrostepAutoRate"/>
+    /// <seealso cref="EnableEventsExtended"/>
+    /// <seealso cref="Homing"/>
+    /// <seealso cref="HomingState"/>
+    /// <seealso cref="HomingFastPeriod"/>
+    /// <seealso cref="HomingSlowPeriod"/>
+    /// <seealso cref="HomingAcceleration"/>
+    /// <seealso cref="HomingBackoffSteps"/>
+    /// <seealso cref="HomingPosition"/>
+    /// <seealso cref="SwitchOverrunSteps"/>
+    /// <seealso cref="RefillMode"/>
+    /// <seealso cref="RefillEndPosition"/>
+    /// <seealso cref="RefillPeriod"/>
+    /// <seealso cref="RefillAcceleration"/>
+    /// <seealso cref="RefillValveDelay"/>
+    /// <seealso cref="RefillCycle"/>
+    /// <seealso cref="JogPeriod"/>
+    /// <seealso cref="JogAcceleration"/>
+    /// <seealso cref="JogMinPeriod"/>
+    /// <seealso cref="ProtocolNextPeriodMicroseconds"/>
+    /// <seealso cref="ProtocolNextNumberOfSteps"/>
+    /// <seealso cref="ProtocolNextDirection"/>
+    /// <seealso cref="ProtocolCommit"/>
+    /// <seealso cref="ProtocolConfiguration"/>
+    /// <seealso cref="ProtocolProgress"/>
+    /// <seealso cref="ProgressPeriod"/>
+    /// <seealso cref="ProgressPercent"/>
+    /// <seealso cref="Status"/>
+    /// <seealso cref="StepPlayback"/>
+    /// <seealso cref="CpuLoad"/>
+    /// <seealso cref="StepIntervals"/>
+    /// <seealso cref="StepJitter"/>
     [XmlInclude(typeof(EnableMotorDriver))]
     [XmlInclude(typeof(EnableProtocol))]
     [XmlInclude(typeof(Step))]
@@ -160,6 +264,58 @@ namespace Harp.SyringePump
     [XmlInclude(typeof(EnableEvents))]
     [XmlInclude(typeof(Protocol))]
     [XmlInclude(typeof(ProtocolDirection))]
+    [XmlInclude(typeof(ProtocolPeriodMicroseconds))]
+    [XmlInclude(typeof(ProtocolAcceleration))]
+    [XmlInclude(typeof(ProtocolDeceleration))]
+    [XmlInclude(typeof(ProtocolAverageRate))]
+    [XmlInclude(typeof(ProtocolStepCount32))]
+    [XmlInclude(typeof(Position))]
+    [XmlInclude(typeof(ProtocolQueueSegment))]
+    [XmlInclude(typeof(ProtocolQueueCount))]
+    [XmlInclude(typeof(StreamRate))]
+    [XmlInclude(typeof(StreamPeriod))]
+    [XmlInclude(typeof(StreamUnderrunMode))]
+    [XmlInclude(typeof(StreamUnderrunCount))]
+    [XmlInclude(typeof(StepReportSteps))]
+    [XmlInclude(typeof(StepReportPeriod))]
+    [XmlInclude(typeof(StepDelta))]
+    [XmlInclude(typeof(DigitalInputEdgeTime))]
+    [XmlInclude(typeof(ScheduleCommand))]
+    [XmlInclude(typeof(ScheduleCount))]
+    [XmlInclude(typeof(ScheduleStatistics))]
+    [XmlInclude(typeof(MicrostepEffective))]
+    [XmlInclude(typeof(MicrostepAutoRate))]
+    [XmlInclude(typeof(EnableEventsExtended))]
+    [XmlInclude(typeof(Homing))]
+    [XmlInclude(typeof(HomingState))]
+    [XmlInclude(typeof(HomingFastPeriod))]
+    [XmlInclude(typeof(HomingSlowPeriod))]
+    [XmlInclude(typeof(HomingAcceleration))]
+    [XmlInclude(typeof(HomingBackoffSteps))]
+    [XmlInclude(typeof(HomingPosition))]
+    [XmlInclude(typeof(SwitchOverrunSteps))]
+    [XmlInclude(typeof(RefillMode))]
+    [XmlInclude(typeof(RefillEndPosition))]
+    [XmlInclude(typeof(RefillPeriod))]
+    [XmlInclude(typeof(RefillAcceleration))]
+    [XmlInclude(typeof(RefillValveDelay))]
+    [XmlInclude(typeof(RefillCycle))]
+    [XmlInclude(typeof(JogPeriod))]
+    [XmlInclude(typeof(JogAcceleration))]
+    [XmlInclude(typeof(JogMinPeriod))]
+    [XmlInclude(typeof(ProtocolNextPeriodMicroseconds))]
+    [XmlInclude(typeof(ProtocolNextNumberOfSteps))]
+    [XmlInclude(typeof(ProtocolNextDirection))]
+    [XmlInclude(typeof(ProtocolCommit))]
+    [XmlInclude(typeof(ProtocolConfiguration))]
+    [XmlInclude(typeof(ProtocolProgress))]
+    [XmlInclude(typeof(ProgressPeriod))]
+    [XmlInclude(typeof(ProgressPercent))]
+    [XmlInclude(typeof(Status))]
+    [XmlInclude(typeof(StepPlayback))]
+    [XmlInclude(typeof(CpuLoad))]
+    [XmlInclude(typeof(StepIntervals))]
+    [XmlInclude(typeof(StepJitter))]
     [Description("Filters register-specific messages reported by the SyringePump device.")]
     public class FilterRegister : FilterRegisterBuilder, INamedElement
     {
@@ -199,6 +355,58 @@ namespace Harp.SyringePump
     /// <seealso cref="EnableEvents"/>
     /// <seealso cref="Protocol"/>
     /// <seealso cref="ProtocolDirection"/>
+    /// <seealso cref="ProtocolPeriodMicroseconds"/>
+    /// <seealso cref="ProtocolAcceleration"/>
+    /// <seealso cref="ProtocolDeceleration"/>
+    /// <seealso cref="ProtocolAverageRate"/>
+    /// <seealso cref="ProtocolStepCount32"/>
+    /// <seealso cref="Position"/>
+    /// <seealso cref="ProtocolQueueSegment"/>
+    /// <seealso cref="ProtocolQueueCount"/>
+    /// <seealso cref="StreamRate"/>
+    /// <seealso cref="StreamPeriod"/>
+    /// <seealso cref="StreamUnderrunMode"/>
+    /// <seealso cref="StreamUnderrunCount"/>
+    /// <seealso cref="StepReportSteps"/>
+    /// <seealso cref="StepReportPeriod"/>
+    /// <seealso cref="StepDelta"/>
+    /// <seealso cref="DigitalInputEdgeTime"/>
+    /// <seealso cref="ScheduleCommand"/>
+    /// <seealso cref="ScheduleCount"/>
+    /// <seealso cref="ScheduleStatistics"/>
+    /// <seealso cref="MicrostepEffective"/>
+    /// <seealso cref="MicrostepAutoRate"/>
+    /// <seealso cref="EnableEventsExtended"/>
+    /// <seealso cref="Homing"/>
+    /// <seealso cref="HomingState"/>
+    /// <seealso cref="HomingFastPeriod"/>
+    /// <seealso cref="HomingSlowPeriod"/>
+    /// <seealso cref="HomingAcceleration"/>
+    /// <seealso cref="HomingBackoffSteps"/>
+    /// <seealso cref="HomingPosition"/>
+    /// <seealso cref="SwitchOverrunSteps"/>
+    /// <seealso cref="RefillMode"/>
+    /// <seealso cref="RefillEndPosition"/>
+    /// <seealso cref="RefillPeriod"/>
+    /// <seealso cref="RefillAcceleration"/>
+    /// <seealso cref="RefillValveDelay"/>
+    /// <seealso cref="RefillCycle"/>
+    /// <seealso cref="JogPeriod"/>
+    /// <seealso cref="JogAcceleration"/>
+    /// <seealso cref="JogMinPeriod"/>
+    /// <seealso cref="ProtocolNextPeriodMicroseconds"/>
+    /// <seealso cref="ProtocolNextNumberOfSteps"/>
+    /// <seealso cref="ProtocolNextDirection"/>
+    /// <seealso cref="ProtocolCommit"/>
+    /// <seealso cref="ProtocolConfiguration"/>
+    /// <seealso cref="ProtocolProgress"/>
+    /// <seealso cref="ProgressPeriod"/>
+    /// <seealso cref="ProgressPercent"/>
+    /// <seealso cref="Status"/>
+    /// <seealso cref="StepPlayback"/>
+    /// <seealso cref="CpuLoad"/>
+    /// <seealso cref="StepIntervals"/>
+    /// <seealso cref="StepJitter"/>
     [XmlInclude(typeof(EnableMotorDriver))]
     [XmlInclude(typeof(EnableProtocol))]
     [XmlInclude(typeof(Step))]
@@ -217,6 +425,58 @@ namespace Harp.SyringePump
     [XmlInclude(typeof(EnableEvents))]
     [XmlInclude(typeof(Protocol))]
     [XmlInclude(typeof(ProtocolDirection))]
+    [XmlInclude(typeof(ProtocolPeriodMicroseconds))]
+    [XmlInclude(typeof(ProtocolAcceleration))]
+    [XmlInclude(typeof(ProtocolDeceleration))]
+    [XmlInclude(typeof(ProtocolAverageRate))]
+    [XmlInclude(typeof(ProtocolStepCount32))]
+    [XmlInclude(typeof(Position))]
+    [XmlInclude(typeof(ProtocolQueueSegment))]
+    [XmlInclude(typeof(ProtocolQueueCount))]
+    [XmlInclude(typeof(StreamRate))]
+    [XmlInclude(typeof(StreamPeriod))]
+    [XmlInclude(typeof(StreamUnderrunMode))]
+    [XmlInclude(typeof(StreamUnderrunCount))]
+    [XmlInclude(typeof(StepReportSteps))]
+    [XmlInclude(typeof(StepReportPeriod))]
+    [XmlInclude(typeof(StepDelta))]
+    [XmlInclude(typeof(DigitalInputEdgeTime))]
+    [XmlInclude(typeof(ScheduleCommand))]
+    [XmlInclude(typeof(ScheduleCount))]
+    [XmlInclude(typeof(ScheduleStatistics))]
+    [XmlInclude(typeof(MicrostepEffective))]
+    [XmlInclude(typeof(MicrostepAutoRate))]
+    [XmlInclude(typeof(EnableEventsExtended))]
+    [XmlInclude(typeof(Homing))]
+    [XmlInclude(typeof(HomingState))]
+    [XmlInclude(typeof(HomingFastPeriod))]
+    [XmlInclude(typeof(HomingSlowPeriod))]
+    [XmlInclude(typeof(HomingAcceleration))]
+    [XmlInclude(typeof(HomingBackoffSteps))]
+    [XmlInclude(typeof(HomingPosition))]
+    [XmlInclude(typeof(SwitchOverrunSteps))]
+    [XmlInclude(typeof(RefillMode))]
+    [XmlInclude(typeof(RefillEndPosition))]
+    [XmlInclude(typeof(RefillPeriod))]
+    [XmlInclude(typeof(RefillAcceleration))]
+    [XmlInclude(typeof(RefillValveDelay))]
+    [XmlInclude(typeof(RefillCycle))]
+    [XmlInclude(typeof(JogPeriod))]
+    [XmlInclude(typeof(JogAcceleration))]
+    [XmlInclude(typeof(JogMinPeriod))]
+    [XmlInclude(typeof(ProtocolNextPeriodMicroseconds))]
+    [XmlInclude(typeof(ProtocolNextNumberOfSteps))]
+    [XmlInclude(typeof(ProtocolNextDirection))]
+    [XmlInclude(typeof(ProtocolCommit))]
+    [XmlInclude(typeof(ProtocolConfiguration))]
+    [XmlInclude(typeof(ProtocolProgress))]
+    [XmlInclude(typeof(ProgressPeriod))]
+    [XmlInclude(typeof(ProgressPercent))]
+    [XmlInclude(typeof(Status))]
+    [XmlInclude(typeof(StepPlayback))]
+    [XmlInclude(typeof(CpuLoad))]
+    [XmlInclude(typeof(StepIntervals))]
+    [XmlInclude(typeof(StepJitter))]
     [XmlInclude(typeof(TimestampedEnableMotorDriver))]
     [XmlInclude(typeof(TimestampedEnableProtocol))]
     [XmlInclude(typeof(TimestampedStep))]
@@ -235,6 +495,58 @@ namespace Harp.SyringePump
     [XmlInclude(typeof(TimestampedEnableEvents))]
     [XmlInclude(typeof(TimestampedProtocol))]
     [XmlInclude(typeof(TimestampedProtocolDirection))]
+    [XmlInclude(typeof(TimestampedProtocolPeriodMicroseconds))]
+    [XmlInclude(typeof(TimestampedProtocolAcceleration))]
+    [XmlInclude(typeof(TimestampedProtocolDeceleration))]
+    [XmlInclude(typeof(TimestampedProtocolAverageRate))]
+    [XmlInclude(typeof(TimestampedProtocolStepCount32))]
+    [XmlInclude(typeof(TimestampedPosition))]
+    [XmlInclude(typeof(TimestampedProtocolQueueSegment))]
+    [XmlInclude(typeof(TimestampedProtocolQueueCount))]
+    [XmlInclude(typeof(TimestampedStreamRate))]
+    [XmlInclude(typeof(TimestampedStreamPeriod))]
+    [XmlInclude(typeof(TimestampedStreamUnderrunMode))]
+    [XmlInclude(typeof(TimestampedStreamUnderrunCount))]
+    [XmlInclude(typeof(TimestampedStepReportSteps))]
+    [XmlInclude(typeof(TimestampedStepReportPeriod))]
+    [XmlInclude(typeof(TimestampedStepDelta))]
+    [XmlInclude(typeof(TimestampedDigitalInputEdgeTime))]
+    [XmlInclude(typeof(TimestampedScheduleCommand))]
+    [XmlInclude(typeof(TimestampedScheduleCount))]
+    [XmlInclude(typeof(TimestampedScheduleStatistics))]
+    [XmlInclude(typeof(TimestampedMicrostepEffective))]
+    [XmlInclude(typeof(TimestampedMicrostepAutoRate))]
+    [XmlInclude(typeof(TimestampedEnableEventsExtended))]
+    [XmlInclude(typeof(TimestampedHoming))]
+    [XmlInclude(typeof(TimestampedHomingState))]
+    [XmlInclude(typeof(TimestampedHomingFastPeriod))]
+    [XmlInclude(typeof(TimestampedHomingSlowPeriod))]
+    [XmlInclude(typeof(TimestampedHomingAcceleration))]
+    [XmlInclude(typeof(TimestampedHomingBackoffSteps))]
+    [XmlInclude(typeof(TimestampedHomingPosition))]
+    [XmlInclude(typeof(TimestampedSwitchOverrunSteps))]
+    [XmlInclude(typeof(TimestampedRefillMode))]
+    [XmlInclude(typeof(TimestampedRefillEndPosition))]
+    [XmlInclude(typeof(TimestampedRefillPeriod))]
+    [XmlInclude(typeof(TimestampedRefillAcceleration))]
+    [XmlInclude(typeof(TimestampedRefillValveDelay))]
+    [XmlInclude(typeof(TimestampedRefillCycle))]
+    [XmlInclude(typeof(TimestampedJogPeriod))]
+    [XmlInclude(typeof(TimestampedJogAcceleration))]
+    [XmlInclude(typeof(TimestampedJogMinPeriod))]
+    [XmlInclude(typeof(TimestampedProtocolNextPeriodMicroseconds))]
+    [XmlInclude(typeof(TimestampedProtocolNextNumberOfSteps))]
+    [XmlInclude(typeof(TimestampedProtocolNextDirection))]
+    [XmlInclude(typeof(TimestampedProtocolCommit))]
+    [XmlInclude(typeof(TimestampedProtocolConfiguration))]
+    [XmlInclude(typeof(TimestampedProtocolProgress))]
+    [XmlInclude(typeof(TimestampedProgressPeriod))]
+    [XmlInclude(typeof(TimestampedProgressPercent))]
+    [XmlInclude(typeof(TimestampedStatus))]
+    [XmlInclude(typeof(TimestampedStepPlayback))]
+    [XmlInclude(typeof(TimestampedCpuLoad))]
+    [XmlInclude(typeof(TimestampedStepIntervals))]
+    [XmlInclude(typeof(TimestampedStepJitter))]
     [Description("Filters and selects specific messages reported by the SyringePump device.")]
     public partial class Parse : ParseBuilder, INamedElement
     {
@@ -271,6 +583,58 @@ namespace Harp.SyringePump
     /// <seealso cref="EnableEvents"/>
     /// <seealso cref="Protocol"/>
     /// <seealso cref="ProtocolDirection"/>
+    /// <seealso cref="ProtocolPeriodMicroseconds"/>
+    /// <seealso cref="ProtocolAcceleration"/>
+    /// <seealso cref="ProtocolDeceleration"/>
+    /// <seealso cref="ProtocolAverageRate"/>
+    /// <seealso cref="ProtocolStepCount32"/>
+    /// <seealso cref="Position"/>
+    /// <seealso cref="ProtocolQueueSegment"/>
+    /// <seealso cref="ProtocolQueueCount"/>
+    /// <seealso cref="StreamRate"/>
+    /// <seealso cref="StreamPeriod"/>
+    /// <seealso cref="StreamUnderrunMode"/>
+    /// <seealso cref="StreamUnderrunCount"/>
+    /// <seealso cref="StepReportSteps"/>
+    /// <seealso cref="StepReportPeriod"/>
+    /// <seealso cref="StepDelta"/>
+    /// <seealso cref="DigitalInputEdgeTime"/>
+    /// <seealso cref="ScheduleCommand"/>
+    /// <seealso cref="ScheduleCount"/>
+    /// <seealso cref="ScheduleStatistics"/>
+    /// <seealso cref="MicrostepEffective"/>
+    /// <seealso cref="MicrostepAutoRate"/>
+    /// <seealso cref="EnableEventsExtended"/>
+    /// <seealso cref="Homing"/>
+    /// <seealso cref="HomingState"/>
+    /// <seealso cref="HomingFastPeriod"/>
+    /// <seealso cref="HomingSlowPeriod"/>
+    /// <seealso cref="HomingAcceleration"/>
+    /// <seealso cref="HomingBackoffSteps"/>
+    /// <seealso cref="HomingPosition"/>
+    /// <seealso cref="SwitchOverrunSteps"/>
+    /// <seealso cref="RefillMode"/>
+    /// <seealso cref="RefillEndPosition"/>
+    /// <seealso cref="RefillPeriod"/>
+    /// <seealso cref="RefillAcceleration"/>
+    /// <seealso cref="RefillValveDelay"/>
+    /// <seealso cref="RefillCycle"/>
+    /// <seealso cref="JogPeriod"/>
+    /// <seealso cref="JogAcceleration"/>
+    /// <seealso cref="JogMinPeriod"/>
+    /// <seealso cref="ProtocolNextPeriodMicroseconds"/>
+    /// <seealso cref="ProtocolNextNumberOfSteps"/>
+    /// <seealso cref="ProtocolNextDirection"/>
+    /// <seealso cref="ProtocolCommit"/>
+    /// <seealso cref="ProtocolConfiguration"/>
+    /// <seealso cref="ProtocolProgress"/>
+    /// <seealso cref="ProgressPeriod"/>
+    /// <seealso cref="ProgressPercent"/>
+    /// <seealso cref="Status"/>
+    /// <seealso cref="StepPlayback"/>
+    /// <seealso cref="CpuLoad"/>
+    /// <seealso cref="StepIntervals"/>
+    /// <seealso cref="StepJitter"/>
     [XmlInclude(typeof(EnableMotorDriver))]
     [XmlInclude(typeof(EnableProtocol))]
     [XmlInclude(typeof(Step))]
@@ -289,6 +653,58 @@ namespace Harp.SyringePump
     [XmlInclude(typeof(EnableEvents))]
     [XmlInclude(typeof(Protocol))]
     [XmlInclude(typeof(ProtocolDirection))]
+    [XmlInclude(typeof(ProtocolPeriodMicroseconds))]
+    [XmlInclude(typeof(ProtocolAcceleration))]
+    [XmlInclude(typeof(ProtocolDeceleration))]
+    [XmlInclude(typeof(ProtocolAverageRate))]
+    [XmlInclude(typeof(ProtocolStepCount32))]
+    [XmlInclude(typeof(Position))]
+    [XmlInclude(typeof(ProtocolQueueSegment))]
+    [XmlInclude(typeof(ProtocolQueueCount))]
+    [XmlInclude(typeof(StreamRate))]
+    [XmlInclude(typeof(StreamPeriod))]
+    [XmlInclude(typeof(StreamUnderrunMode))]
+    [XmlInclude(typeof(StreamUnderrunCount))]
+    [XmlInclude(typeof(StepReportSteps))]
+    [XmlInclude(typeof(StepReportPeriod))]
+    [XmlInclude(typeof(StepDelta))]
+    [XmlInclude(typeof(DigitalInputEdgeTime))]
+    [XmlInclude(typeof(ScheduleCommand))]
+    [XmlInclude(typeof(ScheduleCount))]
+    [XmlInclude(typeof(ScheduleStatistics))]
+    [XmlInclude(typeof(MicrostepEffective))]
+    [XmlInclude(typeof(MicrostepAutoRate))]
+    [XmlInclude(typeof(EnableEventsExtended))]
+    [XmlInclude(typeof(Homing))]
+    [XmlInclude(typeof(HomingState))]
+    [XmlInclude(typeof(HomingFastPeriod))]
+    [XmlInclude(typeof(HomingSlowPeriod))]
+    [XmlInclude(typeof(HomingAcceleration))]
+    [XmlInclude(typeof(HomingBackoffSteps))]
+    [XmlInclude(typeof(HomingPosition))]
+    [XmlInclude(typeof(SwitchOverrunSteps))]
+    [XmlInclude(typeof(RefillMode))]
+    [XmlInclude(typeof(RefillEndPosition))]
+    [XmlInclude(typeof(RefillPeriod))]
+    [XmlInclude(typeof(RefillAcceleration))]
+    [XmlInclude(typeof(RefillValveDelay))]
+    [XmlInclude(typeof(RefillCycle))]
+    [XmlInclude(typeof(JogPeriod))]
+    [XmlInclude(typeof(JogAcceleration))]
+    [XmlInclude(typeof(JogMinPeriod))]
+    [XmlInclude(typeof(ProtocolNextPeriodMicroseconds))]
+    [XmlInclude(typeof(ProtocolNextNumberOfSteps))]
+    [XmlInclude(typeof(ProtocolNextDirection))]
+    [XmlInclude(typeof(ProtocolCommit))]
+    [XmlInclude(typeof(ProtocolConfiguration))]
+    [XmlInclude(typeof(ProtocolProgress))]
+    [XmlInclude(typeof(ProgressPeriod))]
+    [XmlInclude(typeof(ProgressPercent))]
+    [XmlInclude(typeof(Status))]
+    [XmlInclude(typeof(StepPlayback))]
+    [XmlInclude(typeof(CpuLoad))]
+    [XmlInclude(typeof(StepIntervals))]
+    [XmlInclude(typeof(StepJitter))]
     [Description("Formats a sequence of values as specific SyringePump register messages.")]
     public partial class Format : FormatBuilder, INamedElement
     {
@@ -1823,9 +2239,9 @@ namespace Harp.SyringePump
     }
 
     /// <summary>
-    /// Represents a register that sets the offset value of the calibration curve.
+    /// Represents a register that sets the offset value, in ul, of the calibration curve (volume = slope * steps + offset).
     /// </summary>
-    [Description("Sets the offset value of the calibration curve.")]
+    [Description("Sets the offset value, in ul, of the calibration curve (volume = slope * steps + offset).")]
     internal partial class CalibrationOffset
     {
         /// <summary>
@@ -1845,9 +2261,9 @@ namespace Harp.SyringePump
     }
 
     /// <summary>
-    /// Represents a register that sets the slope value of the calibration curve.
+    /// Represents a register that sets the slope value, in ul/step, of the calibration curve.
     /// </summary>
-    [Description("Sets the slope value of the calibration curve.")]
+    [Description("Sets the slope value, in ul/step, of the calibration curve.")]
     internal partial class CalibrationSlope
     {
         /// <summary>
@@ -2179,1051 +2595,10329 @@ namespace Harp.SyringePump
         }
     }
 
+    /// <summary>
+    /// Represents a register that sets the period, in microseconds, of each step in the protocol.
+    /// </summary>
+    [Description("Sets the period, in microseconds, of each step in the protocol.")]
+    public partial class ProtocolPeriodMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolPeriodMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 56;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProtocolPeriodMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProtocolPeriodMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProtocolPeriodMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProtocolPeriodMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProtocolPeriodMicroseconds"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolPeriodMicroseconds"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProtocolPeriodMicroseconds"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolPeriodMicroseconds"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProtocolPeriodMicroseconds register.
+    /// </summary>
+    /// <seealso cref="ProtocolPeriodMicroseconds"/>
+    [Description("Filters and selects timestamped messages from the ProtocolPeriodMicroseconds register.")]
+    public partial class TimestampedProtocolPeriodMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolPeriodMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProtocolPeriodMicroseconds.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProtocolPeriodMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return ProtocolPeriodMicroseconds.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the acceleration, in steps/s^2, used to ramp up to the protocol speed. A value of zero disables the ramp.
+    /// </summary>
+    [Description("Sets the acceleration, in steps/s^2, used to ramp up to the protocol speed. A value of zero disables the ramp.")]
+    public partial class ProtocolAcceleration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 57;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProtocolAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProtocolAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProtocolAcceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProtocolAcceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProtocolAcceleration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolAcceleration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProtocolAcceleration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolAcceleration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProtocolAcceleration register.
+    /// </summary>
+    /// <seealso cref="ProtocolAcceleration"/>
+    [Description("Filters and selects timestamped messages from the ProtocolAcceleration register.")]
+    public partial class TimestampedProtocolAcceleration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProtocolAcceleration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProtocolAcceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return ProtocolAcceleration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the deceleration, in steps/s^2, used to ramp down at the end of the protocol. A value of zero disables the ramp.
+    /// </summary>
+    [Description("Sets the deceleration, in steps/s^2, used to ramp down at the end of the protocol. A value of zero disables the ramp.")]
+    public partial class ProtocolDeceleration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolDeceleration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 58;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProtocolDeceleration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProtocolDeceleration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProtocolDeceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProtocolDeceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProtocolDeceleration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolDeceleration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProtocolDeceleration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolDeceleration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProtocolDeceleration register.
+    /// </summary>
+    /// <seealso cref="ProtocolDeceleration"/>
+    [Description("Filters and selects timestamped messages from the ProtocolDeceleration register.")]
+    public partial class TimestampedProtocolDeceleration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolDeceleration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProtocolDeceleration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProtocolDeceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return ProtocolDeceleration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the average step rate, in steps/s, achieved since the start of the current or last protocol.
+    /// </summary>
+    [Description("Reports the average step rate, in steps/s, achieved since the start of the current or last protocol.")]
+    public partial class ProtocolAverageRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolAverageRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 59;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProtocolAverageRate"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProtocolAverageRate"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProtocolAverageRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadSingle();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProtocolAverageRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadSingle();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProtocolAverageRate"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolAverageRate"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProtocolAverageRate"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolAverageRate"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProtocolAverageRate register.
+    /// </summary>
+    /// <seealso cref="ProtocolAverageRate"/>
+    [Description("Filters and selects timestamped messages from the ProtocolAverageRate register.")]
+    public partial class TimestampedProtocolAverageRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolAverageRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProtocolAverageRate.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProtocolAverageRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float> GetPayload(HarpMessage message)
+        {
+            return ProtocolAverageRate.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the number of steps to be executed in the current protocol, extended to 32 bits.
+    /// </summary>
+    [Description("Sets the number of steps to be executed in the current protocol, extended to 32 bits.")]
+    public partial class ProtocolStepCount32
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolStepCount32"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 60;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProtocolStepCount32"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProtocolStepCount32"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProtocolStepCount32"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProtocolStepCount32"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProtocolStepCount32"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolStepCount32"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProtocolStepCount32"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolStepCount32"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProtocolStepCount32 register.
+    /// </summary>
+    /// <seealso cref="ProtocolStepCount32"/>
+    [Description("Filters and selects timestamped messages from the ProtocolStepCount32 register.")]
+    public partial class TimestampedProtocolStepCount32
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolStepCount32"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProtocolStepCount32.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProtocolStepCount32"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return ProtocolStepCount32.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that contains the absolute position of the motor, in steps of the current step mode. Writing redefines the current position.
+    /// </summary>
+    [Description("Contains the absolute position of the motor, in steps of the current step mode. Writing redefines the current position.")]
+    public partial class Position
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Position"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 61;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Position"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Position"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Position"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static int GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Position"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Position"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Position"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Position"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Position"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Position register.
+    /// </summary>
+    /// <seealso cref="Position"/>
+    [Description("Filters and selects timestamped messages from the Position register.")]
+    public partial class TimestampedPosition
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Position"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Position.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Position"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetPayload(HarpMessage message)
+        {
+            return Position.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that appends a segment to the protocol queue. Segments can be appended while the queue is running.
+    /// </summary>
+    [Description("Appends a segment to the protocol queue. Segments can be appended while the queue is running.")]
+    public partial class ProtocolQueueSegment
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolQueueSegment"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 62;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProtocolQueueSegment"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProtocolQueueSegment"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static ProtocolQueueSegmentPayload ParsePayload(uint[] payload)
+        {
+            ProtocolQueueSegmentPayload result;
+            result.StepCount = payload[0];
+            result.Period = payload[1];
+            result.Direction = (ProtocolDirectionState)payload[2];
+            result.Dwell = payload[3];
+            return result;
+        }
+
+        static uint[] FormatPayload(ProtocolQueueSegmentPayload value)
+        {
+            uint[] result;
+            result = new uint[4];
+            result[0] = value.StepCount;
+            result[1] = value.Period;
+            result[2] = (uint)value.Direction;
+            result[3] = value.Dwell;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProtocolQueueSegment"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ProtocolQueueSegmentPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<uint>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProtocolQueueSegment"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ProtocolQueueSegmentPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<uint>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProtocolQueueSegment"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolQueueSegment"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ProtocolQueueSegmentPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProtocolQueueSegment"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolQueueSegment"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ProtocolQueueSegmentPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProtocolQueueSegment register.
+    /// </summary>
+    /// <seealso cref="ProtocolQueueSegment"/>
+    [Description("Filters and selects timestamped messages from the ProtocolQueueSegment register.")]
+    public partial class TimestampedProtocolQueueSegment
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolQueueSegment"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProtocolQueueSegment.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProtocolQueueSegment"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ProtocolQueueSegmentPayload> GetPayload(HarpMessage message)
+        {
+            return ProtocolQueueSegment.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that contains the number of segments in the protocol queue, including the one running. An event is sent when each segment completes. Writing 0 clears the queue.
+    /// </summary>
+    [Description("Contains the number of segments in the protocol queue, including the one running. An event is sent when each segment completes. Writing 0 clears the queue.")]
+    public partial class ProtocolQueueCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolQueueCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 63;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProtocolQueueCount"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProtocolQueueCount"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProtocolQueueCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProtocolQueueCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProtocolQueueCount"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolQueueCount"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProtocolQueueCount"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolQueueCount"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProtocolQueueCount register.
+    /// </summary>
+    /// <seealso cref="ProtocolQueueCount"/>
+    [Description("Filters and selects timestamped messages from the ProtocolQueueCount register.")]
+    public partial class TimestampedProtocolQueueCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolQueueCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProtocolQueueCount.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProtocolQueueCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return ProtocolQueueCount.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that appends a rate setpoint, in steps/s, to the streaming FIFO. Negative rates move in the reverse direction, up to 10000 steps/s.
+    /// </summary>
+    [Description("Appends a rate setpoint, in steps/s, to the streaming FIFO. Negative rates move in the reverse direction, up to 10000 steps/s.")]
+    public partial class StreamRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StreamRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 64;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StreamRate"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StreamRate"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StreamRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadSingle();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StreamRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadSingle();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StreamRate"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StreamRate"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StreamRate"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StreamRate"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StreamRate register.
+    /// </summary>
+    /// <seealso cref="StreamRate"/>
+    [Description("Filters and selects timestamped messages from the StreamRate register.")]
+    public partial class TimestampedStreamRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StreamRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StreamRate.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StreamRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float> GetPayload(HarpMessage message)
+        {
+            return StreamRate.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the period, in ms, at which the streaming mode takes the next setpoint from the FIFO.
+    /// </summary>
+    [Description("Sets the period, in ms, at which the streaming mode takes the next setpoint from the FIFO.")]
+    public partial class StreamPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StreamPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 65;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StreamPeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StreamPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StreamPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StreamPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StreamPeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StreamPeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StreamPeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StreamPeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StreamPeriod register.
+    /// </summary>
+    /// <seealso cref="StreamPeriod"/>
+    [Description("Filters and selects timestamped messages from the StreamPeriod register.")]
+    public partial class TimestampedStreamPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StreamPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StreamPeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StreamPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return StreamPeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the behavior of the streaming mode when a period elapses with the FIFO empty.
+    /// </summary>
+    [Description("Sets the behavior of the streaming mode when a period elapses with the FIFO empty.")]
+    public partial class StreamUnderrunMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StreamUnderrunMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 66;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StreamUnderrunMode"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StreamUnderrunMode"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StreamUnderrunMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static StreamUnderrunMode GetPayload(HarpMessage message)
+        {
+            return (StreamUnderrunMode)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StreamUnderrunMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StreamUnderrunMode> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((StreamUnderrunMode)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StreamUnderrunMode"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StreamUnderrunMode"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, StreamUnderrunMode value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StreamUnderrunMode"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StreamUnderrunMode"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, StreamUnderrunMode value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StreamUnderrunMode register.
+    /// </summary>
+    /// <seealso cref="StreamUnderrunMode"/>
+    [Description("Filters and selects timestamped messages from the StreamUnderrunMode register.")]
+    public partial class TimestampedStreamUnderrunMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StreamUnderrunMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StreamUnderrunMode.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StreamUnderrunMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StreamUnderrunMode> GetPayload(HarpMessage message)
+        {
+            return StreamUnderrunMode.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the number of FIFO underruns since the streaming mode started.
+    /// </summary>
+    [Description("Reports the number of FIFO underruns since the streaming mode started.")]
+    public partial class StreamUnderrunCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StreamUnderrunCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 67;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StreamUnderrunCount"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StreamUnderrunCount"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StreamUnderrunCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StreamUnderrunCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StreamUnderrunCount"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StreamUnderrunCount"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StreamUnderrunCount"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StreamUnderrunCount"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StreamUnderrunCount register.
+    /// </summary>
+    /// <seealso cref="StreamUnderrunCount"/>
+    [Description("Filters and selects timestamped messages from the StreamUnderrunCount register.")]
+    public partial class TimestampedStreamUnderrunCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StreamUnderrunCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StreamUnderrunCount.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StreamUnderrunCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return StreamUnderrunCount.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the number of steps after which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.
+    /// </summary>
+    [Description("Sets the number of steps after which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.")]
+    public partial class StepReportSteps
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StepReportSteps"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 68;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StepReportSteps"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StepReportSteps"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StepReportSteps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StepReportSteps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StepReportSteps"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StepReportSteps"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StepReportSteps"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StepReportSteps"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StepReportSteps register.
+    /// </summary>
+    /// <seealso cref="StepReportSteps"/>
+    [Description("Filters and selects timestamped messages from the StepReportSteps register.")]
+    public partial class TimestampedStepReportSteps
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StepReportSteps"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StepReportSteps.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StepReportSteps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return StepReportSteps.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the period, in ms, at which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.
+    /// </summary>
+    [Description("Sets the period, in ms, at which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.")]
+    public partial class StepReportPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StepReportPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 69;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StepReportPeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StepReportPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StepReportPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StepReportPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StepReportPeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StepReportPeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StepReportPeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StepReportPeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StepReportPeriod register.
+    /// </summary>
+    /// <seealso cref="StepReportPeriod"/>
+    [Description("Filters and selects timestamped messages from the StepReportPeriod register.")]
+    public partial class TimestampedStepReportPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StepReportPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StepReportPeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StepReportPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return StepReportPeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the net number of steps made since the last report, negative in the reverse direction. Replaces the Step events while StepReportSteps or StepReportPeriod is not zero.
+    /// </summary>
+    [Description("Reports the net number of steps made since the last report, negative in the reverse direction. Replaces the Step events while StepReportSteps or StepReportPeriod is not zero.")]
+    public partial class StepDelta
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StepDelta"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 70;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StepDelta"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StepDelta"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StepDelta"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static int GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StepDelta"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StepDelta"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StepDelta"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StepDelta"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StepDelta"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StepDelta register.
+    /// </summary>
+    /// <seealso cref="StepDelta"/>
+    [Description("Filters and selects timestamped messages from the StepDelta register.")]
+    public partial class TimestampedStepDelta
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StepDelta"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StepDelta.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StepDelta"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetPayload(HarpMessage message)
+        {
+            return StepDelta.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that capture time and level of the last digital input edge while it is configured as a sync input, with microsecond resolution. Sent after the DigitalInputState event of each edge if the InputEdge extended event is enabled.
+    /// </summary>
+    [Description("Capture time and level of the last digital input edge while it is configured as a sync input, with microsecond resolution. Sent after the DigitalInputState event of each edge if the InputEdge extended event is enabled.")]
+    public partial class DigitalInputEdgeTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputEdgeTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 71;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DigitalInputEdgeTime"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DigitalInputEdgeTime"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        static DigitalInputEdgeTimePayload ParsePayload(uint[] payload)
+        {
+            DigitalInputEdgeTimePayload result;
+            result.Seconds = payload[0];
+            result.Microseconds = payload[1];
+            result.State = payload[2];
+            return result;
+        }
+
+        static uint[] FormatPayload(DigitalInputEdgeTimePayload value)
+        {
+            uint[] result;
+            result = new uint[3];
+            result[0] = value.Seconds;
+            result[1] = value.Microseconds;
+            result[2] = value.State;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DigitalInputEdgeTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalInputEdgeTimePayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<uint>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DigitalInputEdgeTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputEdgeTimePayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<uint>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DigitalInputEdgeTime"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputEdgeTime"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalInputEdgeTimePayload value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DigitalInputEdgeTime"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputEdgeTime"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalInputEdgeTimePayload value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DigitalInputEdgeTime register.
+    /// </summary>
+    /// <seealso cref="DigitalInputEdgeTime"/>
+    [Description("Filters and selects timestamped messages from the DigitalInputEdgeTime register.")]
+    public partial class TimestampedDigitalInputEdgeTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputEdgeTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DigitalInputEdgeTime.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DigitalInputEdgeTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputEdgeTimePayload> GetPayload(HarpMessage message)
+        {
+            return DigitalInputEdgeTime.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that schedules a write of a single value register at a Harp time. Commands already due are fired right away.
+    /// </summary>
+    [Description("Schedules a write of a single value register at a Harp time. Commands already due are fired right away.")]
+    public partial class ScheduleCommand
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ScheduleCommand"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 72;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ScheduleCommand"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ScheduleCommand"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static ScheduleCommandPayload ParsePayload(uint[] payload)
+        {
+            ScheduleCommandPayload result;
+            result.Seconds = payload[0];
+            result.Microseconds = payload[1];
+            result.Address = payload[2];
+            result.Value = payload[3];
+            return result;
+        }
+
+        static uint[] FormatPayload(ScheduleCommandPayload value)
+        {
+            uint[] result;
+            result = new uint[4];
+            result[0] = value.Seconds;
+            result[1] = value.Microseconds;
+            result[2] = value.Address;
+            result[3] = value.Value;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ScheduleCommand"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ScheduleCommandPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<uint>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ScheduleCommand"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ScheduleCommandPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<uint>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ScheduleCommand"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ScheduleCommand"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ScheduleCommandPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ScheduleCommand"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ScheduleCommand"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ScheduleCommandPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ScheduleCommand register.
+    /// </summary>
+    /// <seealso cref="ScheduleCommand"/>
+    [Description("Filters and selects timestamped messages from the ScheduleCommand register.")]
+    public partial class TimestampedScheduleCommand
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ScheduleCommand"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ScheduleCommand.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ScheduleCommand"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ScheduleCommandPayload> GetPayload(HarpMessage message)
+        {
+            return ScheduleCommand.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of scheduled commands waiting to be fired. Writing zero clears them. Sent when a command fires if the Schedule extended event is enabled.
+    /// </summary>
+    [Description("Number of scheduled commands waiting to be fired. Writing zero clears them. Sent when a command fires if the Schedule extended event is enabled.")]
+    public partial class ScheduleCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ScheduleCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 73;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ScheduleCount"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ScheduleCount"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ScheduleCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ScheduleCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ScheduleCount"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ScheduleCount"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ScheduleCount"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ScheduleCount"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ScheduleCount register.
+    /// </summary>
+    /// <seealso cref="ScheduleCount"/>
+    [Description("Filters and selects timestamped messages from the ScheduleCount register.")]
+    public partial class TimestampedScheduleCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ScheduleCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ScheduleCount.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ScheduleCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return ScheduleCount.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that lateness of the scheduled commands. Any write resets the statistics.
+    /// </summary>
+    [Description("Lateness of the scheduled commands. Any write resets the statistics.")]
+    public partial class ScheduleStatistics
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ScheduleStatistics"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 74;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ScheduleStatistics"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ScheduleStatistics"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static ScheduleStatisticsPayload ParsePayload(uint[] payload)
+        {
+            ScheduleStatisticsPayload result;
+            result.LateCount = payload[0];
+            result.MaxLateness = payload[1];
+            result.LastLateness = payload[2];
+            result.RefusedCount = payload[3];
+            return result;
+        }
+
+        static uint[] FormatPayload(ScheduleStatisticsPayload value)
+        {
+            uint[] result;
+            result = new uint[4];
+            result[0] = value.LateCount;
+            result[1] = value.MaxLateness;
+            result[2] = value.LastLateness;
+            result[3] = value.RefusedCount;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ScheduleStatistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ScheduleStatisticsPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<uint>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ScheduleStatistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ScheduleStatisticsPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<uint>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ScheduleStatistics"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ScheduleStatistics"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ScheduleStatisticsPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ScheduleStatistics"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ScheduleStatistics"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ScheduleStatisticsPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ScheduleStatistics register.
+    /// </summary>
+    /// <seealso cref="ScheduleStatistics"/>
+    [Description("Filters and selects timestamped messages from the ScheduleStatistics register.")]
+    public partial class TimestampedScheduleStatistics
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ScheduleStatistics"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ScheduleStatistics.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ScheduleStatistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ScheduleStatisticsPayload> GetPayload(HarpMessage message)
+        {
+            return ScheduleStatistics.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that microstep mode used by the motor driver. Changes with the step rate while StepMode is Auto.
+    /// </summary>
+    [Description("Microstep mode used by the motor driver. Changes with the step rate while StepMode is Auto.")]
+    public partial class MicrostepEffective
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MicrostepEffective"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 75;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="MicrostepEffective"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="MicrostepEffective"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="MicrostepEffective"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static StepModeType GetPayload(HarpMessage message)
+        {
+            return (StepModeType)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="MicrostepEffective"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StepModeType> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((StepModeType)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="MicrostepEffective"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MicrostepEffective"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, StepModeType value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="MicrostepEffective"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MicrostepEffective"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, StepModeType value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// MicrostepEffective register.
+    /// </summary>
+    /// <seealso cref="MicrostepEffective"/>
+    [Description("Filters and selects timestamped messages from the MicrostepEffective register.")]
+    public partial class TimestampedMicrostepEffective
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MicrostepEffective"/> register. This field is constant.
+        /// </summary>
+        public const int Address = MicrostepEffective.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="MicrostepEffective"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StepModeType> GetPayload(HarpMessage message)
+        {
+            return MicrostepEffective.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sTEP rate, in steps per second, above which the automatic microstep mode switches to a coarser mode. It goes back to a finer mode once the rate drops below three quarters of this value.
+    /// </summary>
+    [Description("STEP rate, in steps per second, above which the automatic microstep mode switches to a coarser mode. It goes back to a finer mode once the rate drops below three quarters of this value.")]
+    public partial class MicrostepAutoRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MicrostepAutoRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 76;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="MicrostepAutoRate"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="MicrostepAutoRate"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="MicrostepAutoRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="MicrostepAutoRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="MicrostepAutoRate"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MicrostepAutoRate"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="MicrostepAutoRate"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MicrostepAutoRate"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// MicrostepAutoRate register.
+    /// </summary>
+    /// <seealso cref="MicrostepAutoRate"/>
+    [Description("Filters and selects timestamped messages from the MicrostepAutoRate register.")]
+    public partial class TimestampedMicrostepAutoRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MicrostepAutoRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = MicrostepAutoRate.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="MicrostepAutoRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return MicrostepAutoRate.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the active events that don't fit in EnableEvents.
+    /// </summary>
+    [Description("Specifies the active events that don't fit in EnableEvents.")]
+    public partial class EnableEventsExtended
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EnableEventsExtended"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 77;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EnableEventsExtended"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EnableEventsExtended"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EnableEventsExtended"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PumpEventsExtended GetPayload(HarpMessage message)
+        {
+            return (PumpEventsExtended)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EnableEventsExtended"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PumpEventsExtended> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((PumpEventsExtended)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EnableEventsExtended"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EnableEventsExtended"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PumpEventsExtended value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EnableEventsExtended"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EnableEventsExtended"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PumpEventsExtended value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EnableEventsExtended register.
+    /// </summary>
+    /// <seealso cref="EnableEventsExtended"/>
+    [Description("Filters and selects timestamped messages from the EnableEventsExtended register.")]
+    public partial class TimestampedEnableEventsExtended
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EnableEventsExtended"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EnableEventsExtended.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EnableEventsExtended"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PumpEventsExtended> GetPayload(HarpMessage message)
+        {
+            return EnableEventsExtended.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that starts the homing routine towards the given limit switch. It approaches the switch fast, backs off and approaches it again slowly, then sets the position.
+    /// </summary>
+    [Description("Starts the homing routine towards the given limit switch. It approaches the switch fast, backs off and approaches it again slowly, then sets the position.")]
+    public partial class Homing
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Homing"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 78;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Homing"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Homing"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Homing"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static HomingCommand GetPayload(HarpMessage message)
+        {
+            return (HomingCommand)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Homing"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<HomingCommand> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((HomingCommand)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Homing"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Homing"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, HomingCommand value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Homing"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Homing"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, HomingCommand value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Homing register.
+    /// </summary>
+    /// <seealso cref="Homing"/>
+    [Description("Filters and selects timestamped messages from the Homing register.")]
+    public partial class TimestampedHoming
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Homing"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Homing.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Homing"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<HomingCommand> GetPayload(HarpMessage message)
+        {
+            return Homing.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that phase of the homing routine. Reports Done or Failed when the routine ends.
+    /// </summary>
+    [Description("Phase of the homing routine. Reports Done or Failed when the routine ends.")]
+    public partial class HomingState
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="HomingState"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 79;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="HomingState"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="HomingState"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="HomingState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static HomingStateType GetPayload(HarpMessage message)
+        {
+            return (HomingStateType)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="HomingState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<HomingStateType> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((HomingStateType)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="HomingState"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="HomingState"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, HomingStateType value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="HomingState"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="HomingState"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, HomingStateType value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// HomingState register.
+    /// </summary>
+    /// <seealso cref="HomingState"/>
+    [Description("Filters and selects timestamped messages from the HomingState register.")]
+    public partial class TimestampedHomingState
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="HomingState"/> register. This field is constant.
+        /// </summary>
+        public const int Address = HomingState.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="HomingState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<HomingStateType> GetPayload(HarpMessage message)
+        {
+            return HomingState.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that step period, in microseconds, of the approach and of the back-off.
+    /// </summary>
+    [Description("Step period, in microseconds, of the approach and of the back-off.")]
+    public partial class HomingFastPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="HomingFastPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 80;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="HomingFastPeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="HomingFastPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="HomingFastPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="HomingFastPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="HomingFastPeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="HomingFastPeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="HomingFastPeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="HomingFastPeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// HomingFastPeriod register.
+    /// </summary>
+    /// <seealso cref="HomingFastPeriod"/>
+    [Description("Filters and selects timestamped messages from the HomingFastPeriod register.")]
+    public partial class TimestampedHomingFastPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="HomingFastPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = HomingFastPeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="HomingFastPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return HomingFastPeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that step period, in microseconds, of the slow re-approach.
+    /// </summary>
+    [Description("Step period, in microseconds, of the slow re-approach.")]
+    public partial class HomingSlowPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="HomingSlowPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 81;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="HomingSlowPeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="HomingSlowPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="HomingSlowPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="HomingSlowPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="HomingSlowPeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="HomingSlowPeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="HomingSlowPeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="HomingSlowPeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// HomingSlowPeriod register.
+    /// </summary>
+    /// <seealso cref="HomingSlowPeriod"/>
+    [Description("Filters and selects timestamped messages from the HomingSlowPeriod register.")]
+    public partial class TimestampedHomingSlowPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="HomingSlowPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = HomingSlowPeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="HomingSlowPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return HomingSlowPeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that acceleration and deceleration, in steps per second squared, of the approach and of the back-off. Zero disables the ramps.
+    /// </summary>
+    [Description("Acceleration and deceleration, in steps per second squared, of the approach and of the back-off. Zero disables the ramps.")]
+    public partial class HomingAcceleration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="HomingAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 82;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="HomingAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="HomingAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="HomingAcceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="HomingAcceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="HomingAcceleration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="HomingAcceleration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="HomingAcceleration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="HomingAcceleration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// HomingAcceleration register.
+    /// </summary>
+    /// <seealso cref="HomingAcceleration"/>
+    [Description("Filters and selects timestamped messages from the HomingAcceleration register.")]
+    public partial class TimestampedHomingAcceleration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="HomingAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = HomingAcceleration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="HomingAcceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return HomingAcceleration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of steps moved away from the switch before the slow re-approach.
+    /// </summary>
+    [Description("Number of steps moved away from the switch before the slow re-approach.")]
+    public partial class HomingBackoffSteps
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="HomingBackoffSteps"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 83;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="HomingBackoffSteps"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="HomingBackoffSteps"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="HomingBackoffSteps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="HomingBackoffSteps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="HomingBackoffSteps"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="HomingBackoffSteps"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="HomingBackoffSteps"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="HomingBackoffSteps"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// HomingBackoffSteps register.
+    /// </summary>
+    /// <seealso cref="HomingBackoffSteps"/>
+    [Description("Filters and selects timestamped messages from the HomingBackoffSteps register.")]
+    public partial class TimestampedHomingBackoffSteps
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="HomingBackoffSteps"/> register. This field is constant.
+        /// </summary>
+        public const int Address = HomingBackoffSteps.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="HomingBackoffSteps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return HomingBackoffSteps.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that value of the Position register when the switch is reached on the re-approach.
+    /// </summary>
+    [Description("Value of the Position register when the switch is reached on the re-approach.")]
+    public partial class HomingPosition
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="HomingPosition"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 84;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="HomingPosition"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="HomingPosition"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="HomingPosition"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static int GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="HomingPosition"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="HomingPosition"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="HomingPosition"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="HomingPosition"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="HomingPosition"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// HomingPosition register.
+    /// </summary>
+    /// <seealso cref="HomingPosition"/>
+    [Description("Filters and selects timestamped messages from the HomingPosition register.")]
+    public partial class TimestampedHomingPosition
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="HomingPosition"/> register. This field is constant.
+        /// </summary>
+        public const int Address = HomingPosition.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="HomingPosition"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetPayload(HarpMessage message)
+        {
+            return HomingPosition.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of steps requested towards a limit switch after it was pressed. These steps are not made. Any write resets the counter.
+    /// </summary>
+    [Description("Number of steps requested towards a limit switch after it was pressed. These steps are not made. Any write resets the counter.")]
+    public partial class SwitchOverrunSteps
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SwitchOverrunSteps"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 85;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SwitchOverrunSteps"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SwitchOverrunSteps"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SwitchOverrunSteps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SwitchOverrunSteps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SwitchOverrunSteps"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SwitchOverrunSteps"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SwitchOverrunSteps"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SwitchOverrunSteps"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SwitchOverrunSteps register.
+    /// </summary>
+    /// <seealso cref="SwitchOverrunSteps"/>
+    [Description("Filters and selects timestamped messages from the SwitchOverrunSteps register.")]
+    public partial class TimestampedSwitchOverrunSteps
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SwitchOverrunSteps"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SwitchOverrunSteps.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SwitchOverrunSteps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return SwitchOverrunSteps.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that end of travel of the step and volume protocols that starts a refill of the syringe instead of stopping. The refill switches the valve on digital output 0 (DO0Sync set to Valve), withdraws what was delivered on the cycle, switches the valve back and resumes the infusion at the same rate.
+    /// </summary>
+    [Description("End of travel of the step and volume protocols that starts a refill of the syringe instead of stopping. The refill switches the valve on digital output 0 (DO0Sync set to Valve), withdraws what was delivered on the cycle, switches the valve back and resumes the infusion at the same rate.")]
+    public partial class RefillMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RefillMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 86;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="RefillMode"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="RefillMode"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="RefillMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static RefillModeType GetPayload(HarpMessage message)
+        {
+            return (RefillModeType)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="RefillMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<RefillModeType> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((RefillModeType)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="RefillMode"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RefillMode"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, RefillModeType value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="RefillMode"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RefillMode"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, RefillModeType value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// RefillMode register.
+    /// </summary>
+    /// <seealso cref="RefillMode"/>
+    [Description("Filters and selects timestamped messages from the RefillMode register.")]
+    public partial class TimestampedRefillMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RefillMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = RefillMode.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="RefillMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<RefillModeType> GetPayload(HarpMessage message)
+        {
+            return RefillMode.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that position where the infusion ends when RefillMode is Position.
+    /// </summary>
+    [Description("Position where the infusion ends when RefillMode is Position.")]
+    public partial class RefillEndPosition
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RefillEndPosition"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 87;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="RefillEndPosition"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="RefillEndPosition"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="RefillEndPosition"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static int GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="RefillEndPosition"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="RefillEndPosition"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RefillEndPosition"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="RefillEndPosition"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RefillEndPosition"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, int value)
+        {
+            return HarpMessage.FromInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// RefillEndPosition register.
+    /// </summary>
+    /// <seealso cref="RefillEndPosition"/>
+    [Description("Filters and selects timestamped messages from the RefillEndPosition register.")]
+    public partial class TimestampedRefillEndPosition
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RefillEndPosition"/> register. This field is constant.
+        /// </summary>
+        public const int Address = RefillEndPosition.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="RefillEndPosition"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int> GetPayload(HarpMessage message)
+        {
+            return RefillEndPosition.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that step period, in microseconds, of the refill.
+    /// </summary>
+    [Description("Step period, in microseconds, of the refill.")]
+    public partial class RefillPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RefillPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 88;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="RefillPeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="RefillPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="RefillPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="RefillPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="RefillPeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RefillPeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="RefillPeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RefillPeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// RefillPeriod register.
+    /// </summary>
+    /// <seealso cref="RefillPeriod"/>
+    [Description("Filters and selects timestamped messages from the RefillPeriod register.")]
+    public partial class TimestampedRefillPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RefillPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = RefillPeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="RefillPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return RefillPeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that acceleration and deceleration, in steps per second squared, of the refill. Zero disables the ramps.
+    /// </summary>
+    [Description("Acceleration and deceleration, in steps per second squared, of the refill. Zero disables the ramps.")]
+    public partial class RefillAcceleration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RefillAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 89;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="RefillAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="RefillAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="RefillAcceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="RefillAcceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="RefillAcceleration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RefillAcceleration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="RefillAcceleration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RefillAcceleration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// RefillAcceleration register.
+    /// </summary>
+    /// <seealso cref="RefillAcceleration"/>
+    [Description("Filters and selects timestamped messages from the RefillAcceleration register.")]
+    public partial class TimestampedRefillAcceleration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RefillAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = RefillAcceleration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="RefillAcceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return RefillAcceleration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time, in milliseconds, for the valve to settle after each switch.
+    /// </summary>
+    [Description("Time, in milliseconds, for the valve to settle after each switch.")]
+    public partial class RefillValveDelay
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RefillValveDelay"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 90;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="RefillValveDelay"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="RefillValveDelay"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="RefillValveDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="RefillValveDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="RefillValveDelay"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RefillValveDelay"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="RefillValveDelay"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RefillValveDelay"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// RefillValveDelay register.
+    /// </summary>
+    /// <seealso cref="RefillValveDelay"/>
+    [Description("Filters and selects timestamped messages from the RefillValveDelay register.")]
+    public partial class TimestampedRefillValveDelay
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RefillValveDelay"/> register. This field is constant.
+        /// </summary>
+        public const int Address = RefillValveDelay.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="RefillValveDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return RefillValveDelay.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reported when the infusion resumes after a refill.
+    /// </summary>
+    [Description("Reported when the infusion resumes after a refill.")]
+    public partial class RefillCycle
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RefillCycle"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 91;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="RefillCycle"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="RefillCycle"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        static RefillCyclePayload ParsePayload(float[] payload)
+        {
+            RefillCyclePayload result;
+            result.Volume = payload[0];
+            result.DeadTime = payload[1];
+            return result;
+        }
+
+        static float[] FormatPayload(RefillCyclePayload value)
+        {
+            float[] result;
+            result = new float[2];
+            result[0] = value.Volume;
+            result[1] = value.DeadTime;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="RefillCycle"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static RefillCyclePayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<float>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="RefillCycle"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<RefillCyclePayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<float>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="RefillCycle"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RefillCycle"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, RefillCyclePayload value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="RefillCycle"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RefillCycle"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, RefillCyclePayload value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// RefillCycle register.
+    /// </summary>
+    /// <seealso cref="RefillCycle"/>
+    [Description("Filters and selects timestamped messages from the RefillCycle register.")]
+    public partial class TimestampedRefillCycle
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RefillCycle"/> register. This field is constant.
+        /// </summary>
+        public const int Address = RefillCycle.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="RefillCycle"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<RefillCyclePayload> GetPayload(HarpMessage message)
+        {
+            return RefillCycle.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that step period, in microseconds, when a long press of the push or pull button starts to jog the motor.
+    /// </summary>
+    [Description("Step period, in microseconds, when a long press of the push or pull button starts to jog the motor.")]
+    public partial class JogPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="JogPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 92;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="JogPeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="JogPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="JogPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="JogPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="JogPeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="JogPeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="JogPeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="JogPeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// JogPeriod register.
+    /// </summary>
+    /// <seealso cref="JogPeriod"/>
+    [Description("Filters and selects timestamped messages from the JogPeriod register.")]
+    public partial class TimestampedJogPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="JogPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = JogPeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="JogPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return JogPeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that acceleration, in steps per second squared, of the jog while the button is held. Zero keeps the jog at JogPeriod.
+    /// </summary>
+    [Description("Acceleration, in steps per second squared, of the jog while the button is held. Zero keeps the jog at JogPeriod.")]
+    public partial class JogAcceleration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="JogAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 93;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="JogAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="JogAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="JogAcceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="JogAcceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="JogAcceleration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="JogAcceleration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="JogAcceleration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="JogAcceleration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// JogAcceleration register.
+    /// </summary>
+    /// <seealso cref="JogAcceleration"/>
+    [Description("Filters and selects timestamped messages from the JogAcceleration register.")]
+    public partial class TimestampedJogAcceleration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="JogAcceleration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = JogAcceleration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="JogAcceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return JogAcceleration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that step period, in microseconds, the jog accelerates to while the button is held.
+    /// </summary>
+    [Description("Step period, in microseconds, the jog accelerates to while the button is held.")]
+    public partial class JogMinPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="JogMinPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 94;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="JogMinPeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="JogMinPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="JogMinPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="JogMinPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="JogMinPeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="JogMinPeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="JogMinPeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="JogMinPeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// JogMinPeriod register.
+    /// </summary>
+    /// <seealso cref="JogMinPeriod"/>
+    [Description("Filters and selects timestamped messages from the JogMinPeriod register.")]
+    public partial class TimestampedJogMinPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="JogMinPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = JogMinPeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="JogMinPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return JogMinPeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that step period, in microseconds, applied to the running protocol when committed with the Period bit of ProtocolCommit.
+    /// </summary>
+    [Description("Step period, in microseconds, applied to the running protocol when committed with the Period bit of ProtocolCommit.")]
+    public partial class ProtocolNextPeriodMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolNextPeriodMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 95;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProtocolNextPeriodMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProtocolNextPeriodMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProtocolNextPeriodMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProtocolNextPeriodMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProtocolNextPeriodMicroseconds"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolNextPeriodMicroseconds"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProtocolNextPeriodMicroseconds"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolNextPeriodMicroseconds"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProtocolNextPeriodMicroseconds register.
+    /// </summary>
+    /// <seealso cref="ProtocolNextPeriodMicroseconds"/>
+    [Description("Filters and selects timestamped messages from the ProtocolNextPeriodMicroseconds register.")]
+    public partial class TimestampedProtocolNextPeriodMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolNextPeriodMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProtocolNextPeriodMicroseconds.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProtocolNextPeriodMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return ProtocolNextPeriodMicroseconds.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that steps still to make by the running protocol, counted from the step where the commit is applied, when committed with the Steps bit of ProtocolCommit.
+    /// </summary>
+    [Description("Steps still to make by the running protocol, counted from the step where the commit is applied, when committed with the Steps bit of ProtocolCommit.")]
+    public partial class ProtocolNextNumberOfSteps
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolNextNumberOfSteps"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 96;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProtocolNextNumberOfSteps"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProtocolNextNumberOfSteps"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProtocolNextNumberOfSteps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProtocolNextNumberOfSteps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProtocolNextNumberOfSteps"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolNextNumberOfSteps"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProtocolNextNumberOfSteps"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolNextNumberOfSteps"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProtocolNextNumberOfSteps register.
+    /// </summary>
+    /// <seealso cref="ProtocolNextNumberOfSteps"/>
+    [Description("Filters and selects timestamped messages from the ProtocolNextNumberOfSteps register.")]
+    public partial class TimestampedProtocolNextNumberOfSteps
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolNextNumberOfSteps"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProtocolNextNumberOfSteps.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProtocolNextNumberOfSteps"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return ProtocolNextNumberOfSteps.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that direction applied to the running protocol when committed with the Direction bit of ProtocolCommit. A reversal decelerates to a stop first.
+    /// </summary>
+    [Description("Direction applied to the running protocol when committed with the Direction bit of ProtocolCommit. A reversal decelerates to a stop first.")]
+    public partial class ProtocolNextDirection
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolNextDirection"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 97;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProtocolNextDirection"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProtocolNextDirection"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProtocolNextDirection"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ProtocolDirectionState GetPayload(HarpMessage message)
+        {
+            return (ProtocolDirectionState)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProtocolNextDirection"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ProtocolDirectionState> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((ProtocolDirectionState)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProtocolNextDirection"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolNextDirection"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ProtocolDirectionState value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProtocolNextDirection"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolNextDirection"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ProtocolDirectionState value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProtocolNextDirection register.
+    /// </summary>
+    /// <seealso cref="ProtocolNextDirection"/>
+    [Description("Filters and selects timestamped messages from the ProtocolNextDirection register.")]
+    public partial class TimestampedProtocolNextDirection
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolNextDirection"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProtocolNextDirection.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProtocolNextDirection"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ProtocolDirectionState> GetPayload(HarpMessage message)
+        {
+            return ProtocolNextDirection.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that applies the selected ProtocolNext registers to the running step or volume protocol on its next step, ramping from the current rate with the protocol acceleration and deceleration. Reads the fields still to apply and sends an event once they were applied. Writing zero cancels a pending commit.
+    /// </summary>
+    [Description("Applies the selected ProtocolNext registers to the running step or volume protocol on its next step, ramping from the current rate with the protocol acceleration and deceleration. Reads the fields still to apply and sends an event once they were applied. Writing zero cancels a pending commit.")]
+    public partial class ProtocolCommit
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolCommit"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 98;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProtocolCommit"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProtocolCommit"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProtocolCommit"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ProtocolCommitFields GetPayload(HarpMessage message)
+        {
+            return (ProtocolCommitFields)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProtocolCommit"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ProtocolCommitFields> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((ProtocolCommitFields)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProtocolCommit"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolCommit"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ProtocolCommitFields value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProtocolCommit"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolCommit"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ProtocolCommitFields value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProtocolCommit register.
+    /// </summary>
+    /// <seealso cref="ProtocolCommit"/>
+    [Description("Filters and selects timestamped messages from the ProtocolCommit register.")]
+    public partial class TimestampedProtocolCommit
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolCommit"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProtocolCommit.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProtocolCommit"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ProtocolCommitFields> GetPayload(HarpMessage message)
+        {
+            return ProtocolCommit.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the protocol and IO configuration written in a single message. All the values are checked before any is applied, and the write is refused while a protocol runs. Volumes and flowrates are fixed-point.
+    /// </summary>
+    [Description("The protocol and IO configuration written in a single message. All the values are checked before any is applied, and the write is refused while a protocol runs. Volumes and flowrates are fixed-point.")]
+    public partial class ProtocolConfiguration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolConfiguration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 99;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProtocolConfiguration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProtocolConfiguration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 15;
+
+        static ProtocolConfigurationPayload ParsePayload(uint[] payload)
+        {
+            ProtocolConfigurationPayload result;
+            result.ProtocolType = (PumpProtocolType)payload[0];
+            result.ProtocolDirection = (ProtocolDirectionState)payload[1];
+            result.NumberOfSteps = payload[2];
+            result.PeriodMicroseconds = payload[3];
+            result.Flowrate = payload[4];
+            result.Volume = payload[5];
+            result.CalibrationOffset = (int)payload[6];
+            result.CalibrationSlope = payload[7];
+            result.Acceleration = payload[8];
+            result.Deceleration = payload[9];
+            result.MotorMicrostep = (StepModeType)payload[10];
+            result.DigitalInput0Config = (DI0TriggerConfig)payload[11];
+            result.DigitalOutput0Config = (DO0SyncConfig)payload[12];
+            result.DigitalOutput1Config = (DO1SyncConfig)payload[13];
+            result.EnableEvents = (PumpEvents)payload[14];
+            return result;
+        }
+
+        static uint[] FormatPayload(ProtocolConfigurationPayload value)
+        {
+            uint[] result;
+            result = new uint[15];
+            result[0] = (uint)value.ProtocolType;
+            result[1] = (uint)value.ProtocolDirection;
+            result[2] = value.NumberOfSteps;
+            result[3] = value.PeriodMicroseconds;
+            result[4] = value.Flowrate;
+            result[5] = value.Volume;
+            result[6] = (uint)value.CalibrationOffset;
+            result[7] = value.CalibrationSlope;
+            result[8] = value.Acceleration;
+            result[9] = value.Deceleration;
+            result[10] = (uint)value.MotorMicrostep;
+            result[11] = (uint)value.DigitalInput0Config;
+            result[12] = (uint)value.DigitalOutput0Config;
+            result[13] = (uint)value.DigitalOutput1Config;
+            result[14] = (uint)value.EnableEvents;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProtocolConfiguration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ProtocolConfigurationPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<uint>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProtocolConfiguration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ProtocolConfigurationPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<uint>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProtocolConfiguration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolConfiguration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ProtocolConfigurationPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProtocolConfiguration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolConfiguration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ProtocolConfigurationPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProtocolConfiguration register.
+    /// </summary>
+    /// <seealso cref="ProtocolConfiguration"/>
+    [Description("Filters and selects timestamped messages from the ProtocolConfiguration register.")]
+    public partial class TimestampedProtocolConfiguration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolConfiguration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProtocolConfiguration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProtocolConfiguration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ProtocolConfigurationPayload> GetPayload(HarpMessage message)
+        {
+            return ProtocolConfiguration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the progress of the running protocol, or of the last one once it stopped. Sent while the protocol runs as set by ProgressPeriod and ProgressPercent, and once more when it stops.
+    /// </summary>
+    [Description("The progress of the running protocol, or of the last one once it stopped. Sent while the protocol runs as set by ProgressPeriod and ProgressPercent, and once more when it stops.")]
+    public partial class ProtocolProgress
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolProgress"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 100;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProtocolProgress"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProtocolProgress"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static ProtocolProgressPayload ParsePayload(uint[] payload)
+        {
+            ProtocolProgressPayload result;
+            result.StepsDone = payload[0];
+            result.StepsRemaining = payload[1];
+            result.Volume = payload[2];
+            result.RemainingTime = payload[3];
+            return result;
+        }
+
+        static uint[] FormatPayload(ProtocolProgressPayload value)
+        {
+            uint[] result;
+            result = new uint[4];
+            result[0] = value.StepsDone;
+            result[1] = value.StepsRemaining;
+            result[2] = value.Volume;
+            result[3] = value.RemainingTime;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProtocolProgress"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ProtocolProgressPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<uint>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProtocolProgress"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ProtocolProgressPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<uint>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProtocolProgress"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolProgress"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ProtocolProgressPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProtocolProgress"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProtocolProgress"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ProtocolProgressPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProtocolProgress register.
+    /// </summary>
+    /// <seealso cref="ProtocolProgress"/>
+    [Description("Filters and selects timestamped messages from the ProtocolProgress register.")]
+    public partial class TimestampedProtocolProgress
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProtocolProgress"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProtocolProgress.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProtocolProgress"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ProtocolProgressPayload> GetPayload(HarpMessage message)
+        {
+            return ProtocolProgress.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that period, in milliseconds, of the ProtocolProgress events while a protocol runs. Zero disables the periodic events.
+    /// </summary>
+    [Description("Period, in milliseconds, of the ProtocolProgress events while a protocol runs. Zero disables the periodic events.")]
+    public partial class ProgressPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProgressPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 101;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProgressPeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProgressPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProgressPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProgressPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProgressPeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProgressPeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProgressPeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProgressPeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProgressPeriod register.
+    /// </summary>
+    /// <seealso cref="ProgressPeriod"/>
+    [Description("Filters and selects timestamped messages from the ProgressPeriod register.")]
+    public partial class TimestampedProgressPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProgressPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProgressPeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProgressPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return ProgressPeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sends a ProtocolProgress event each time the protocol advances this percentage of its steps. Zero disables these events.
+    /// </summary>
+    [Description("Sends a ProtocolProgress event each time the protocol advances this percentage of its steps. Zero disables these events.")]
+    public partial class ProgressPercent
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProgressPercent"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 102;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProgressPercent"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProgressPercent"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProgressPercent"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProgressPercent"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProgressPercent"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProgressPercent"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProgressPercent"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProgressPercent"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProgressPercent register.
+    /// </summary>
+    /// <seealso cref="ProgressPercent"/>
+    [Description("Filters and selects timestamped messages from the ProgressPercent register.")]
+    public partial class TimestampedProgressPercent
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProgressPercent"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProgressPercent.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProgressPercent"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return ProgressPercent.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that snapshot of the step, direction, switches, input and protocol states with the position. When enabled in EnableEventsExtended it is sent once on the millisecond after any of the states changed, so the separate events of those registers can be disabled.
+    /// </summary>
+    [Description("Snapshot of the step, direction, switches, input and protocol states with the position. When enabled in EnableEventsExtended it is sent once on the millisecond after any of the states changed, so the separate events of those registers can be disabled.")]
+    public partial class Status
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Status"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 103;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Status"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Status"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        static StatusPayload ParsePayload(uint[] payload)
+        {
+            StatusPayload result;
+            result.Flags = (StatusFlags)payload[0];
+            result.Position = (int)payload[1];
+            return result;
+        }
+
+        static uint[] FormatPayload(StatusPayload value)
+        {
+            uint[] result;
+            result = new uint[2];
+            result[0] = (uint)value.Flags;
+            result[1] = (uint)value.Position;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Status"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static StatusPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<uint>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Status"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StatusPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<uint>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Status"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Status"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, StatusPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Status"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Status"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, StatusPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Status register.
+    /// </summary>
+    /// <seealso cref="Status"/>
+    [Description("Filters and selects timestamped messages from the Status register.")]
+    public partial class TimestampedStatus
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Status"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Status.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Status"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StatusPayload> GetPayload(HarpMessage message)
+        {
+            return Status.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that plays the STEP pulses of the Step and Volume protocols from DMA, with hardware timed intervals and one interrupt per block of up to 32 steps. Used from the next start of a protocol when the microstep mode isn't Auto, the refill is off and the Step and Position events are disabled or decimated; otherwise the protocol runs on the step interrupt. Commits are refused while a protocol plays back.
+    /// </summary>
+    [Description("Plays the STEP pulses of the Step and Volume protocols from DMA, with hardware timed intervals and one interrupt per block of up to 32 steps. Used from the next start of a protocol when the microstep mode isn't Auto, the refill is off and the Step and Position events are disabled or decimated; otherwise the protocol runs on the step interrupt. Commits are refused while a protocol plays back.")]
+    public partial class StepPlayback
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StepPlayback"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 104;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StepPlayback"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StepPlayback"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StepPlayback"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static EnableFlag GetPayload(HarpMessage message)
+        {
+            return (EnableFlag)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StepPlayback"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((EnableFlag)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StepPlayback"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StepPlayback"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StepPlayback"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StepPlayback"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StepPlayback register.
+    /// </summary>
+    /// <seealso cref="StepPlayback"/>
+    [Description("Filters and selects timestamped messages from the StepPlayback register.")]
+    public partial class TimestampedStepPlayback
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StepPlayback"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StepPlayback.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StepPlayback"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetPayload(HarpMessage message)
+        {
+            return StepPlayback.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that load of the CPU and latency of the interrupts, in CPU cycles (32 per microsecond). All values saturate at 65535. Any write resets the statistics.
+    /// </summary>
+    [Description("Load of the CPU and latency of the interrupts, in CPU cycles (32 per microsecond). All values saturate at 65535. Any write resets the statistics.")]
+    public partial class CpuLoad
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CpuLoad"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 105;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CpuLoad"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CpuLoad"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 10;
+
+        static CpuLoadPayload ParsePayload(ushort[] payload)
+        {
+            CpuLoadPayload result;
+            result.TickCyclesMin = payload[0];
+            result.TickCyclesAverage = payload[1];
+            result.TickCyclesMax = payload[2];
+            result.LatencyPortB = payload[3];
+            result.LatencyPortC = payload[4];
+            result.LatencyPortD = payload[5];
+            result.MissedTicks = payload[6];
+            result.LateSteps = payload[7];
+            result.TxBufferDepth = payload[8];
+            result.TxBufferDepthMax = payload[9];
+            return result;
+        }
+
+        static ushort[] FormatPayload(CpuLoadPayload value)
+        {
+            ushort[] result;
+            result = new ushort[10];
+            result[0] = value.TickCyclesMin;
+            result[1] = value.TickCyclesAverage;
+            result[2] = value.TickCyclesMax;
+            result[3] = value.LatencyPortB;
+            result[4] = value.LatencyPortC;
+            result[5] = value.LatencyPortD;
+            result[6] = value.MissedTicks;
+            result[7] = value.LateSteps;
+            result[8] = value.TxBufferDepth;
+            result[9] = value.TxBufferDepthMax;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CpuLoad"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static CpuLoadPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CpuLoad"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CpuLoadPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CpuLoad"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CpuLoad"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, CpuLoadPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CpuLoad"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CpuLoad"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, CpuLoadPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CpuLoad register.
+    /// </summary>
+    /// <seealso cref="CpuLoad"/>
+    [Description("Filters and selects timestamped messages from the CpuLoad register.")]
+    public partial class TimestampedCpuLoad
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CpuLoad"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CpuLoad.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CpuLoad"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CpuLoadPayload> GetPayload(HarpMessage message)
+        {
+            return CpuLoad.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that intervals between the STEP pulses raised by the step engine since the last start of a protocol, timestamped on the device. Pulses played back from DMA aren't measured. Any write resets the intervals and the StepJitter histogram.
+    /// </summary>
+    [Description("Intervals between the STEP pulses raised by the step engine since the last start of a protocol, timestamped on the device. Pulses played back from DMA aren't measured. Any write resets the intervals and the StepJitter histogram.")]
+    public partial class StepIntervals
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StepIntervals"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 106;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StepIntervals"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StepIntervals"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static StepIntervalsPayload ParsePayload(uint[] payload)
+        {
+            StepIntervalsPayload result;
+            result.Count = payload[0];
+            result.MinInterval = payload[1];
+            result.MaxInterval = payload[2];
+            result.MeanInterval = payload[3];
+            return result;
+        }
+
+        static uint[] FormatPayload(StepIntervalsPayload value)
+        {
+            uint[] result;
+            result = new uint[4];
+            result[0] = value.Count;
+            result[1] = value.MinInterval;
+            result[2] = value.MaxInterval;
+            result[3] = value.MeanInterval;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StepIntervals"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static StepIntervalsPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<uint>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StepIntervals"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StepIntervalsPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<uint>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StepIntervals"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StepIntervals"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, StepIntervalsPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StepIntervals"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StepIntervals"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, StepIntervalsPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StepIntervals register.
+    /// </summary>
+    /// <seealso cref="StepIntervals"/>
+    [Description("Filters and selects timestamped messages from the StepIntervals register.")]
+    public partial class TimestampedStepIntervals
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StepIntervals"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StepIntervals.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StepIntervals"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StepIntervalsPayload> GetPayload(HarpMessage message)
+        {
+            return StepIntervals.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that histogram of the deviations of the intervals in StepIntervals from the commanded ones. Bin 7 counts the intervals within 1 microsecond of the commanded one, bins 6 to 0 the ones shorter by 1, 2, 4, 8, 16, 32 and 64 or more microseconds and bins 8 to 14 the ones longer by the same amounts. Any write resets the histogram and StepIntervals.
+    /// </summary>
+    [Description("Histogram of the deviations of the intervals in StepIntervals from the commanded ones. Bin 7 counts the intervals within 1 microsecond of the commanded one, bins 6 to 0 the ones shorter by 1, 2, 4, 8, 16, 32 and 64 or more microseconds and bins 8 to 14 the ones longer by the same amounts. Any write resets the histogram and StepIntervals.")]
+    public partial class StepJitter
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StepJitter"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 107;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StepJitter"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StepJitter"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 15;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StepJitter"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StepJitter"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StepJitter"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StepJitter"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StepJitter"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StepJitter"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StepJitter register.
+    /// </summary>
+    /// <seealso cref="StepJitter"/>
+    [Description("Filters and selects timestamped messages from the StepJitter register.")]
+    public partial class TimestampedStepJitter
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StepJitter"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StepJitter.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StepJitter"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return StepJitter.GetTimestampedPayload(message);
+        }
+    }
+
     /// <summary>
     /// Represents an operator which creates standard message payloads for the
     /// SyringePump device.
     /// </summary>
-    /// <seealso cref="CreateEnableMotorDriverPayload"/>
-    /// <seealso cref="CreateEnableProtocolPayload"/>
-    /// <seealso cref="CreateStepPayload"/>
-    /// <seealso cref="CreateDirectionPayload"/>
-    /// <seealso cref="CreateForwardSwitchPayload"/>
-    /// <seealso cref="CreateReverseSwitchPayload"/>
-    /// <seealso cref="CreateDigitalInputStatePayload"/>
-    /// <seealso cref="CreateDigitalOutputSetPayload"/>
-    /// <seealso cref="CreateDigitalOutputClearPayload"/>
-    /// <seealso cref="CreateDO0SyncPayload"/>
-    /// <seealso cref="CreateDO1SyncPayload"/>
-    /// <seealso cref="CreateDI0TriggerPayload"/>
-    /// <seealso cref="CreateStepModePayload"/>
-    /// <seealso cref="CreateProtocolStepCountPayload"/>
-    /// <seealso cref="CreateProtocolPeriodPayload"/>
-    /// <seealso cref="CreateEnableEventsPayload"/>
-    /// <seealso cref="CreateProtocolPayload"/>
-    /// <seealso cref="CreateProtocolDirectionPayload"/>
-    [XmlInclude(typeof(CreateEnableMotorDriverPayload))]
-    [XmlInclude(typeof(CreateEnableProtocolPayload))]
-    [XmlInclude(typeof(CreateStepPayload))]
-    [XmlInclude(typeof(CreateDirectionPayload))]
-    [XmlInclude(typeof(CreateForwardSwitchPayload))]
-    [XmlInclude(typeof(CreateReverseSwitchPayload))]
-    [XmlInclude(typeof(CreateDigitalInputStatePayload))]
-    [XmlInclude(typeof(CreateDigitalOutputSetPayload))]
-    [XmlInclude(typeof(CreateDigitalOutputClearPayload))]
-    [XmlInclude(typeof(CreateDO0SyncPayload))]
-    [XmlInclude(typeof(CreateDO1SyncPayload))]
-    [XmlInclude(typeof(CreateDI0TriggerPayload))]
-    [XmlInclude(typeof(CreateStepModePayload))]
-    [XmlInclude(typeof(CreateProtocolStepCountPayload))]
-    [XmlInclude(typeof(CreateProtocolPeriodPayload))]
-    [XmlInclude(typeof(CreateEnableEventsPayload))]
-    [XmlInclude(typeof(CreateProtocolPayload))]
-    [XmlInclude(typeof(CreateProtocolDirectionPayload))]
-    [XmlInclude(typeof(CreateTimestampedEnableMotorDriverPayload))]
-    [XmlInclude(typeof(CreateTimestampedEnableProtocolPayload))]
-    [XmlInclude(typeof(CreateTimestampedStepPayload))]
-    [XmlInclude(typeof(CreateTimestampedDirectionPayload))]
-    [XmlInclude(typeof(CreateTimestampedForwardSwitchPayload))]
-    [XmlInclude(typeof(CreateTimestampedReverseSwitchPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalInputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputSetPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputClearPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO0SyncPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO1SyncPayload))]
-    [XmlInclude(typeof(CreateTimestampedDI0TriggerPayload))]
-    [XmlInclude(typeof(CreateTimestampedStepModePayload))]
-    [XmlInclude(typeof(CreateTimestampedProtocolStepCountPayload))]
-    [XmlInclude(typeof(CreateTimestampedProtocolPeriodPayload))]
-    [XmlInclude(typeof(CreateTimestampedEnableEventsPayload))]
-    [XmlInclude(typeof(CreateTimestampedProtocolPayload))]
-    [XmlInclude(typeof(CreateTimestampedProtocolDirectionPayload))]
-    [Description("Creates standard message payloads for the SyringePump device.")]
-    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    /// <seealso cref="CreateEnableMotorDriverPayload"/>
+    /// <seealso cref="CreateEnableProtocolPayload"/>
+    /// <seealso cref="CreateStepPayload"/>
+    /// <seealso cref="CreateDirectionPayload"/>
+    /// <seealso cref="CreateForwardSwitchPayload"/>
+    /// <seealso cref="CreateReverseSwitchPayload"/>
+    /// <seealso cref="CreateDigitalInputStatePayload"/>
+    /// <seealso cref="CreateDigitalOutputSetPayload"/>
+    /// <seealso cref="CreateDigitalOutputClearPayload"/>
+    /// <seealso cref="CreateDO0SyncPayload"/>
+    /// <seealso cref="CreateDO1SyncPayload"/>
+    /// <seealso cref="CreateDI0TriggerPayload"/>
+    /// <seealso cref="CreateStepModePayload"/>
+    /// <seealso cref="CreateProtocolStepCountPayload"/>
+    /// <seealso cref="CreateProtocolPeriodPayload"/>
+    /// <seealso cref="CreateEnableEventsPayload"/>
+    /// <seealso cref="CreateProtocolPayload"/>
+    /// <seealso cref="CreateProtocolDirectionPayload"/>
+    /// <seealso cref="CreateProtocolPeriodMicrosecondsPayload"/>
+    /// <seealso cref="CreateProtocolAccelerationPayload"/>
+    /// <seealso cref="CreateProtocolDecelerationPayload"/>
+    /// <seealso cref="CreateProtocolAverageRatePayload"/>
+    /// <seealso cref="CreateProtocolStepCount32Payload"/>
+    /// <seealso cref="CreatePositionPayload"/>
+    /// <seealso cref="CreateProtocolQueueSegmentPayload"/>
+    /// <seealso cref="CreateProtocolQueueCountPayload"/>
+    /// <seealso cref="CreateStreamRatePayload"/>
+    /// <seealso cref="CreateStreamPeriodPayload"/>
+    /// <seealso cref="CreateStreamUnderrunModePayload"/>
+    /// <seealso cref="CreateStreamUnderrunCountPayload"/>
+    /// <seealso cref="CreateStepReportStepsPayload"/>
+    /// <seealso cref="CreateStepReportPeriodPayload"/>
+    /// <seealso cref="CreateStepDeltaPayload"/>
+    /// <seealso cref="CreateDigitalInputEdgeTimePayload"/>
+    /// <seealso cref="CreateScheduleCommandPayload"/>
+    /// <seealso cref="CreateScheduleCountPayload"/>
+    /// <seealso cref="CreateScheduleStatisticsPayload"/>
+    /// <seealso cref="CreateMicrostepEffectivePayload"/>
+    /// <seealso cref="CreateMicrostepAutoRatePayload"/>
+    /// <seealso cref="CreateEnableEventsExtendedPayload"/>
+    /// <seealso cref="CreateHomingPayload"/>
+    /// <seealso cref="CreateHomingStatePayload"/>
+    /// <seealso cref="CreateHomingFastPeriodPayload"/>
+    /// <seealso cref="CreateHomingSlowPeriodPayload"/>
+    /// <seealso cref="CreateHomingAccelerationPayload"/>
+    /// <seealso cref="CreateHomingBackoffStepsPayload"/>
+    /// <seealso cref="CreateHomingPositionPayload"/>
+    /// <seealso cref="CreateSwitchOverrunStepsPayload"/>
+    /// <seealso cref="CreateRefillModePayload"/>
+    /// <seealso cref="CreateRefillEndPositionPayload"/>
+    /// <seealso cref="CreateRefillPeriodPayload"/>
+    /// <seealso cref="CreateRefillAccelerationPayload"/>
+    /// <seealso cref="CreateRefillValveDelayPayload"/>
+    /// <seealso cref="CreateRefillCyclePayload"/>
+    /// <seealso cref="CreateJogPeriodPayload"/>
+    /// <seealso cref="CreateJogAccelerationPayload"/>
+    /// <seealso cref="CreateJogMinPeriodPayload"/>
+    /// <seealso cref="CreateProtocolNextPeriodMicrosecondsPayload"/>
+    /// <seealso cref="CreateProtocolNextNumberOfStepsPayload"/>
+    /// <seealso cref="CreateProtocolNextDirectionPayload"/>
+    /// <seealso cref="CreateProtocolCommitPayload"/>
+    /// <seealso cref="CreateProtocolConfigurationPayload"/>
+    /// <seealso cref="CreateProtocolProgressPayload"/>
+    /// <seealso cref="CreateProgressPeriodPayload"/>
+    /// <seealso cref="CreateProgressPercentPayload"/>
+    /// <seealso cref="CreateStatusPayload"/>
+    /// <seealso cref="CreateStepPlaybackPayload"/>
+    /// <seealso cref="CreateCpuLoadPayload"/>
+    /// <seealso cref="CreateStepIntervalsPayload"/>
+    /// <seealso cref="CreateStepJitterPayload"/>
+    [XmlInclude(typeof(CreateEnableMotorDriverPayload))]
+    [XmlInclude(typeof(CreateEnableProtocolPayload))]
+    [XmlInclude(typeof(CreateStepPayload))]
+    [XmlInclude(typeof(CreateDirectionPayload))]
+    [XmlInclude(typeof(CreateForwardSwitchPayload))]
+    [XmlInclude(typeof(CreateReverseSwitchPayload))]
+    [XmlInclude(typeof(CreateDigitalInputStatePayload))]
+    [XmlInclude(typeof(CreateDigitalOutputSetPayload))]
+    [XmlInclude(typeof(CreateDigitalOutputClearPayload))]
+    [XmlInclude(typeof(CreateDO0SyncPayload))]
+    [XmlInclude(typeof(CreateDO1SyncPayload))]
+    [XmlInclude(typeof(CreateDI0TriggerPayload))]
+    [XmlInclude(typeof(CreateStepModePayload))]
+    [XmlInclude(typeof(CreateProtocolStepCountPayload))]
+    [XmlInclude(typeof(CreateProtocolPeriodPayload))]
+    [XmlInclude(typeof(CreateEnableEventsPayload))]
+    [XmlInclude(typeof(CreateProtocolPayload))]
+    [XmlInclude(typeof(CreateProtocolDirectionPayload))]
+    [XmlInclude(typeof(CreateProtocolPeriodMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateProtocolAccelerationPayload))]
+    [XmlInclude(typeof(CreateProtocolDecelerationPayload))]
+    [XmlInclude(typeof(CreateProtocolAverageRatePayload))]
+    [XmlInclude(typeof(CreateProtocolStepCount32Payload))]
+    [XmlInclude(typeof(CreatePositionPayload))]
+    [XmlInclude(typeof(CreateProtocolQueueSegmentPayload))]
+    [XmlInclude(typeof(CreateProtocolQueueCountPayload))]
+    [XmlInclude(typeof(CreateStreamRatePayload))]
+    [XmlInclude(typeof(CreateStreamPeriodPayload))]
+    [XmlInclude(typeof(CreateStreamUnderrunModePayload))]
+    [XmlInclude(typeof(CreateStreamUnderrunCountPayload))]
+    [XmlInclude(typeof(CreateStepReportStepsPayload))]
+    [XmlInclude(typeof(CreateStepReportPeriodPayload))]
+    [XmlInclude(typeof(CreateStepDeltaPayload))]
+    [XmlInclude(typeof(CreateDigitalInputEdgeTimePayload))]
+    [XmlInclude(typeof(CreateScheduleCommandPayload))]
+    [XmlInclude(typeof(CreateScheduleCountPayload))]
+    [XmlInclude(typeof(CreateScheduleStatisticsPayload))]
+    [XmlInclude(typeof(CreateMicrostepEffectivePayload))]
+    [XmlInclude(typeof(CreateMicrostepAutoRatePayload))]
+    [XmlInclude(typeof(CreateEnableEventsExtendedPayload))]
+    [XmlInclude(typeof(CreateHomingPayload))]
+    [XmlInclude(typeof(CreateHomingStatePayload))]
+    [XmlInclude(typeof(CreateHomingFastPeriodPayload))]
+    [XmlInclude(typeof(CreateHomingSlowPeriodPayload))]
+    [XmlInclude(typeof(CreateHomingAccelerationPayload))]
+    [XmlInclude(typeof(CreateHomingBackoffStepsPayload))]
+    [XmlInclude(typeof(CreateHomingPositionPayload))]
+    [XmlInclude(typeof(CreateSwitchOverrunStepsPayload))]
+    [XmlInclude(typeof(CreateRefillModePayload))]
+    [XmlInclude(typeof(CreateRefillEndPositionPayload))]
+    [XmlInclude(typeof(CreateRefillPeriodPayload))]
+    [XmlInclude(typeof(CreateRefillAccelerationPayload))]
+    [XmlInclude(typeof(CreateRefillValveDelayPayload))]
+    [XmlInclude(typeof(CreateRefillCyclePayload))]
+    [XmlInclude(typeof(CreateJogPeriodPayload))]
+    [XmlInclude(typeof(CreateJogAccelerationPayload))]
+    [XmlInclude(typeof(CreateJogMinPeriodPayload))]
+    [XmlInclude(typeof(CreateProtocolNextPeriodMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateProtocolNextNumberOfStepsPayload))]
+    [XmlInclude(typeof(CreateProtocolNextDirectionPayload))]
+    [XmlInclude(typeof(CreateProtocolCommitPayload))]
+    [XmlInclude(typeof(CreateProtocolConfigurationPayload))]
+    [XmlInclude(typeof(CreateProtocolProgressPayload))]
+    [XmlInclude(typeof(CreateProgressPeriodPayload))]
+    [XmlInclude(typeof(CreateProgressPercentPayload))]
+    [XmlInclude(typeof(CreateStatusPayload))]
+    [XmlInclude(typeof(CreateStepPlaybackPayload))]
+    [XmlInclude(typeof(CreateCpuLoadPayload))]
+    [XmlInclude(typeof(CreateStepIntervalsPayload))]
+    [XmlInclude(typeof(CreateStepJitterPayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableMotorDriverPayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableProtocolPayload))]
+    [XmlInclude(typeof(CreateTimestampedStepPayload))]
+    [XmlInclude(typeof(CreateTimestampedDirectionPayload))]
+    [XmlInclude(typeof(CreateTimestampedForwardSwitchPayload))]
+    [XmlInclude(typeof(CreateTimestampedReverseSwitchPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputSetPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputClearPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0SyncPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO1SyncPayload))]
+    [XmlInclude(typeof(CreateTimestampedDI0TriggerPayload))]
+    [XmlInclude(typeof(CreateTimestampedStepModePayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolStepCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableEventsPayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolPayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolDirectionPayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolPeriodMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolAccelerationPayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolDecelerationPayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolAverageRatePayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolStepCount32Payload))]
+    [XmlInclude(typeof(CreateTimestampedPositionPayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolQueueSegmentPayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolQueueCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedStreamRatePayload))]
+    [XmlInclude(typeof(CreateTimestampedStreamPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedStreamUnderrunModePayload))]
+    [XmlInclude(typeof(CreateTimestampedStreamUnderrunCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedStepReportStepsPayload))]
+    [XmlInclude(typeof(CreateTimestampedStepReportPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedStepDeltaPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputEdgeTimePayload))]
+    [XmlInclude(typeof(CreateTimestampedScheduleCommandPayload))]
+    [XmlInclude(typeof(CreateTimestampedScheduleCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedScheduleStatisticsPayload))]
+    [XmlInclude(typeof(CreateTimestampedMicrostepEffectivePayload))]
+    [XmlInclude(typeof(CreateTimestampedMicrostepAutoRatePayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableEventsExtendedPayload))]
+    [XmlInclude(typeof(CreateTimestampedHomingPayload))]
+    [XmlInclude(typeof(CreateTimestampedHomingStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedHomingFastPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedHomingSlowPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedHomingAccelerationPayload))]
+    [XmlInclude(typeof(CreateTimestampedHomingBackoffStepsPayload))]
+    [XmlInclude(typeof(CreateTimestampedHomingPositionPayload))]
+    [XmlInclude(typeof(CreateTimestampedSwitchOverrunStepsPayload))]
+    [XmlInclude(typeof(CreateTimestampedRefillModePayload))]
+    [XmlInclude(typeof(CreateTimestampedRefillEndPositionPayload))]
+    [XmlInclude(typeof(CreateTimestampedRefillPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedRefillAccelerationPayload))]
+    [XmlInclude(typeof(CreateTimestampedRefillValveDelayPayload))]
+    [XmlInclude(typeof(CreateTimestampedRefillCyclePayload))]
+    [XmlInclude(typeof(CreateTimestampedJogPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedJogAccelerationPayload))]
+    [XmlInclude(typeof(CreateTimestampedJogMinPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolNextPeriodMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolNextNumberOfStepsPayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolNextDirectionPayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolCommitPayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolConfigurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedProtocolProgressPayload))]
+    [XmlInclude(typeof(CreateTimestampedProgressPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedProgressPercentPayload))]
+    [XmlInclude(typeof(CreateTimestampedStatusPayload))]
+    [XmlInclude(typeof(CreateTimestampedStepPlaybackPayload))]
+    [XmlInclude(typeof(CreateTimestampedCpuLoadPayload))]
+    [XmlInclude(typeof(CreateTimestampedStepIntervalsPayload))]
+    [XmlInclude(typeof(CreateTimestampedStepJitterPayload))]
+    [Description("Creates standard message payloads for the SyringePump device.")]
+    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// </summary>
+        public CreateMessage()
+        {
+            Payload = new CreateEnableMotorDriverPayload();
+        }
+
+        string INamedElement.Name => $"{nameof(SyringePump)}.{GetElementDisplayName(Payload)}";
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables the motor driver.
+    /// </summary>
+    [DisplayName("EnableMotorDriverPayload")]
+    [Description("Creates a message payload that enables the motor driver.")]
+    public partial class CreateEnableMotorDriverPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables the motor driver.
+        /// </summary>
+        [Description("The value that enables the motor driver.")]
+        public EnableFlag EnableMotorDriver { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnableMotorDriver register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EnableFlag GetPayload()
+        {
+            return EnableMotorDriver;
+        }
+
+        /// <summary>
+        /// Creates a message that enables the motor driver.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableMotorDriver register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.EnableMotorDriver.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables the motor driver.
+    /// </summary>
+    [DisplayName("TimestampedEnableMotorDriverPayload")]
+    [Description("Creates a timestamped message payload that enables the motor driver.")]
+    public partial class CreateTimestampedEnableMotorDriverPayload : CreateEnableMotorDriverPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables the motor driver.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableMotorDriver register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.EnableMotorDriver.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables the currently defined protocol.
+    /// </summary>
+    [DisplayName("EnableProtocolPayload")]
+    [Description("Creates a message payload that enables the currently defined protocol.")]
+    public partial class CreateEnableProtocolPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables the currently defined protocol.
+        /// </summary>
+        [Description("The value that enables the currently defined protocol.")]
+        public EnableFlag EnableProtocol { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnableProtocol register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EnableFlag GetPayload()
+        {
+            return EnableProtocol;
+        }
+
+        /// <summary>
+        /// Creates a message that enables the currently defined protocol.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableProtocol register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.EnableProtocol.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables the currently defined protocol.
+    /// </summary>
+    [DisplayName("TimestampedEnableProtocolPayload")]
+    [Description("Creates a timestamped message payload that enables the currently defined protocol.")]
+    public partial class CreateTimestampedEnableProtocolPayload : CreateEnableProtocolPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables the currently defined protocol.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableProtocol register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.EnableProtocol.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that status of the STEP motor controller pin.
+    /// </summary>
+    [DisplayName("StepPayload")]
+    [Description("Creates a message payload that status of the STEP motor controller pin.")]
+    public partial class CreateStepPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that status of the STEP motor controller pin.
+        /// </summary>
+        [Description("The value that status of the STEP motor controller pin.")]
+        public StepState Step { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Step register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public StepState GetPayload()
+        {
+            return Step;
+        }
+
+        /// <summary>
+        /// Creates a message that status of the STEP motor controller pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Step register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.Step.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that status of the STEP motor controller pin.
+    /// </summary>
+    [DisplayName("TimestampedStepPayload")]
+    [Description("Creates a timestamped message payload that status of the STEP motor controller pin.")]
+    public partial class CreateTimestampedStepPayload : CreateStepPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that status of the STEP motor controller pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Step register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.Step.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that status of the DIR motor controller pin.
+    /// </summary>
+    [DisplayName("DirectionPayload")]
+    [Description("Creates a message payload that status of the DIR motor controller pin.")]
+    public partial class CreateDirectionPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that status of the DIR motor controller pin.
+        /// </summary>
+        [Description("The value that status of the DIR motor controller pin.")]
+        public DirectionState Direction { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Direction register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DirectionState GetPayload()
+        {
+            return Direction;
+        }
+
+        /// <summary>
+        /// Creates a message that status of the DIR motor controller pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Direction register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.Direction.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that status of the DIR motor controller pin.
+    /// </summary>
+    [DisplayName("TimestampedDirectionPayload")]
+    [Description("Creates a timestamped message payload that status of the DIR motor controller pin.")]
+    public partial class CreateTimestampedDirectionPayload : CreateDirectionPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that status of the DIR motor controller pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Direction register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.Direction.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that status of the forward limit switch.
+    /// </summary>
+    [DisplayName("ForwardSwitchPayload")]
+    [Description("Creates a message payload that status of the forward limit switch.")]
+    public partial class CreateForwardSwitchPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that status of the forward limit switch.
+        /// </summary>
+        [Description("The value that status of the forward limit switch.")]
+        public ForwardSwitchState ForwardSwitch { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ForwardSwitch register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ForwardSwitchState GetPayload()
+        {
+            return ForwardSwitch;
+        }
+
+        /// <summary>
+        /// Creates a message that status of the forward limit switch.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ForwardSwitch register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ForwardSwitch.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that status of the forward limit switch.
+    /// </summary>
+    [DisplayName("TimestampedForwardSwitchPayload")]
+    [Description("Creates a timestamped message payload that status of the forward limit switch.")]
+    public partial class CreateTimestampedForwardSwitchPayload : CreateForwardSwitchPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that status of the forward limit switch.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ForwardSwitch register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ForwardSwitch.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that status of the reverse limit switch.
+    /// </summary>
+    [DisplayName("ReverseSwitchPayload")]
+    [Description("Creates a message payload that status of the reverse limit switch.")]
+    public partial class CreateReverseSwitchPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that status of the reverse limit switch.
+        /// </summary>
+        [Description("The value that status of the reverse limit switch.")]
+        public ReverseSwitchState ReverseSwitch { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ReverseSwitch register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ReverseSwitchState GetPayload()
+        {
+            return ReverseSwitch;
+        }
+
+        /// <summary>
+        /// Creates a message that status of the reverse limit switch.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ReverseSwitch register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ReverseSwitch.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that status of the reverse limit switch.
+    /// </summary>
+    [DisplayName("TimestampedReverseSwitchPayload")]
+    [Description("Creates a timestamped message payload that status of the reverse limit switch.")]
+    public partial class CreateTimestampedReverseSwitchPayload : CreateReverseSwitchPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that status of the reverse limit switch.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ReverseSwitch register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ReverseSwitch.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that status of the digital input pin.
+    /// </summary>
+    [DisplayName("DigitalInputStatePayload")]
+    [Description("Creates a message payload that status of the digital input pin.")]
+    public partial class CreateDigitalInputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that status of the digital input pin.
+        /// </summary>
+        [Description("The value that status of the digital input pin.")]
+        public DigitalInputs DigitalInputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return DigitalInputState;
+        }
+
+        /// <summary>
+        /// Creates a message that status of the digital input pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.DigitalInputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that status of the digital input pin.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputStatePayload")]
+    [Description("Creates a timestamped message payload that status of the digital input pin.")]
+    public partial class CreateTimestampedDigitalInputStatePayload : CreateDigitalInputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that status of the digital input pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.DigitalInputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that set the specified digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputSetPayload")]
+    [Description("Creates a message payload that set the specified digital output lines.")]
+    public partial class CreateDigitalOutputSetPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that set the specified digital output lines.
+        /// </summary>
+        [Description("The value that set the specified digital output lines.")]
+        public DigitalOutputs DigitalOutputSet { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputSet register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputSet;
+        }
+
+        /// <summary>
+        /// Creates a message that set the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputSet register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.DigitalOutputSet.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that set the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputSetPayload")]
+    [Description("Creates a timestamped message payload that set the specified digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputSetPayload : CreateDigitalOutputSetPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that set the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputSet register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.DigitalOutputSet.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that clear the specified digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputClearPayload")]
+    [Description("Creates a message payload that clear the specified digital output lines.")]
+    public partial class CreateDigitalOutputClearPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that clear the specified digital output lines.
+        /// </summary>
+        [Description("The value that clear the specified digital output lines.")]
+        public DigitalOutputs DigitalOutputClear { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputClear register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputClear;
+        }
+
+        /// <summary>
+        /// Creates a message that clear the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputClear register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.DigitalOutputClear.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that clear the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputClearPayload")]
+    [Description("Creates a timestamped message payload that clear the specified digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputClearPayload : CreateDigitalOutputClearPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that clear the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputClear register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.DigitalOutputClear.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures which signal is mimicked in the digital output 0.
+    /// </summary>
+    [DisplayName("DO0SyncPayload")]
+    [Description("Creates a message payload that configures which signal is mimicked in the digital output 0.")]
+    public partial class CreateDO0SyncPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures which signal is mimicked in the digital output 0.
+        /// </summary>
+        [Description("The value that configures which signal is mimicked in the digital output 0.")]
+        public DO0SyncConfig DO0Sync { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0Sync register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DO0SyncConfig GetPayload()
+        {
+            return DO0Sync;
+        }
+
+        /// <summary>
+        /// Creates a message that configures which signal is mimicked in the digital output 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0Sync register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.DO0Sync.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures which signal is mimicked in the digital output 0.
+    /// </summary>
+    [DisplayName("TimestampedDO0SyncPayload")]
+    [Description("Creates a timestamped message payload that configures which signal is mimicked in the digital output 0.")]
+    public partial class CreateTimestampedDO0SyncPayload : CreateDO0SyncPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures which signal is mimicked in the digital output 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0Sync register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.DO0Sync.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures which signal is mimicked in the digital output 1.
+    /// </summary>
+    [DisplayName("DO1SyncPayload")]
+    [Description("Creates a message payload that configures which signal is mimicked in the digital output 1.")]
+    public partial class CreateDO1SyncPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures which signal is mimicked in the digital output 1.
+        /// </summary>
+        [Description("The value that configures which signal is mimicked in the digital output 1.")]
+        public DO1SyncConfig DO1Sync { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO1Sync register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DO1SyncConfig GetPayload()
+        {
+            return DO1Sync;
+        }
+
+        /// <summary>
+        /// Creates a message that configures which signal is mimicked in the digital output 1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO1Sync register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.DO1Sync.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures which signal is mimicked in the digital output 1.
+    /// </summary>
+    [DisplayName("TimestampedDO1SyncPayload")]
+    [Description("Creates a timestamped message payload that configures which signal is mimicked in the digital output 1.")]
+    public partial class CreateTimestampedDO1SyncPayload : CreateDO1SyncPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures which signal is mimicked in the digital output 1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO1Sync register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.DO1Sync.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the callback function triggered when digital input is triggered.
+    /// </summary>
+    [DisplayName("DI0TriggerPayload")]
+    [Description("Creates a message payload that configures the callback function triggered when digital input is triggered.")]
+    public partial class CreateDI0TriggerPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the callback function triggered when digital input is triggered.
+        /// </summary>
+        [Description("The value that configures the callback function triggered when digital input is triggered.")]
+        public DI0TriggerConfig DI0Trigger { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DI0Trigger register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DI0TriggerConfig GetPayload()
+        {
+            return DI0Trigger;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the callback function triggered when digital input is triggered.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DI0Trigger register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.DI0Trigger.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the callback function triggered when digital input is triggered.
+    /// </summary>
+    [DisplayName("TimestampedDI0TriggerPayload")]
+    [Description("Creates a timestamped message payload that configures the callback function triggered when digital input is triggered.")]
+    public partial class CreateTimestampedDI0TriggerPayload : CreateDI0TriggerPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the callback function triggered when digital input is triggered.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DI0Trigger register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.DI0Trigger.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the motor step mode from a list of available types.
+    /// </summary>
+    [DisplayName("StepModePayload")]
+    [Description("Creates a message payload that sets the motor step mode from a list of available types.")]
+    public partial class CreateStepModePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the motor step mode from a list of available types.
+        /// </summary>
+        [Description("The value that sets the motor step mode from a list of available types.")]
+        public StepModeType StepMode { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StepMode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public StepModeType GetPayload()
+        {
+            return StepMode;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the motor step mode from a list of available types.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StepMode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.StepMode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the motor step mode from a list of available types.
+    /// </summary>
+    [DisplayName("TimestampedStepModePayload")]
+    [Description("Creates a timestamped message payload that sets the motor step mode from a list of available types.")]
+    public partial class CreateTimestampedStepModePayload : CreateStepModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the motor step mode from a list of available types.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StepMode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.StepMode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the number of steps to be executed in the current protocol.
+    /// </summary>
+    [DisplayName("ProtocolStepCountPayload")]
+    [Description("Creates a message payload that sets the number of steps to be executed in the current protocol.")]
+    public partial class CreateProtocolStepCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the number of steps to be executed in the current protocol.
+        /// </summary>
+        [Range(min: 1, max: long.MaxValue)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the number of steps to be executed in the current protocol.")]
+        public ushort ProtocolStepCount { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the ProtocolStepCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return ProtocolStepCount;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the number of steps to be executed in the current protocol.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ProtocolStepCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolStepCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the number of steps to be executed in the current protocol.
+    /// </summary>
+    [DisplayName("TimestampedProtocolStepCountPayload")]
+    [Description("Creates a timestamped message payload that sets the number of steps to be executed in the current protocol.")]
+    public partial class CreateTimestampedProtocolStepCountPayload : CreateProtocolStepCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the number of steps to be executed in the current protocol.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ProtocolStepCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolStepCount.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the period, in ms, of of each step in the protocol.
+    /// </summary>
+    [DisplayName("ProtocolPeriodPayload")]
+    [Description("Creates a message payload that sets the period, in ms, of of each step in the protocol.")]
+    public partial class CreateProtocolPeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the period, in ms, of of each step in the protocol.
+        /// </summary>
+        [Range(min: 1, max: long.MaxValue)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the period, in ms, of of each step in the protocol.")]
+        public ushort ProtocolPeriod { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the ProtocolPeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return ProtocolPeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the period, in ms, of of each step in the protocol.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ProtocolPeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolPeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the period, in ms, of of each step in the protocol.
+    /// </summary>
+    [DisplayName("TimestampedProtocolPeriodPayload")]
+    [Description("Creates a timestamped message payload that sets the period, in ms, of of each step in the protocol.")]
+    public partial class CreateTimestampedProtocolPeriodPayload : CreateProtocolPeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the period, in ms, of of each step in the protocol.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ProtocolPeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolPeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies all the active events in the device.
+    /// </summary>
+    [DisplayName("EnableEventsPayload")]
+    [Description("Creates a message payload that specifies all the active events in the device.")]
+    public partial class CreateEnableEventsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies all the active events in the device.
+        /// </summary>
+        [Description("The value that specifies all the active events in the device.")]
+        public PumpEvents EnableEvents { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnableEvents register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PumpEvents GetPayload()
+        {
+            return EnableEvents;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies all the active events in the device.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableEvents register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.EnableEvents.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies all the active events in the device.
+    /// </summary>
+    [DisplayName("TimestampedEnableEventsPayload")]
+    [Description("Creates a timestamped message payload that specifies all the active events in the device.")]
+    public partial class CreateTimestampedEnableEventsPayload : CreateEnableEventsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies all the active events in the device.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableEvents register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.EnableEvents.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that status of the protocol execution.
+    /// </summary>
+    [DisplayName("ProtocolPayload")]
+    [Description("Creates a message payload that status of the protocol execution.")]
+    public partial class CreateProtocolPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that status of the protocol execution.
+        /// </summary>
+        [Description("The value that status of the protocol execution.")]
+        public ProtocolState Protocol { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Protocol register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ProtocolState GetPayload()
+        {
+            return Protocol;
+        }
+
+        /// <summary>
+        /// Creates a message that status of the protocol execution.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Protocol register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.Protocol.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that status of the protocol execution.
+    /// </summary>
+    [DisplayName("TimestampedProtocolPayload")]
+    [Description("Creates a timestamped message payload that status of the protocol execution.")]
+    public partial class CreateTimestampedProtocolPayload : CreateProtocolPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that status of the protocol execution.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Protocol register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.Protocol.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the direction of the protocol execution.
+    /// </summary>
+    [DisplayName("ProtocolDirectionPayload")]
+    [Description("Creates a message payload that sets the direction of the protocol execution.")]
+    public partial class CreateProtocolDirectionPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the direction of the protocol execution.
+        /// </summary>
+        [Description("The value that sets the direction of the protocol execution.")]
+        public ProtocolDirectionState ProtocolDirection { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ProtocolDirection register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ProtocolDirectionState GetPayload()
+        {
+            return ProtocolDirection;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the direction of the protocol execution.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ProtocolDirection register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolDirection.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the direction of the protocol execution.
+    /// </summary>
+    [DisplayName("TimestampedProtocolDirectionPayload")]
+    [Description("Creates a timestamped message payload that sets the direction of the protocol execution.")]
+    public partial class CreateTimestampedProtocolDirectionPayload : CreateProtocolDirectionPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the direction of the protocol execution.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ProtocolDirection register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolDirection.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the period, in microseconds, of each step in the protocol.
+    /// </summary>
+    [DisplayName("ProtocolPeriodMicrosecondsPayload")]
+    [Description("Creates a message payload that sets the period, in microseconds, of each step in the protocol.")]
+    public partial class CreateProtocolPeriodMicrosecondsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the period, in microseconds, of each step in the protocol.
+        /// </summary>
+        [Range(min: 100, max: 65535000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the period, in microseconds, of each step in the protocol.")]
+        public uint ProtocolPeriodMicroseconds { get; set; } = 100;
+
+        /// <summary>
+        /// Creates a message payload for the ProtocolPeriodMicroseconds register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return ProtocolPeriodMicroseconds;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the period, in microseconds, of each step in the protocol.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ProtocolPeriodMicroseconds register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolPeriodMicroseconds.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the period, in microseconds, of each step in the protocol.
+    /// </summary>
+    [DisplayName("TimestampedProtocolPeriodMicrosecondsPayload")]
+    [Description("Creates a timestamped message payload that sets the period, in microseconds, of each step in the protocol.")]
+    public partial class CreateTimestampedProtocolPeriodMicrosecondsPayload : CreateProtocolPeriodMicrosecondsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the period, in microseconds, of each step in the protocol.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ProtocolPeriodMicroseconds register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolPeriodMicroseconds.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the acceleration, in steps/s^2, used to ramp up to the protocol speed. A value of zero disables the ramp.
+    /// </summary>
+    [DisplayName("ProtocolAccelerationPayload")]
+    [Description("Creates a message payload that sets the acceleration, in steps/s^2, used to ramp up to the protocol speed. A value of zero disables the ramp.")]
+    public partial class CreateProtocolAccelerationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the acceleration, in steps/s^2, used to ramp up to the protocol speed. A value of zero disables the ramp.
+        /// </summary>
+        [Description("The value that sets the acceleration, in steps/s^2, used to ramp up to the protocol speed. A value of zero disables the ramp.")]
+        public ushort ProtocolAcceleration { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ProtocolAcceleration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return ProtocolAcceleration;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the acceleration, in steps/s^2, used to ramp up to the protocol speed. A value of zero disables the ramp.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ProtocolAcceleration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolAcceleration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the acceleration, in steps/s^2, used to ramp up to the protocol speed. A value of zero disables the ramp.
+    /// </summary>
+    [DisplayName("TimestampedProtocolAccelerationPayload")]
+    [Description("Creates a timestamped message payload that sets the acceleration, in steps/s^2, used to ramp up to the protocol speed. A value of zero disables the ramp.")]
+    public partial class CreateTimestampedProtocolAccelerationPayload : CreateProtocolAccelerationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the acceleration, in steps/s^2, used to ramp up to the protocol speed. A value of zero disables the ramp.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ProtocolAcceleration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolAcceleration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the deceleration, in steps/s^2, used to ramp down at the end of the protocol. A value of zero disables the ramp.
+    /// </summary>
+    [DisplayName("ProtocolDecelerationPayload")]
+    [Description("Creates a message payload that sets the deceleration, in steps/s^2, used to ramp down at the end of the protocol. A value of zero disables the ramp.")]
+    public partial class CreateProtocolDecelerationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the deceleration, in steps/s^2, used to ramp down at the end of the protocol. A value of zero disables the ramp.
+        /// </summary>
+        [Description("The value that sets the deceleration, in steps/s^2, used to ramp down at the end of the protocol. A value of zero disables the ramp.")]
+        public ushort ProtocolDeceleration { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ProtocolDeceleration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return ProtocolDeceleration;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the deceleration, in steps/s^2, used to ramp down at the end of the protocol. A value of zero disables the ramp.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ProtocolDeceleration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolDeceleration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the deceleration, in steps/s^2, used to ramp down at the end of the protocol. A value of zero disables the ramp.
+    /// </summary>
+    [DisplayName("TimestampedProtocolDecelerationPayload")]
+    [Description("Creates a timestamped message payload that sets the deceleration, in steps/s^2, used to ramp down at the end of the protocol. A value of zero disables the ramp.")]
+    public partial class CreateTimestampedProtocolDecelerationPayload : CreateProtocolDecelerationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the deceleration, in steps/s^2, used to ramp down at the end of the protocol. A value of zero disables the ramp.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ProtocolDeceleration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolDeceleration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports the average step rate, in steps/s, achieved since the start of the current or last protocol.
+    /// </summary>
+    [DisplayName("ProtocolAverageRatePayload")]
+    [Description("Creates a message payload that reports the average step rate, in steps/s, achieved since the start of the current or last protocol.")]
+    public partial class CreateProtocolAverageRatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports the average step rate, in steps/s, achieved since the start of the current or last protocol.
+        /// </summary>
+        [Description("The value that reports the average step rate, in steps/s, achieved since the start of the current or last protocol.")]
+        public float ProtocolAverageRate { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ProtocolAverageRate register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return ProtocolAverageRate;
+        }
+
+        /// <summary>
+        /// Creates a message that reports the average step rate, in steps/s, achieved since the start of the current or last protocol.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ProtocolAverageRate register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolAverageRate.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports the average step rate, in steps/s, achieved since the start of the current or last protocol.
+    /// </summary>
+    [DisplayName("TimestampedProtocolAverageRatePayload")]
+    [Description("Creates a timestamped message payload that reports the average step rate, in steps/s, achieved since the start of the current or last protocol.")]
+    public partial class CreateTimestampedProtocolAverageRatePayload : CreateProtocolAverageRatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports the average step rate, in steps/s, achieved since the start of the current or last protocol.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ProtocolAverageRate register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolAverageRate.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the number of steps to be executed in the current protocol, extended to 32 bits.
+    /// </summary>
+    [DisplayName("ProtocolStepCount32Payload")]
+    [Description("Creates a message payload that sets the number of steps to be executed in the current protocol, extended to 32 bits.")]
+    public partial class CreateProtocolStepCount32Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the number of steps to be executed in the current protocol, extended to 32 bits.
+        /// </summary>
+        [Range(min: 1, max: long.MaxValue)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the number of steps to be executed in the current protocol, extended to 32 bits.")]
+        public uint ProtocolStepCount32 { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the ProtocolStepCount32 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return ProtocolStepCount32;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the number of steps to be executed in the current protocol, extended to 32 bits.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ProtocolStepCount32 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolStepCount32.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the number of steps to be executed in the current protocol, extended to 32 bits.
+    /// </summary>
+    [DisplayName("TimestampedProtocolStepCount32Payload")]
+    [Description("Creates a timestamped message payload that sets the number of steps to be executed in the current protocol, extended to 32 bits.")]
+    public partial class CreateTimestampedProtocolStepCount32Payload : CreateProtocolStepCount32Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the number of steps to be executed in the current protocol, extended to 32 bits.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ProtocolStepCount32 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolStepCount32.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that contains the absolute position of the motor, in steps of the current step mode. Writing redefines the current position.
+    /// </summary>
+    [DisplayName("PositionPayload")]
+    [Description("Creates a message payload that contains the absolute position of the motor, in steps of the current step mode. Writing redefines the current position.")]
+    public partial class CreatePositionPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that contains the absolute position of the motor, in steps of the current step mode. Writing redefines the current position.
+        /// </summary>
+        [Description("The value that contains the absolute position of the motor, in steps of the current step mode. Writing redefines the current position.")]
+        public int Position { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Position register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public int GetPayload()
+        {
+            return Position;
+        }
+
+        /// <summary>
+        /// Creates a message that contains the absolute position of the motor, in steps of the current step mode. Writing redefines the current position.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Position register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.Position.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that contains the absolute position of the motor, in steps of the current step mode. Writing redefines the current position.
+    /// </summary>
+    [DisplayName("TimestampedPositionPayload")]
+    [Description("Creates a timestamped message payload that contains the absolute position of the motor, in steps of the current step mode. Writing redefines the current position.")]
+    public partial class CreateTimestampedPositionPayload : CreatePositionPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that contains the absolute position of the motor, in steps of the current step mode. Writing redefines the current position.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Position register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.Position.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that appends a segment to the protocol queue. Segments can be appended while the queue is running.
+    /// </summary>
+    [DisplayName("ProtocolQueueSegmentPayload")]
+    [Description("Creates a message payload that appends a segment to the protocol queue. Segments can be appended while the queue is running.")]
+    public partial class CreateProtocolQueueSegmentPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the number of steps in the segment.
+        /// </summary>
+        [Description("The number of steps in the segment.")]
+        public uint StepCount { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the period, in microseconds, of each step in the segment.
+        /// </summary>
+        [Description("The period, in microseconds, of each step in the segment.")]
+        public uint Period { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the direction of the segment.
+        /// </summary>
+        [Description("The direction of the segment.")]
+        public ProtocolDirectionState Direction { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the pause, in microseconds, after the last step of the segment.
+        /// </summary>
+        [Description("The pause, in microseconds, after the last step of the segment.")]
+        public uint Dwell { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ProtocolQueueSegment register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ProtocolQueueSegmentPayload GetPayload()
+        {
+            ProtocolQueueSegmentPayload value;
+            value.StepCount = StepCount;
+            value.Period = Period;
+            value.Direction = Direction;
+            value.Dwell = Dwell;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that appends a segment to the protocol queue. Segments can be appended while the queue is running.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ProtocolQueueSegment register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolQueueSegment.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that appends a segment to the protocol queue. Segments can be appended while the queue is running.
+    /// </summary>
+    [DisplayName("TimestampedProtocolQueueSegmentPayload")]
+    [Description("Creates a timestamped message payload that appends a segment to the protocol queue. Segments can be appended while the queue is running.")]
+    public partial class CreateTimestampedProtocolQueueSegmentPayload : CreateProtocolQueueSegmentPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that appends a segment to the protocol queue. Segments can be appended while the queue is running.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ProtocolQueueSegment register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolQueueSegment.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that contains the number of segments in the protocol queue, including the one running. An event is sent when each segment completes. Writing 0 clears the queue.
+    /// </summary>
+    [DisplayName("ProtocolQueueCountPayload")]
+    [Description("Creates a message payload that contains the number of segments in the protocol queue, including the one running. An event is sent when each segment completes. Writing 0 clears the queue.")]
+    public partial class CreateProtocolQueueCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that contains the number of segments in the protocol queue, including the one running. An event is sent when each segment completes. Writing 0 clears the queue.
+        /// </summary>
+        [Description("The value that contains the number of segments in the protocol queue, including the one running. An event is sent when each segment completes. Writing 0 clears the queue.")]
+        public byte ProtocolQueueCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ProtocolQueueCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return ProtocolQueueCount;
+        }
+
+        /// <summary>
+        /// Creates a message that contains the number of segments in the protocol queue, including the one running. An event is sent when each segment completes. Writing 0 clears the queue.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ProtocolQueueCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolQueueCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that contains the number of segments in the protocol queue, including the one running. An event is sent when each segment completes. Writing 0 clears the queue.
+    /// </summary>
+    [DisplayName("TimestampedProtocolQueueCountPayload")]
+    [Description("Creates a timestamped message payload that contains the number of segments in the protocol queue, including the one running. An event is sent when each segment completes. Writing 0 clears the queue.")]
+    public partial class CreateTimestampedProtocolQueueCountPayload : CreateProtocolQueueCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that contains the number of segments in the protocol queue, including the one running. An event is sent when each segment completes. Writing 0 clears the queue.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ProtocolQueueCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolQueueCount.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that appends a rate setpoint, in steps/s, to the streaming FIFO. Negative rates move in the reverse direction, up to 10000 steps/s.
+    /// </summary>
+    [DisplayName("StreamRatePayload")]
+    [Description("Creates a message payload that appends a rate setpoint, in steps/s, to the streaming FIFO. Negative rates move in the reverse direction, up to 10000 steps/s.")]
+    public partial class CreateStreamRatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that appends a rate setpoint, in steps/s, to the streaming FIFO. Negative rates move in the reverse direction, up to 10000 steps/s.
+        /// </summary>
+        [Description("The value that appends a rate setpoint, in steps/s, to the streaming FIFO. Negative rates move in the reverse direction, up to 10000 steps/s.")]
+        public float StreamRate { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StreamRate register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return StreamRate;
+        }
+
+        /// <summary>
+        /// Creates a message that appends a rate setpoint, in steps/s, to the streaming FIFO. Negative rates move in the reverse direction, up to 10000 steps/s.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StreamRate register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.StreamRate.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that appends a rate setpoint, in steps/s, to the streaming FIFO. Negative rates move in the reverse direction, up to 10000 steps/s.
+    /// </summary>
+    [DisplayName("TimestampedStreamRatePayload")]
+    [Description("Creates a timestamped message payload that appends a rate setpoint, in steps/s, to the streaming FIFO. Negative rates move in the reverse direction, up to 10000 steps/s.")]
+    public partial class CreateTimestampedStreamRatePayload : CreateStreamRatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that appends a rate setpoint, in steps/s, to the streaming FIFO. Negative rates move in the reverse direction, up to 10000 steps/s.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StreamRate register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.StreamRate.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the period, in ms, at which the streaming mode takes the next setpoint from the FIFO.
+    /// </summary>
+    [DisplayName("StreamPeriodPayload")]
+    [Description("Creates a message payload that sets the period, in ms, at which the streaming mode takes the next setpoint from the FIFO.")]
+    public partial class CreateStreamPeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the period, in ms, at which the streaming mode takes the next setpoint from the FIFO.
+        /// </summary>
+        [Range(min: 1, max: 1000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the period, in ms, at which the streaming mode takes the next setpoint from the FIFO.")]
+        public ushort StreamPeriod { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the StreamPeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return StreamPeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the period, in ms, at which the streaming mode takes the next setpoint from the FIFO.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StreamPeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.StreamPeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the period, in ms, at which the streaming mode takes the next setpoint from the FIFO.
+    /// </summary>
+    [DisplayName("TimestampedStreamPeriodPayload")]
+    [Description("Creates a timestamped message payload that sets the period, in ms, at which the streaming mode takes the next setpoint from the FIFO.")]
+    public partial class CreateTimestampedStreamPeriodPayload : CreateStreamPeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the period, in ms, at which the streaming mode takes the next setpoint from the FIFO.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StreamPeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.StreamPeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the behavior of the streaming mode when a period elapses with the FIFO empty.
+    /// </summary>
+    [DisplayName("StreamUnderrunModePayload")]
+    [Description("Creates a message payload that sets the behavior of the streaming mode when a period elapses with the FIFO empty.")]
+    public partial class CreateStreamUnderrunModePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the behavior of the streaming mode when a period elapses with the FIFO empty.
+        /// </summary>
+        [Description("The value that sets the behavior of the streaming mode when a period elapses with the FIFO empty.")]
+        public StreamUnderrunMode StreamUnderrunMode { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StreamUnderrunMode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public StreamUnderrunMode GetPayload()
+        {
+            return StreamUnderrunMode;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the behavior of the streaming mode when a period elapses with the FIFO empty.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StreamUnderrunMode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.StreamUnderrunMode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the behavior of the streaming mode when a period elapses with the FIFO empty.
+    /// </summary>
+    [DisplayName("TimestampedStreamUnderrunModePayload")]
+    [Description("Creates a timestamped message payload that sets the behavior of the streaming mode when a period elapses with the FIFO empty.")]
+    public partial class CreateTimestampedStreamUnderrunModePayload : CreateStreamUnderrunModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the behavior of the streaming mode when a period elapses with the FIFO empty.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StreamUnderrunMode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.StreamUnderrunMode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports the number of FIFO underruns since the streaming mode started.
+    /// </summary>
+    [DisplayName("StreamUnderrunCountPayload")]
+    [Description("Creates a message payload that reports the number of FIFO underruns since the streaming mode started.")]
+    public partial class CreateStreamUnderrunCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports the number of FIFO underruns since the streaming mode started.
+        /// </summary>
+        [Description("The value that reports the number of FIFO underruns since the streaming mode started.")]
+        public ushort StreamUnderrunCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StreamUnderrunCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return StreamUnderrunCount;
+        }
+
+        /// <summary>
+        /// Creates a message that reports the number of FIFO underruns since the streaming mode started.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StreamUnderrunCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.StreamUnderrunCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports the number of FIFO underruns since the streaming mode started.
+    /// </summary>
+    [DisplayName("TimestampedStreamUnderrunCountPayload")]
+    [Description("Creates a timestamped message payload that reports the number of FIFO underruns since the streaming mode started.")]
+    public partial class CreateTimestampedStreamUnderrunCountPayload : CreateStreamUnderrunCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports the number of FIFO underruns since the streaming mode started.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StreamUnderrunCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.StreamUnderrunCount.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the number of steps after which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.
+    /// </summary>
+    [DisplayName("StepReportStepsPayload")]
+    [Description("Creates a message payload that sets the number of steps after which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.")]
+    public partial class CreateStepReportStepsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the number of steps after which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.
+        /// </summary>
+        [Description("The value that sets the number of steps after which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.")]
+        public ushort StepReportSteps { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StepReportSteps register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return StepReportSteps;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the number of steps after which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StepReportSteps register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.StepReportSteps.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the number of steps after which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.
+    /// </summary>
+    [DisplayName("TimestampedStepReportStepsPayload")]
+    [Description("Creates a timestamped message payload that sets the number of steps after which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.")]
+    public partial class CreateTimestampedStepReportStepsPayload : CreateStepReportStepsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the number of steps after which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StepReportSteps register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.StepReportSteps.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the period, in ms, at which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.
+    /// </summary>
+    [DisplayName("StepReportPeriodPayload")]
+    [Description("Creates a message payload that sets the period, in ms, at which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.")]
+    public partial class CreateStepReportPeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the period, in ms, at which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.
+        /// </summary>
+        [Description("The value that sets the period, in ms, at which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.")]
+        public ushort StepReportPeriod { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StepReportPeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return StepReportPeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the period, in ms, at which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StepReportPeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.StepReportPeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the period, in ms, at which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.
+    /// </summary>
+    [DisplayName("TimestampedStepReportPeriodPayload")]
+    [Description("Creates a timestamped message payload that sets the period, in ms, at which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.")]
+    public partial class CreateTimestampedStepReportPeriodPayload : CreateStepReportPeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the period, in ms, at which the accumulated steps are reported in StepDelta. A value of zero disables this trigger.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StepReportPeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.StepReportPeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports the net number of steps made since the last report, negative in the reverse direction. Replaces the Step events while StepReportSteps or StepReportPeriod is not zero.
+    /// </summary>
+    [DisplayName("StepDeltaPayload")]
+    [Description("Creates a message payload that reports the net number of steps made since the last report, negative in the reverse direction. Replaces the Step events while StepReportSteps or StepReportPeriod is not zero.")]
+    public partial class CreateStepDeltaPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports the net number of steps made since the last report, negative in the reverse direction. Replaces the Step events while StepReportSteps or StepReportPeriod is not zero.
+        /// </summary>
+        [Description("The value that reports the net number of steps made since the last report, negative in the reverse direction. Replaces the Step events while StepReportSteps or StepReportPeriod is not zero.")]
+        public int StepDelta { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StepDelta register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public int GetPayload()
+        {
+            return StepDelta;
+        }
+
+        /// <summary>
+        /// Creates a message that reports the net number of steps made since the last report, negative in the reverse direction. Replaces the Step events while StepReportSteps or StepReportPeriod is not zero.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StepDelta register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.StepDelta.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports the net number of steps made since the last report, negative in the reverse direction. Replaces the Step events while StepReportSteps or StepReportPeriod is not zero.
+    /// </summary>
+    [DisplayName("TimestampedStepDeltaPayload")]
+    [Description("Creates a timestamped message payload that reports the net number of steps made since the last report, negative in the reverse direction. Replaces the Step events while StepReportSteps or StepReportPeriod is not zero.")]
+    public partial class CreateTimestampedStepDeltaPayload : CreateStepDeltaPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports the net number of steps made since the last report, negative in the reverse direction. Replaces the Step events while StepReportSteps or StepReportPeriod is not zero.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StepDelta register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.StepDelta.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that capture time and level of the last digital input edge while it is configured as a sync input, with microsecond resolution. Sent after the DigitalInputState event of each edge if the InputEdge extended event is enabled.
+    /// </summary>
+    [DisplayName("DigitalInputEdgeTimePayload")]
+    [Description("Creates a message payload that capture time and level of the last digital input edge while it is configured as a sync input, with microsecond resolution. Sent after the DigitalInputState event of each edge if the InputEdge extended event is enabled.")]
+    public partial class CreateDigitalInputEdgeTimePayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the seconds part of the Harp time of the edge.
+        /// </summary>
+        [Description("The seconds part of the Harp time of the edge.")]
+        public uint Seconds { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the microseconds part of the Harp time of the edge.
+        /// </summary>
+        [Description("The microseconds part of the Harp time of the edge.")]
+        public uint Microseconds { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the level of the input after the edge.
+        /// </summary>
+        [Description("The level of the input after the edge.")]
+        public uint State { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputEdgeTime register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputEdgeTimePayload GetPayload()
+        {
+            DigitalInputEdgeTimePayload value;
+            value.Seconds = Seconds;
+            value.Microseconds = Microseconds;
+            value.State = State;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that capture time and level of the last digital input edge while it is configured as a sync input, with microsecond resolution. Sent after the DigitalInputState event of each edge if the InputEdge extended event is enabled.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputEdgeTime register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.DigitalInputEdgeTime.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that capture time and level of the last digital input edge while it is configured as a sync input, with microsecond resolution. Sent after the DigitalInputState event of each edge if the InputEdge extended event is enabled.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputEdgeTimePayload")]
+    [Description("Creates a timestamped message payload that capture time and level of the last digital input edge while it is configured as a sync input, with microsecond resolution. Sent after the DigitalInputState event of each edge if the InputEdge extended event is enabled.")]
+    public partial class CreateTimestampedDigitalInputEdgeTimePayload : CreateDigitalInputEdgeTimePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that capture time and level of the last digital input edge while it is configured as a sync input, with microsecond resolution. Sent after the DigitalInputState event of each edge if the InputEdge extended event is enabled.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputEdgeTime register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.DigitalInputEdgeTime.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that schedules a write of a single value register at a Harp time. Commands already due are fired right away.
+    /// </summary>
+    [DisplayName("ScheduleCommandPayload")]
+    [Description("Creates a message payload that schedules a write of a single value register at a Harp time. Commands already due are fired right away.")]
+    public partial class CreateScheduleCommandPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the seconds part of the Harp time when the register is written.
+        /// </summary>
+        [Description("The seconds part of the Harp time when the register is written.")]
+        public uint Seconds { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the microseconds part of the Harp time when the register is written.
+        /// </summary>
+        [Description("The microseconds part of the Harp time when the register is written.")]
+        public uint Microseconds { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the address of the register to write.
+        /// </summary>
+        [Description("The address of the register to write.")]
+        public uint Address { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the value to write, with the raw bits of the register type.
+        /// </summary>
+        [Description("The value to write, with the raw bits of the register type.")]
+        public uint Value { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ScheduleCommand register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ScheduleCommandPayload GetPayload()
+        {
+            ScheduleCommandPayload value;
+            value.Seconds = Seconds;
+            value.Microseconds = Microseconds;
+            value.Address = Address;
+            value.Value = Value;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that schedules a write of a single value register at a Harp time. Commands already due are fired right away.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ScheduleCommand register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ScheduleCommand.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that schedules a write of a single value register at a Harp time. Commands already due are fired right away.
+    /// </summary>
+    [DisplayName("TimestampedScheduleCommandPayload")]
+    [Description("Creates a timestamped message payload that schedules a write of a single value register at a Harp time. Commands already due are fired right away.")]
+    public partial class CreateTimestampedScheduleCommandPayload : CreateScheduleCommandPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that schedules a write of a single value register at a Harp time. Commands already due are fired right away.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ScheduleCommand register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ScheduleCommand.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of scheduled commands waiting to be fired. Writing zero clears them. Sent when a command fires if the Schedule extended event is enabled.
+    /// </summary>
+    [DisplayName("ScheduleCountPayload")]
+    [Description("Creates a message payload that number of scheduled commands waiting to be fired. Writing zero clears them. Sent when a command fires if the Schedule extended event is enabled.")]
+    public partial class CreateScheduleCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of scheduled commands waiting to be fired. Writing zero clears them. Sent when a command fires if the Schedule extended event is enabled.
+        /// </summary>
+        [Description("The value that number of scheduled commands waiting to be fired. Writing zero clears them. Sent when a command fires if the Schedule extended event is enabled.")]
+        public byte ScheduleCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ScheduleCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return ScheduleCount;
+        }
+
+        /// <summary>
+        /// Creates a message that number of scheduled commands waiting to be fired. Writing zero clears them. Sent when a command fires if the Schedule extended event is enabled.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ScheduleCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ScheduleCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of scheduled commands waiting to be fired. Writing zero clears them. Sent when a command fires if the Schedule extended event is enabled.
+    /// </summary>
+    [DisplayName("TimestampedScheduleCountPayload")]
+    [Description("Creates a timestamped message payload that number of scheduled commands waiting to be fired. Writing zero clears them. Sent when a command fires if the Schedule extended event is enabled.")]
+    public partial class CreateTimestampedScheduleCountPayload : CreateScheduleCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of scheduled commands waiting to be fired. Writing zero clears them. Sent when a command fires if the Schedule extended event is enabled.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ScheduleCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ScheduleCount.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that lateness of the scheduled commands. Any write resets the statistics.
+    /// </summary>
+    [DisplayName("ScheduleStatisticsPayload")]
+    [Description("Creates a message payload that lateness of the scheduled commands. Any write resets the statistics.")]
+    public partial class CreateScheduleStatisticsPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the number of commands fired more than 64 microseconds after their time.
+        /// </summary>
+        [Description("The number of commands fired more than 64 microseconds after their time.")]
+        public uint LateCount { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the maximum lateness, in microseconds.
+        /// </summary>
+        [Description("The maximum lateness, in microseconds.")]
+        public uint MaxLateness { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the lateness, in microseconds, of the last command fired.
+        /// </summary>
+        [Description("The lateness, in microseconds, of the last command fired.")]
+        public uint LastLateness { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ScheduleStatistics register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ScheduleStatisticsPayload GetPayload()
+        {
+            ScheduleStatisticsPayload value;
+            value.LateCount = LateCount;
+            value.MaxLateness = MaxLateness;
+            value.LastLateness = LastLateness;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that lateness of the scheduled commands. Any write resets the statistics.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ScheduleStatistics register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ScheduleStatistics.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that lateness of the scheduled commands. Any write resets the statistics.
+    /// </summary>
+    [DisplayName("TimestampedScheduleStatisticsPayload")]
+    [Description("Creates a timestamped message payload that lateness of the scheduled commands. Any write resets the statistics.")]
+    public partial class CreateTimestampedScheduleStatisticsPayload : CreateScheduleStatisticsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that lateness of the scheduled commands. Any write resets the statistics.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ScheduleStatistics register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ScheduleStatistics.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that microstep mode used by the motor driver. Changes with the step rate while StepMode is Auto.
+    /// </summary>
+    [DisplayName("MicrostepEffectivePayload")]
+    [Description("Creates a message payload that microstep mode used by the motor driver. Changes with the step rate while StepMode is Auto.")]
+    public partial class CreateMicrostepEffectivePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that microstep mode used by the motor driver. Changes with the step rate while StepMode is Auto.
+        /// </summary>
+        [Description("The value that microstep mode used by the motor driver. Changes with the step rate while StepMode is Auto.")]
+        public StepModeType MicrostepEffective { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MicrostepEffective register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public StepModeType GetPayload()
+        {
+            return MicrostepEffective;
+        }
+
+        /// <summary>
+        /// Creates a message that microstep mode used by the motor driver. Changes with the step rate while StepMode is Auto.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MicrostepEffective register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.MicrostepEffective.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that microstep mode used by the motor driver. Changes with the step rate while StepMode is Auto.
+    /// </summary>
+    [DisplayName("TimestampedMicrostepEffectivePayload")]
+    [Description("Creates a timestamped message payload that microstep mode used by the motor driver. Changes with the step rate while StepMode is Auto.")]
+    public partial class CreateTimestampedMicrostepEffectivePayload : CreateMicrostepEffectivePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that microstep mode used by the motor driver. Changes with the step rate while StepMode is Auto.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MicrostepEffective register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.MicrostepEffective.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sTEP rate, in steps per second, above which the automatic microstep mode switches to a coarser mode. It goes back to a finer mode once the rate drops below three quarters of this value.
+    /// </summary>
+    [DisplayName("MicrostepAutoRatePayload")]
+    [Description("Creates a message payload that sTEP rate, in steps per second, above which the automatic microstep mode switches to a coarser mode. It goes back to a finer mode once the rate drops below three quarters of this value.")]
+    public partial class CreateMicrostepAutoRatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sTEP rate, in steps per second, above which the automatic microstep mode switches to a coarser mode. It goes back to a finer mode once the rate drops below three quarters of this value.
+        /// </summary>
+        [Range(min: 100, max: 10000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sTEP rate, in steps per second, above which the automatic microstep mode switches to a coarser mode. It goes back to a finer mode once the rate drops below three quarters of this value.")]
+        public ushort MicrostepAutoRate { get; set; } = 100;
+
+        /// <summary>
+        /// Creates a message payload for the MicrostepAutoRate register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return MicrostepAutoRate;
+        }
+
+        /// <summary>
+        /// Creates a message that sTEP rate, in steps per second, above which the automatic microstep mode switches to a coarser mode. It goes back to a finer mode once the rate drops below three quarters of this value.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MicrostepAutoRate register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.MicrostepAutoRate.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sTEP rate, in steps per second, above which the automatic microstep mode switches to a coarser mode. It goes back to a finer mode once the rate drops below three quarters of this value.
+    /// </summary>
+    [DisplayName("TimestampedMicrostepAutoRatePayload")]
+    [Description("Creates a timestamped message payload that sTEP rate, in steps per second, above which the automatic microstep mode switches to a coarser mode. It goes back to a finer mode once the rate drops below three quarters of this value.")]
+    public partial class CreateTimestampedMicrostepAutoRatePayload : CreateMicrostepAutoRatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sTEP rate, in steps per second, above which the automatic microstep mode switches to a coarser mode. It goes back to a finer mode once the rate drops below three quarters of this value.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MicrostepAutoRate register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.MicrostepAutoRate.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the active events that don't fit in EnableEvents.
+    /// </summary>
+    [DisplayName("EnableEventsExtendedPayload")]
+    [Description("Creates a message payload that specifies the active events that don't fit in EnableEvents.")]
+    public partial class CreateEnableEventsExtendedPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the active events that don't fit in EnableEvents.
+        /// </summary>
+        [Description("The value that specifies the active events that don't fit in EnableEvents.")]
+        public PumpEventsExtended EnableEventsExtended { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnableEventsExtended register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PumpEventsExtended GetPayload()
+        {
+            return EnableEventsExtended;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the active events that don't fit in EnableEvents.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableEventsExtended register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.EnableEventsExtended.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the active events that don't fit in EnableEvents.
+    /// </summary>
+    [DisplayName("TimestampedEnableEventsExtendedPayload")]
+    [Description("Creates a timestamped message payload that specifies the active events that don't fit in EnableEvents.")]
+    public partial class CreateTimestampedEnableEventsExtendedPayload : CreateEnableEventsExtendedPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the active events that don't fit in EnableEvents.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableEventsExtended register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.EnableEventsExtended.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that starts the homing routine towards the given limit switch. It approaches the switch fast, backs off and approaches it again slowly, then sets the position.
+    /// </summary>
+    [DisplayName("HomingPayload")]
+    [Description("Creates a message payload that starts the homing routine towards the given limit switch. It approaches the switch fast, backs off and approaches it again slowly, then sets the position.")]
+    public partial class CreateHomingPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that starts the homing routine towards the given limit switch. It approaches the switch fast, backs off and approaches it again slowly, then sets the position.
+        /// </summary>
+        [Description("The value that starts the homing routine towards the given limit switch. It approaches the switch fast, backs off and approaches it again slowly, then sets the position.")]
+        public HomingCommand Homing { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Homing register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public HomingCommand GetPayload()
+        {
+            return Homing;
+        }
+
+        /// <summary>
+        /// Creates a message that starts the homing routine towards the given limit switch. It approaches the switch fast, backs off and approaches it again slowly, then sets the position.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Homing register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.Homing.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that starts the homing routine towards the given limit switch. It approaches the switch fast, backs off and approaches it again slowly, then sets the position.
+    /// </summary>
+    [DisplayName("TimestampedHomingPayload")]
+    [Description("Creates a timestamped message payload that starts the homing routine towards the given limit switch. It approaches the switch fast, backs off and approaches it again slowly, then sets the position.")]
+    public partial class CreateTimestampedHomingPayload : CreateHomingPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that starts the homing routine towards the given limit switch. It approaches the switch fast, backs off and approaches it again slowly, then sets the position.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Homing register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.Homing.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that phase of the homing routine. Reports Done or Failed when the routine ends.
+    /// </summary>
+    [DisplayName("HomingStatePayload")]
+    [Description("Creates a message payload that phase of the homing routine. Reports Done or Failed when the routine ends.")]
+    public partial class CreateHomingStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that phase of the homing routine. Reports Done or Failed when the routine ends.
+        /// </summary>
+        [Description("The value that phase of the homing routine. Reports Done or Failed when the routine ends.")]
+        public HomingStateType HomingState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the HomingState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public HomingStateType GetPayload()
+        {
+            return HomingState;
+        }
+
+        /// <summary>
+        /// Creates a message that phase of the homing routine. Reports Done or Failed when the routine ends.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the HomingState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.HomingState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that phase of the homing routine. Reports Done or Failed when the routine ends.
+    /// </summary>
+    [DisplayName("TimestampedHomingStatePayload")]
+    [Description("Creates a timestamped message payload that phase of the homing routine. Reports Done or Failed when the routine ends.")]
+    public partial class CreateTimestampedHomingStatePayload : CreateHomingStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that phase of the homing routine. Reports Done or Failed when the routine ends.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the HomingState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.HomingState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that step period, in microseconds, of the approach and of the back-off.
+    /// </summary>
+    [DisplayName("HomingFastPeriodPayload")]
+    [Description("Creates a message payload that step period, in microseconds, of the approach and of the back-off.")]
+    public partial class CreateHomingFastPeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that step period, in microseconds, of the approach and of the back-off.
+        /// </summary>
+        [Range(min: 100, max: 65535000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that step period, in microseconds, of the approach and of the back-off.")]
+        public uint HomingFastPeriod { get; set; } = 100;
+
+        /// <summary>
+        /// Creates a message payload for the HomingFastPeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return HomingFastPeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that step period, in microseconds, of the approach and of the back-off.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the HomingFastPeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.HomingFastPeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that step period, in microseconds, of the approach and of the back-off.
+    /// </summary>
+    [DisplayName("TimestampedHomingFastPeriodPayload")]
+    [Description("Creates a timestamped message payload that step period, in microseconds, of the approach and of the back-off.")]
+    public partial class CreateTimestampedHomingFastPeriodPayload : CreateHomingFastPeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that step period, in microseconds, of the approach and of the back-off.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the HomingFastPeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.HomingFastPeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that step period, in microseconds, of the slow re-approach.
+    /// </summary>
+    [DisplayName("HomingSlowPeriodPayload")]
+    [Description("Creates a message payload that step period, in microseconds, of the slow re-approach.")]
+    public partial class CreateHomingSlowPeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that step period, in microseconds, of the slow re-approach.
+        /// </summary>
+        [Range(min: 100, max: 65535000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that step period, in microseconds, of the slow re-approach.")]
+        public uint HomingSlowPeriod { get; set; } = 100;
+
+        /// <summary>
+        /// Creates a message payload for the HomingSlowPeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return HomingSlowPeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that step period, in microseconds, of the slow re-approach.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the HomingSlowPeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.HomingSlowPeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that step period, in microseconds, of the slow re-approach.
+    /// </summary>
+    [DisplayName("TimestampedHomingSlowPeriodPayload")]
+    [Description("Creates a timestamped message payload that step period, in microseconds, of the slow re-approach.")]
+    public partial class CreateTimestampedHomingSlowPeriodPayload : CreateHomingSlowPeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that step period, in microseconds, of the slow re-approach.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the HomingSlowPeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.HomingSlowPeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that acceleration and deceleration, in steps per second squared, of the approach and of the back-off. Zero disables the ramps.
+    /// </summary>
+    [DisplayName("HomingAccelerationPayload")]
+    [Description("Creates a message payload that acceleration and deceleration, in steps per second squared, of the approach and of the back-off. Zero disables the ramps.")]
+    public partial class CreateHomingAccelerationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that acceleration and deceleration, in steps per second squared, of the approach and of the back-off. Zero disables the ramps.
+        /// </summary>
+        [Description("The value that acceleration and deceleration, in steps per second squared, of the approach and of the back-off. Zero disables the ramps.")]
+        public ushort HomingAcceleration { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the HomingAcceleration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return HomingAcceleration;
+        }
+
+        /// <summary>
+        /// Creates a message that acceleration and deceleration, in steps per second squared, of the approach and of the back-off. Zero disables the ramps.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the HomingAcceleration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.HomingAcceleration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that acceleration and deceleration, in steps per second squared, of the approach and of the back-off. Zero disables the ramps.
+    /// </summary>
+    [DisplayName("TimestampedHomingAccelerationPayload")]
+    [Description("Creates a timestamped message payload that acceleration and deceleration, in steps per second squared, of the approach and of the back-off. Zero disables the ramps.")]
+    public partial class CreateTimestampedHomingAccelerationPayload : CreateHomingAccelerationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that acceleration and deceleration, in steps per second squared, of the approach and of the back-off. Zero disables the ramps.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the HomingAcceleration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.HomingAcceleration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of steps moved away from the switch before the slow re-approach.
+    /// </summary>
+    [DisplayName("HomingBackoffStepsPayload")]
+    [Description("Creates a message payload that number of steps moved away from the switch before the slow re-approach.")]
+    public partial class CreateHomingBackoffStepsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of steps moved away from the switch before the slow re-approach.
+        /// </summary>
+        [Range(min: 1, max: long.MaxValue)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that number of steps moved away from the switch before the slow re-approach.")]
+        public ushort HomingBackoffSteps { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the HomingBackoffSteps register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return HomingBackoffSteps;
+        }
+
+        /// <summary>
+        /// Creates a message that number of steps moved away from the switch before the slow re-approach.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the HomingBackoffSteps register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.HomingBackoffSteps.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of steps moved away from the switch before the slow re-approach.
+    /// </summary>
+    [DisplayName("TimestampedHomingBackoffStepsPayload")]
+    [Description("Creates a timestamped message payload that number of steps moved away from the switch before the slow re-approach.")]
+    public partial class CreateTimestampedHomingBackoffStepsPayload : CreateHomingBackoffStepsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of steps moved away from the switch before the slow re-approach.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the HomingBackoffSteps register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.HomingBackoffSteps.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value of the Position register when the switch is reached on the re-approach.
+    /// </summary>
+    [DisplayName("HomingPositionPayload")]
+    [Description("Creates a message payload that value of the Position register when the switch is reached on the re-approach.")]
+    public partial class CreateHomingPositionPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that value of the Position register when the switch is reached on the re-approach.
+        /// </summary>
+        [Description("The value that value of the Position register when the switch is reached on the re-approach.")]
+        public int HomingPosition { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the HomingPosition register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public int GetPayload()
+        {
+            return HomingPosition;
+        }
+
+        /// <summary>
+        /// Creates a message that value of the Position register when the switch is reached on the re-approach.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the HomingPosition register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.HomingPosition.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that value of the Position register when the switch is reached on the re-approach.
+    /// </summary>
+    [DisplayName("TimestampedHomingPositionPayload")]
+    [Description("Creates a timestamped message payload that value of the Position register when the switch is reached on the re-approach.")]
+    public partial class CreateTimestampedHomingPositionPayload : CreateHomingPositionPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that value of the Position register when the switch is reached on the re-approach.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the HomingPosition register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.HomingPosition.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of steps requested towards a limit switch after it was pressed. These steps are not made. Any write resets the counter.
+    /// </summary>
+    [DisplayName("SwitchOverrunStepsPayload")]
+    [Description("Creates a message payload that number of steps requested towards a limit switch after it was pressed. These steps are not made. Any write resets the counter.")]
+    public partial class CreateSwitchOverrunStepsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of steps requested towards a limit switch after it was pressed. These steps are not made. Any write resets the counter.
+        /// </summary>
+        [Description("The value that number of steps requested towards a limit switch after it was pressed. These steps are not made. Any write resets the counter.")]
+        public ushort SwitchOverrunSteps { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SwitchOverrunSteps register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SwitchOverrunSteps;
+        }
+
+        /// <summary>
+        /// Creates a message that number of steps requested towards a limit switch after it was pressed. These steps are not made. Any write resets the counter.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SwitchOverrunSteps register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.SwitchOverrunSteps.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of steps requested towards a limit switch after it was pressed. These steps are not made. Any write resets the counter.
+    /// </summary>
+    [DisplayName("TimestampedSwitchOverrunStepsPayload")]
+    [Description("Creates a timestamped message payload that number of steps requested towards a limit switch after it was pressed. These steps are not made. Any write resets the counter.")]
+    public partial class CreateTimestampedSwitchOverrunStepsPayload : CreateSwitchOverrunStepsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of steps requested towards a limit switch after it was pressed. These steps are not made. Any write resets the counter.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SwitchOverrunSteps register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.SwitchOverrunSteps.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that end of travel of the step and volume protocols that starts a refill of the syringe instead of stopping. The refill switches the valve on digital output 0 (DO0Sync set to Valve), withdraws what was delivered on the cycle, switches the valve back and resumes the infusion at the same rate.
+    /// </summary>
+    [DisplayName("RefillModePayload")]
+    [Description("Creates a message payload that end of travel of the step and volume protocols that starts a refill of the syringe instead of stopping. The refill switches the valve on digital output 0 (DO0Sync set to Valve), withdraws what was delivered on the cycle, switches the valve back and resumes the infusion at the same rate.")]
+    public partial class CreateRefillModePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that end of travel of the step and volume protocols that starts a refill of the syringe instead of stopping. The refill switches the valve on digital output 0 (DO0Sync set to Valve), withdraws what was delivered on the cycle, switches the valve back and resumes the infusion at the same rate.
+        /// </summary>
+        [Description("The value that end of travel of the step and volume protocols that starts a refill of the syringe instead of stopping. The refill switches the valve on digital output 0 (DO0Sync set to Valve), withdraws what was delivered on the cycle, switches the valve back and resumes the infusion at the same rate.")]
+        public RefillModeType RefillMode { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the RefillMode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public RefillModeType GetPayload()
+        {
+            return RefillMode;
+        }
+
+        /// <summary>
+        /// Creates a message that end of travel of the step and volume protocols that starts a refill of the syringe instead of stopping. The refill switches the valve on digital output 0 (DO0Sync set to Valve), withdraws what was delivered on the cycle, switches the valve back and resumes the infusion at the same rate.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RefillMode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.RefillMode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that end of travel of the step and volume protocols that starts a refill of the syringe instead of stopping. The refill switches the valve on digital output 0 (DO0Sync set to Valve), withdraws what was delivered on the cycle, switches the valve back and resumes the infusion at the same rate.
+    /// </summary>
+    [DisplayName("TimestampedRefillModePayload")]
+    [Description("Creates a timestamped message payload that end of travel of the step and volume protocols that starts a refill of the syringe instead of stopping. The refill switches the valve on digital output 0 (DO0Sync set to Valve), withdraws what was delivered on the cycle, switches the valve back and resumes the infusion at the same rate.")]
+    public partial class CreateTimestampedRefillModePayload : CreateRefillModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that end of travel of the step and volume protocols that starts a refill of the syringe instead of stopping. The refill switches the valve on digital output 0 (DO0Sync set to Valve), withdraws what was delivered on the cycle, switches the valve back and resumes the infusion at the same rate.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RefillMode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.RefillMode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that position where the infusion ends when RefillMode is Position.
+    /// </summary>
+    [DisplayName("RefillEndPositionPayload")]
+    [Description("Creates a message payload that position where the infusion ends when RefillMode is Position.")]
+    public partial class CreateRefillEndPositionPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that position where the infusion ends when RefillMode is Position.
+        /// </summary>
+        [Description("The value that position where the infusion ends when RefillMode is Position.")]
+        public int RefillEndPosition { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the RefillEndPosition register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public int GetPayload()
+        {
+            return RefillEndPosition;
+        }
+
+        /// <summary>
+        /// Creates a message that position where the infusion ends when RefillMode is Position.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RefillEndPosition register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.RefillEndPosition.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that position where the infusion ends when RefillMode is Position.
+    /// </summary>
+    [DisplayName("TimestampedRefillEndPositionPayload")]
+    [Description("Creates a timestamped message payload that position where the infusion ends when RefillMode is Position.")]
+    public partial class CreateTimestampedRefillEndPositionPayload : CreateRefillEndPositionPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that position where the infusion ends when RefillMode is Position.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RefillEndPosition register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.RefillEndPosition.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that step period, in microseconds, of the refill.
+    /// </summary>
+    [DisplayName("RefillPeriodPayload")]
+    [Description("Creates a message payload that step period, in microseconds, of the refill.")]
+    public partial class CreateRefillPeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that step period, in microseconds, of the refill.
+        /// </summary>
+        [Range(min: 100, max: 65535000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that step period, in microseconds, of the refill.")]
+        public uint RefillPeriod { get; set; } = 100;
+
+        /// <summary>
+        /// Creates a message payload for the RefillPeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return RefillPeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that step period, in microseconds, of the refill.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RefillPeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.RefillPeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that step period, in microseconds, of the refill.
+    /// </summary>
+    [DisplayName("TimestampedRefillPeriodPayload")]
+    [Description("Creates a timestamped message payload that step period, in microseconds, of the refill.")]
+    public partial class CreateTimestampedRefillPeriodPayload : CreateRefillPeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that step period, in microseconds, of the refill.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RefillPeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.RefillPeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that acceleration and deceleration, in steps per second squared, of the refill. Zero disables the ramps.
+    /// </summary>
+    [DisplayName("RefillAccelerationPayload")]
+    [Description("Creates a message payload that acceleration and deceleration, in steps per second squared, of the refill. Zero disables the ramps.")]
+    public partial class CreateRefillAccelerationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that acceleration and deceleration, in steps per second squared, of the refill. Zero disables the ramps.
+        /// </summary>
+        [Description("The value that acceleration and deceleration, in steps per second squared, of the refill. Zero disables the ramps.")]
+        public ushort RefillAcceleration { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the RefillAcceleration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return RefillAcceleration;
+        }
+
+        /// <summary>
+        /// Creates a message that acceleration and deceleration, in steps per second squared, of the refill. Zero disables the ramps.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RefillAcceleration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.RefillAcceleration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that acceleration and deceleration, in steps per second squared, of the refill. Zero disables the ramps.
+    /// </summary>
+    [DisplayName("TimestampedRefillAccelerationPayload")]
+    [Description("Creates a timestamped message payload that acceleration and deceleration, in steps per second squared, of the refill. Zero disables the ramps.")]
+    public partial class CreateTimestampedRefillAccelerationPayload : CreateRefillAccelerationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that acceleration and deceleration, in steps per second squared, of the refill. Zero disables the ramps.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RefillAcceleration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.RefillAcceleration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time, in milliseconds, for the valve to settle after each switch.
+    /// </summary>
+    [DisplayName("RefillValveDelayPayload")]
+    [Description("Creates a message payload that time, in milliseconds, for the valve to settle after each switch.")]
+    public partial class CreateRefillValveDelayPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time, in milliseconds, for the valve to settle after each switch.
+        /// </summary>
+        [Description("The value that time, in milliseconds, for the valve to settle after each switch.")]
+        public ushort RefillValveDelay { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the RefillValveDelay register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return RefillValveDelay;
+        }
+
+        /// <summary>
+        /// Creates a message that time, in milliseconds, for the valve to settle after each switch.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RefillValveDelay register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.RefillValveDelay.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time, in milliseconds, for the valve to settle after each switch.
+    /// </summary>
+    [DisplayName("TimestampedRefillValveDelayPayload")]
+    [Description("Creates a timestamped message payload that time, in milliseconds, for the valve to settle after each switch.")]
+    public partial class CreateTimestampedRefillValveDelayPayload : CreateRefillValveDelayPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time, in milliseconds, for the valve to settle after each switch.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RefillValveDelay register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.RefillValveDelay.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reported when the infusion resumes after a refill.
+    /// </summary>
+    [DisplayName("RefillCyclePayload")]
+    [Description("Creates a message payload that reported when the infusion resumes after a refill.")]
+    public partial class CreateRefillCyclePayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the volume, in ul, delivered on the cycle that ended.
+        /// </summary>
+        [Description("The volume, in ul, delivered on the cycle that ended.")]
+        public float Volume { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the time, in milliseconds, without infusion while refilling.
+        /// </summary>
+        [Description("The time, in milliseconds, without infusion while refilling.")]
+        public float DeadTime { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the RefillCycle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public RefillCyclePayload GetPayload()
+        {
+            RefillCyclePayload value;
+            value.Volume = Volume;
+            value.DeadTime = DeadTime;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that reported when the infusion resumes after a refill.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RefillCycle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.RefillCycle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reported when the infusion resumes after a refill.
+    /// </summary>
+    [DisplayName("TimestampedRefillCyclePayload")]
+    [Description("Creates a timestamped message payload that reported when the infusion resumes after a refill.")]
+    public partial class CreateTimestampedRefillCyclePayload : CreateRefillCyclePayload
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// Creates a timestamped message that reported when the infusion resumes after a refill.
         /// </summary>
-        public CreateMessage()
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RefillCycle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            Payload = new CreateEnableMotorDriverPayload();
+            return Harp.SyringePump.RefillCycle.FromPayload(timestamp, messageType, GetPayload());
         }
+    }
 
-        string INamedElement.Name => $"{nameof(SyringePump)}.{GetElementDisplayName(Payload)}";
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that step period, in microseconds, when a long press of the push or pull button starts to jog the motor.
+    /// </summary>
+    [DisplayName("JogPeriodPayload")]
+    [Description("Creates a message payload that step period, in microseconds, when a long press of the push or pull button starts to jog the motor.")]
+    public partial class CreateJogPeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that step period, in microseconds, when a long press of the push or pull button starts to jog the motor.
+        /// </summary>
+        [Range(min: 100, max: 65535000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that step period, in microseconds, when a long press of the push or pull button starts to jog the motor.")]
+        public uint JogPeriod { get; set; } = 100;
+
+        /// <summary>
+        /// Creates a message payload for the JogPeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return JogPeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that step period, in microseconds, when a long press of the push or pull button starts to jog the motor.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the JogPeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.JogPeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that step period, in microseconds, when a long press of the push or pull button starts to jog the motor.
+    /// </summary>
+    [DisplayName("TimestampedJogPeriodPayload")]
+    [Description("Creates a timestamped message payload that step period, in microseconds, when a long press of the push or pull button starts to jog the motor.")]
+    public partial class CreateTimestampedJogPeriodPayload : CreateJogPeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that step period, in microseconds, when a long press of the push or pull button starts to jog the motor.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the JogPeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.JogPeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that acceleration, in steps per second squared, of the jog while the button is held. Zero keeps the jog at JogPeriod.
+    /// </summary>
+    [DisplayName("JogAccelerationPayload")]
+    [Description("Creates a message payload that acceleration, in steps per second squared, of the jog while the button is held. Zero keeps the jog at JogPeriod.")]
+    public partial class CreateJogAccelerationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that acceleration, in steps per second squared, of the jog while the button is held. Zero keeps the jog at JogPeriod.
+        /// </summary>
+        [Description("The value that acceleration, in steps per second squared, of the jog while the button is held. Zero keeps the jog at JogPeriod.")]
+        public ushort JogAcceleration { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the JogAcceleration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return JogAcceleration;
+        }
+
+        /// <summary>
+        /// Creates a message that acceleration, in steps per second squared, of the jog while the button is held. Zero keeps the jog at JogPeriod.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the JogAcceleration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.JogAcceleration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that acceleration, in steps per second squared, of the jog while the button is held. Zero keeps the jog at JogPeriod.
+    /// </summary>
+    [DisplayName("TimestampedJogAccelerationPayload")]
+    [Description("Creates a timestamped message payload that acceleration, in steps per second squared, of the jog while the button is held. Zero keeps the jog at JogPeriod.")]
+    public partial class CreateTimestampedJogAccelerationPayload : CreateJogAccelerationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that acceleration, in steps per second squared, of the jog while the button is held. Zero keeps the jog at JogPeriod.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the JogAcceleration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.JogAcceleration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that step period, in microseconds, the jog accelerates to while the button is held.
+    /// </summary>
+    [DisplayName("JogMinPeriodPayload")]
+    [Description("Creates a message payload that step period, in microseconds, the jog accelerates to while the button is held.")]
+    public partial class CreateJogMinPeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that step period, in microseconds, the jog accelerates to while the button is held.
+        /// </summary>
+        [Range(min: 100, max: 65535000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that step period, in microseconds, the jog accelerates to while the button is held.")]
+        public uint JogMinPeriod { get; set; } = 100;
+
+        /// <summary>
+        /// Creates a message payload for the JogMinPeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return JogMinPeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that step period, in microseconds, the jog accelerates to while the button is held.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the JogMinPeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.JogMinPeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that step period, in microseconds, the jog accelerates to while the button is held.
+    /// </summary>
+    [DisplayName("TimestampedJogMinPeriodPayload")]
+    [Description("Creates a timestamped message payload that step period, in microseconds, the jog accelerates to while the button is held.")]
+    public partial class CreateTimestampedJogMinPeriodPayload : CreateJogMinPeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that step period, in microseconds, the jog accelerates to while the button is held.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the JogMinPeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.JogMinPeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that step period, in microseconds, applied to the running protocol when committed with the Period bit of ProtocolCommit.
+    /// </summary>
+    [DisplayName("ProtocolNextPeriodMicrosecondsPayload")]
+    [Description("Creates a message payload that step period, in microseconds, applied to the running protocol when committed with the Period bit of ProtocolCommit.")]
+    public partial class CreateProtocolNextPeriodMicrosecondsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that step period, in microseconds, applied to the running protocol when committed with the Period bit of ProtocolCommit.
+        /// </summary>
+        [Range(min: 100, max: 65535000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that step period, in microseconds, applied to the running protocol when committed with the Period bit of ProtocolCommit.")]
+        public uint ProtocolNextPeriodMicroseconds { get; set; } = 100;
+
+        /// <summary>
+        /// Creates a message payload for the ProtocolNextPeriodMicroseconds register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return ProtocolNextPeriodMicroseconds;
+        }
+
+        /// <summary>
+        /// Creates a message that step period, in microseconds, applied to the running protocol when committed with the Period bit of ProtocolCommit.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ProtocolNextPeriodMicroseconds register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolNextPeriodMicroseconds.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that step period, in microseconds, applied to the running protocol when committed with the Period bit of ProtocolCommit.
+    /// </summary>
+    [DisplayName("TimestampedProtocolNextPeriodMicrosecondsPayload")]
+    [Description("Creates a timestamped message payload that step period, in microseconds, applied to the running protocol when committed with the Period bit of ProtocolCommit.")]
+    public partial class CreateTimestampedProtocolNextPeriodMicrosecondsPayload : CreateProtocolNextPeriodMicrosecondsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that step period, in microseconds, applied to the running protocol when committed with the Period bit of ProtocolCommit.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ProtocolNextPeriodMicroseconds register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolNextPeriodMicroseconds.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that steps still to make by the running protocol, counted from the step where the commit is applied, when committed with the Steps bit of ProtocolCommit.
+    /// </summary>
+    [DisplayName("ProtocolNextNumberOfStepsPayload")]
+    [Description("Creates a message payload that steps still to make by the running protocol, counted from the step where the commit is applied, when committed with the Steps bit of ProtocolCommit.")]
+    public partial class CreateProtocolNextNumberOfStepsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that steps still to make by the running protocol, counted from the step where the commit is applied, when committed with the Steps bit of ProtocolCommit.
+        /// </summary>
+        [Description("The value that steps still to make by the running protocol, counted from the step where the commit is applied, when committed with the Steps bit of ProtocolCommit.")]
+        public uint ProtocolNextNumberOfSteps { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ProtocolNextNumberOfSteps register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return ProtocolNextNumberOfSteps;
+        }
+
+        /// <summary>
+        /// Creates a message that steps still to make by the running protocol, counted from the step where the commit is applied, when committed with the Steps bit of ProtocolCommit.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ProtocolNextNumberOfSteps register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolNextNumberOfSteps.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that steps still to make by the running protocol, counted from the step where the commit is applied, when committed with the Steps bit of ProtocolCommit.
+    /// </summary>
+    [DisplayName("TimestampedProtocolNextNumberOfStepsPayload")]
+    [Description("Creates a timestamped message payload that steps still to make by the running protocol, counted from the step where the commit is applied, when committed with the Steps bit of ProtocolCommit.")]
+    public partial class CreateTimestampedProtocolNextNumberOfStepsPayload : CreateProtocolNextNumberOfStepsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that steps still to make by the running protocol, counted from the step where the commit is applied, when committed with the Steps bit of ProtocolCommit.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ProtocolNextNumberOfSteps register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.SyringePump.ProtocolNextNumberOfSteps.FromPayload(timestamp, messageType, GetPayload());
+        }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that enables the motor driver.
+    /// that direction applied to the running protocol when committed with the Direction bit of ProtocolCommit. A reversal decelerates to a stop first.
     /// </summary>
-    [DisplayName("EnableMotorDriverPayload")]
-    [Description("Creates a message payload that enables the motor driver.")]
-    public partial class CreateEnableMotorDriverPayload
+    [DisplayName("ProtocolNextDirectionPayload")]
+    [Description("Creates a message payload that direction applied to the running protocol when committed with the Direction bit of ProtocolCommit. A reversal decelerates to a stop first.")]
+    public partial class CreateProtocolNextDirectionPayload
     {
         /// <summary>
-        /// Gets or sets the value that enables the motor driver.
+        /// Gets or sets the value that direction applied to the running protocol when committed with the Direction bit of ProtocolCommit. A reversal decelerates to a stop first.
         /// </summary>
-        [Description("The value that enables the motor driver.")]
-        public EnableFlag EnableMotorDriver { get; set; }
+        [Description("The value that direction applied to the running protocol when committed with the Direction bit of ProtocolCommit. A reversal decelerates to a stop first.")]
+        public ProtocolDirectionState ProtocolNextDirection { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the EnableMotorDriver register.
+        /// Creates a message payload for the ProtocolNextDirection register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public EnableFlag GetPayload()
+        public ProtocolDirectionState GetPayload()
         {
-            return EnableMotorDriver;
+            return ProtocolNextDirection;
         }
 
         /// <summary>
-        /// Creates a message that enables the motor driver.
+        /// Creates a message that direction applied to the running protocol when committed with the Direction bit of ProtocolCommit. A reversal decelerates to a stop first.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableMotorDriver register.</returns>
+        /// <returns>A new message for the ProtocolNextDirection register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.SyringePump.EnableMotorDriver.FromPayload(messageType, GetPayload());
+            return Harp.SyringePump.ProtocolNextDirection.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that enables the motor driver.
+    /// that direction applied to the running protocol when committed with the Direction bit of ProtocolCommit. A reversal decelerates to a stop first.
     /// </summary>
-    [DisplayName("TimestampedEnableMotorDriverPayload")]
-    [Description("Creates a timestamped message payload that enables the motor driver.")]
-    public partial class CreateTimestampedEnableMotorDriverPayload : CreateEnableMotorDriverPayload
+    [DisplayName("TimestampedProtocolNextDirectionPayload")]
+    [Description("Creates a timestamped message payload that direction applied to the running protocol when committed with the Direction bit of ProtocolCommit. A reversal decelerates to a stop first.")]
+    public partial class CreateTimestampedProtocolNextDirectionPayload : CreateProtocolNextDirectionPayload
     {
         /// <summary>
-        /// Creates a timestamped message that enables the motor driver.
+        /// Creates a timestamped message that direction applied to the running protocol when committed with the Direction bit of ProtocolCommit. A reversal decelerates to a stop first.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableMotorDriver register.</returns>
+        /// <returns>A new timestamped message for the ProtocolNextDirection register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.SyringePump.EnableMotorDriver.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.SyringePump.ProtocolNextDirection.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that enables the currently defined protocol.
+    /// that applies the selected ProtocolNext registers to the running step or volume protocol on its next step, ramping from the current rate with the protocol acceleration and deceleration. Reads the fields still to apply and sends an event once they were applied. Writing zero cancels a pending commit.
     /// </summary>
-    [DisplayName("EnableProtocolPayload")]
-    [Description("Creates a message payload that enables the currently defined protocol.")]
-    public partial class CreateEnableProtocolPayload
+    [DisplayName("ProtocolCommitPayload")]
+    [Description("Creates a message payload that applies the selected ProtocolNext registers to the running step or volume protocol on its next step, ramping from the current rate with the protocol acceleration and deceleration. Reads the fields still to apply and sends an event once they were applied. Writing zero cancels a pending commit.")]
+    public partial class CreateProtocolCommitPayload
     {
         /// <summary>
-        /// Gets or sets the value that enables the currently defined protocol.
+        /// Gets or sets the value that applies the selected ProtocolNext registers to the running step or volume protocol on its next step, ramping from the current rate with the protocol acceleration and deceleration. Reads the fields still to apply and sends an event once they were applied. Writing zero cancels a pending commit.
         /// </summary>
-        [Description("The value that enables the currently defined protocol.")]
-        public EnableFlag EnableProtocol { get; set; }
+        [Description("The value that applies the selected ProtocolNext registers to the running step or volume protocol on its next step, ramping from the current rate with the protocol acceleration and deceleration. Reads the fields still to apply and sends an event once they were applied. Writing zero cancels a pending commit.")]
+        public ProtocolCommitFields ProtocolCommit { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the EnableProtocol register.
+        /// Creates a message payload for the ProtocolCommit register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public EnableFlag GetPayload()
+        public ProtocolCommitFields GetPayload()
         {
-            return EnableProtocol;
+            return ProtocolCommit;
         }
 
         /// <summary>
-        /// Creates a message that enables the currently defined protocol.
+        /// Creates a message that applies the selected ProtocolNext registers to the running step or volume protocol on its next step, ramping from the current rate with the protocol acceleration and deceleration. Reads the fields still to apply and sends an event once they were applied. Writing zero cancels a pending commit.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableProtocol register.</returns>
+        /// <returns>A new message for the ProtocolCommit register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.SyringePump.EnableProtocol.FromPayload(messageType, GetPayload());
+            return Harp.SyringePump.ProtocolCommit.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that enables the currently defined protocol.
+    /// that applies the selected ProtocolNext registers to the running step or volume protocol on its next step, ramping from the current rate with the protocol acceleration and deceleration. Reads the fields still to apply and sends an event once they were applied. Writing zero cancels a pending commit.
     /// </summary>
-    [DisplayName("TimestampedEnableProtocolPayload")]
-    [Description("Creates a timestamped message payload that enables the currently defined protocol.")]
-    public partial class CreateTimestampedEnableProtocolPayload : CreateEnableProtocolPayload
+    [DisplayName("TimestampedProtocolCommitPayload")]
+    [Description("Creates a timestamped message payload that applies the selected ProtocolNext registers to the running step or volume protocol on its next step, ramping from the current rate with the protocol acceleration and deceleration. Reads the fields still to apply and sends an event once they were applied. Writing zero cancels a pending commit.")]
+    public partial class CreateTimestampedProtocolCommitPayload : CreateProtocolCommitPayload
     {
         /// <summary>
-        /// Creates a timestamped message that enables the currently defined protocol.
+        /// Creates a timestamped message that applies the selected ProtocolNext registers to the running step or volume protocol on its next step, ramping from the current rate with the protocol acceleration and deceleration. Reads the fields still to apply and sends an event once they were applied. Writing zero cancels a pending commit.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableProtocol register.</returns>
+        /// <returns>A new timestamped message for the ProtocolCommit register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.SyringePump.EnableProtocol.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.SyringePump.ProtocolCommit.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that status of the STEP motor controller pin.
+    /// that the protocol and IO configuration written in a single message. All the values are checked before any is applied, and the write is refused while a protocol runs. Volumes and flowrates are fixed-point.
     /// </summary>
-    [DisplayName("StepPayload")]
-    [Description("Creates a message payload that status of the STEP motor controller pin.")]
-    public partial class CreateStepPayload
+    [DisplayName("ProtocolConfigurationPayload")]
+    [Description("Creates a message payload that the protocol and IO configuration written in a single message. All the values are checked before any is applied, and the write is refused while a protocol runs. Volumes and flowrates are fixed-point.")]
+    public partial class CreateProtocolConfigurationPayload
     {
         /// <summary>
-        /// Gets or sets the value that status of the STEP motor controller pin.
+        /// Gets or sets a value that the type of protocol.
         /// </summary>
-        [Description("The value that status of the STEP motor controller pin.")]
-        public StepState Step { get; set; }
+        [Description("The type of protocol.")]
+        public PumpProtocolType ProtocolType { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Step register.
+        /// Gets or sets a value that the direction of the protocol.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public StepState GetPayload()
-        {
-            return Step;
-        }
+        [Description("The direction of the protocol.")]
+        public ProtocolDirectionState ProtocolDirection { get; set; }
 
         /// <summary>
-        /// Creates a message that status of the STEP motor controller pin.
+        /// Gets or sets a value that the number of steps of the step protocol.
+        /// </summary>
+        [Description("The number of steps of the step protocol.")]
+        public uint NumberOfSteps { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the step period, in microseconds, of the step protocol.
+        /// </summary>
+        [Description("The step period, in microseconds, of the step protocol.")]
+        public uint PeriodMicroseconds { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the flowrate, in nl/s, of the volume protocol.
+        /// </summary>
+        [Description("The flowrate, in nl/s, of the volume protocol.")]
+        public uint Flowrate { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the volume, in nl, of the volume protocol.
+        /// </summary>
+        [Description("The volume, in nl, of the volume protocol.")]
+        public uint Volume { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the calibration offset, in nl.
+        /// </summary>
+        [Description("The calibration offset, in nl.")]
+        public int CalibrationOffset { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the calibration slope, in pl per step.
+        /// </summary>
+        [Description("The calibration slope, in pl per step.")]
+        public uint CalibrationSlope { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the acceleration of the protocols, in steps per second squared.
+        /// </summary>
+        [Description("The acceleration of the protocols, in steps per second squared.")]
+        public uint Acceleration { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the deceleration of the protocols, in steps per second squared.
+        /// </summary>
+        [Description("The deceleration of the protocols, in steps per second squared.")]
+        public uint Deceleration { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the motor microstep mode.
+        /// </summary>
+        [Description("The motor microstep mode.")]
+        public StepModeType MotorMicrostep { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the configuration of the digital input 0.
+        /// </summary>
+        [Description("The configuration of the digital input 0.")]
+        public DI0TriggerConfig DigitalInput0Config { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the configuration of the digital output 0.
+        /// </summary>
+        [Description("The configuration of the digital output 0.")]
+        public DO0SyncConfig DigitalOutput0Config { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the configuration of the digital output 1.
+        /// </summary>
+        [Description("The configuration of the digital output 1.")]
+        public DO1SyncConfig DigitalOutput1Config { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the events enabled.
+        /// </summary>
+        [Description("The events enabled.")]
+        public PumpEvents EnableEvents { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ProtocolConfiguration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ProtocolConfigurationPayload GetPayload()
+        {
+            ProtocolConfigurationPayload value;
+            value.ProtocolType = ProtocolType;
+            value.ProtocolDirection = ProtocolDirection;
+            value.NumberOfSteps = NumberOfSteps;
+            value.PeriodMicroseconds = PeriodMicroseconds;
+            value.Flowrate = Flowrate;
+            value.Volume = Volume;
+            value.CalibrationOffset = CalibrationOffset;
+            value.CalibrationSlope = CalibrationSlope;
+            value.Acceleration = Acceleration;
+            value.Deceleration = Deceleration;
+            value.MotorMicrostep = MotorMicrostep;
+            value.DigitalInput0Config = DigitalInput0Config;
+            value.DigitalOutput0Config = DigitalOutput0Config;
+            value.DigitalOutput1Config = DigitalOutput1Config;
+            value.EnableEvents = EnableEvents;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that the protocol and IO configuration written in a single message. All the values are checked before any is applied, and the write is refused while a protocol runs. Volumes and flowrates are fixed-point.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Step register.</returns>
+        /// <returns>A new message for the ProtocolConfiguration register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.SyringePump.Step.FromPayload(messageType, GetPayload());
+            return Harp.SyringePump.ProtocolConfiguration.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that status of the STEP motor controller pin.
+    /// that the protocol and IO configuration written in a single message. All the values are checked before any is applied, and the write is refused while a protocol runs. Volumes and flowrates are fixed-point.
     /// </summary>
-    [DisplayName("TimestampedStepPayload")]
-    [Description("Creates a timestamped message payload that status of the STEP motor controller pin.")]
-    public partial class CreateTimestampedStepPayload : CreateStepPayload
+    [DisplayName("TimestampedProtocolConfigurationPayload")]
+    [Description("Creates a timestamped message payload that the protocol and IO configuration written in a single message. All the values are checked before any is applied, and the write is refused while a protocol runs. Volumes and flowrates are fixed-point.")]
+    public partial class CreateTimestampedProtocolConfigurationPayload : CreateProtocolConfigurationPayload
     {
         /// <summary>
-        /// Creates a timestamped message that status of the STEP motor controller pin.
+        /// Creates a timestamped message that the protocol and IO configuration written in a single message. All the values are checked before any is applied, and the write is refused while a protocol runs. Volumes and flowrates are fixed-point.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Step register.</returns>
+        /// <returns>A new timestamped message for the ProtocolConfiguration register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.SyringePump.Step.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.SyringePump.ProtocolConfiguration.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that status of the DIR motor controller pin.
+    /// that the progress of the running protocol, or of the last one once it stopped. Sent while the protocol runs as set by ProgressPeriod and ProgressPercent, and once more when it stops.
     /// </summary>
-    [DisplayName("DirectionPayload")]
-    [Description("Creates a message payload that status of the DIR motor controller pin.")]
-    public partial class CreateDirectionPayload
+    [DisplayName("ProtocolProgressPayload")]
+    [Description("Creates a message payload that the progress of the running protocol, or of the last one once it stopped. Sent while the protocol runs as set by ProgressPeriod and ProgressPercent, and once more when it stops.")]
+    public partial class CreateProtocolProgressPayload
     {
         /// <summary>
-        /// Gets or sets the value that status of the DIR motor controller pin.
+        /// Gets or sets a value that the steps made by the protocol, not counting the refill moves.
         /// </summary>
-        [Description("The value that status of the DIR motor controller pin.")]
-        public DirectionState Direction { get; set; }
+        [Description("The steps made by the protocol, not counting the refill moves.")]
+        public uint StepsDone { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Direction register.
+        /// Gets or sets a value that the steps still to make.
+        /// </summary>
+        [Description("The steps still to make.")]
+        public uint StepsRemaining { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the volume delivered, in nl, from the calibration slope.
+        /// </summary>
+        [Description("The volume delivered, in nl, from the calibration slope.")]
+        public uint Volume { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the estimated time, in milliseconds, to make the steps left at the protocol rate.
+        /// </summary>
+        [Description("The estimated time, in milliseconds, to make the steps left at the protocol rate.")]
+        public uint RemainingTime { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ProtocolProgress register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DirectionState GetPayload()
+        public ProtocolProgressPayload GetPayload()
         {
-            return Direction;
+            ProtocolProgressPayload value;
+            value.StepsDone = StepsDone;
+            value.StepsRemaining = StepsRemaining;
+            value.Volume = Volume;
+            value.RemainingTime = RemainingTime;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that status of the DIR motor controller pin.
+        /// Creates a message that the progress of the running protocol, or of the last one once it stopped. Sent while the protocol runs as set by ProgressPeriod and ProgressPercent, and once more when it stops.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Direction register.</returns>
+        /// <returns>A new message for the ProtocolProgress register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.SyringePump.Direction.FromPayload(messageType, GetPayload());
+            return Harp.SyringePump.ProtocolProgress.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that status of the DIR motor controller pin.
+    /// that the progress of the running protocol, or of the last one once it stopped. Sent while the protocol runs as set by ProgressPeriod and ProgressPercent, and once more when it stops.
     /// </summary>
-    [DisplayName("TimestampedDirectionPayload")]
-    [Description("Creates a timestamped message payload that status of the DIR motor controller pin.")]
-    public partial class CreateTimestampedDirectionPayload : CreateDirectionPayload
+    [DisplayName("TimestampedProtocolProgressPayload")]
+    [Description("Creates a timestamped message payload that the progress of the running protocol, or of the last one once it stopped. Sent while the protocol runs as set by ProgressPeriod and ProgressPercent, and once more when it stops.")]
+    public partial class CreateTimestampedProtocolProgressPayload : CreateProtocolProgressPayload
     {
         /// <summary>
-        /// Creates a timestamped message that status of the DIR motor controller pin.
+        /// Creates a timestamped message that the progress of the running protocol, or of the last one once it stopped. Sent while the protocol runs as set by ProgressPeriod and ProgressPercent, and once more when it stops.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Direction register.</returns>
+        /// <returns>A new timestamped message for the ProtocolProgress register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.SyringePump.Direction.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.SyringePump.ProtocolProgress.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that status of the forward limit switch.
+    /// that period, in milliseconds, of the ProtocolProgress events while a protocol runs. Zero disables the periodic events.
     /// </summary>
-    [DisplayName("ForwardSwitchPayload")]
-    [Description("Creates a message payload that status of the forward limit switch.")]
-    public partial class CreateForwardSwitchPayload
+    [DisplayName("ProgressPeriodPayload")]
+    [Description("Creates a message payload that period, in milliseconds, of the ProtocolProgress events while a protocol runs. Zero disables the periodic events.")]
+    public partial class CreateProgressPeriodPayload
     {
         /// <summary>
-        /// Gets or sets the value that status of the forward limit switch.
+        /// Gets or sets the value that period, in milliseconds, of the ProtocolProgress events while a protocol runs. Zero disables the periodic events.
         /// </summary>
-        [Description("The value that status of the forward limit switch.")]
-        public ForwardSwitchState ForwardSwitch { get; set; }
+        [Description("The value that period, in milliseconds, of the ProtocolProgress events while a protocol runs. Zero disables the periodic events.")]
+        public ushort ProgressPeriod { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the ForwardSwitch register.
+        /// Creates a message payload for the ProgressPeriod register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ForwardSwitchState GetPayload()
+        public ushort GetPayload()
         {
-            return ForwardSwitch;
+            return ProgressPeriod;
         }
 
         /// <summary>
-        /// Creates a message that status of the forward limit switch.
+        /// Creates a message that period, in milliseconds, of the ProtocolProgress events while a protocol runs. Zero disables the periodic events.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ForwardSwitch register.</returns>
+        /// <returns>A new message for the ProgressPeriod register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.SyringePump.ForwardSwitch.FromPayload(messageType, GetPayload());
+            return Harp.SyringePump.ProgressPeriod.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that status of the forward limit switch.
+    /// that period, in milliseconds, of the ProtocolProgress events while a protocol runs. Zero disables the periodic events.
     /// </summary>
-    [DisplayName("TimestampedForwardSwitchPayload")]
-    [Description("Creates a timestamped message payload that status of the forward limit switch.")]
-    public partial class CreateTimestampedForwardSwitchPayload : CreateForwardSwitchPayload
+    [DisplayName("TimestampedProgressPeriodPayload")]
+    [Description("Creates a timestamped message payload that period, in milliseconds, of the ProtocolProgress events while a protocol runs. Zero disables the periodic events.")]
+    public partial class CreateTimestampedProgressPeriodPayload : CreateProgressPeriodPayload
     {
         /// <summary>
-        /// Creates a timestamped message that status of the forward limit switch.
+        /// Creates a timestamped message that period, in milliseconds, of the ProtocolProgress events while a protocol runs. Zero disables the periodic events.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ForwardSwitch register.</returns>
+        /// <returns>A new timestamped message for the ProgressPeriod register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.SyringePump.ForwardSwitch.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.SyringePump.ProgressPeriod.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that status of the reverse limit switch.
+    /// that sends a ProtocolProgress event each time the protocol advances this percentage of its steps. Zero disables these events.
     /// </summary>
-    [DisplayName("ReverseSwitchPayload")]
-    [Description("Creates a message payload that status of the reverse limit switch.")]
-    public partial class CreateReverseSwitchPayload
+    [DisplayName("ProgressPercentPayload")]
+    [Description("Creates a message payload that sends a ProtocolProgress event each time the protocol advances this percentage of its steps. Zero disables these events.")]
+    public partial class CreateProgressPercentPayload
     {
         /// <summary>
-        /// Gets or sets the value that status of the reverse limit switch.
+        /// Gets or sets the value that sends a ProtocolProgress event each time the protocol advances this percentage of its steps. Zero disables these events.
         /// </summary>
-        [Description("The value that status of the reverse limit switch.")]
-        public ReverseSwitchState ReverseSwitch { get; set; }
+        [Range(min: long.MinValue, max: 100)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sends a ProtocolProgress event each time the protocol advances this percentage of its steps. Zero disables these events.")]
+        public byte ProgressPercent { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the ReverseSwitch register.
+        /// Creates a message payload for the ProgressPercent register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ReverseSwitchState GetPayload()
+        public byte GetPayload()
         {
-            return ReverseSwitch;
+            return ProgressPercent;
         }
 
         /// <summary>
-        /// Creates a message that status of the reverse limit switch.
+        /// Creates a message that sends a ProtocolProgress event each time the protocol advances this percentage of its steps. Zero disables these events.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ReverseSwitch register.</returns>
+        /// <returns>A new message for the ProgressPercent register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.SyringePump.ReverseSwitch.FromPayload(messageType, GetPayload());
+            return Harp.SyringePump.ProgressPercent.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that status of the reverse limit switch.
+    /// that sends a ProtocolProgress event each time the protocol advances this percentage of its steps. Zero disables these events.
     /// </summary>
-    [DisplayName("TimestampedReverseSwitchPayload")]
-    [Description("Creates a timestamped message payload that status of the reverse limit switch.")]
-    public partial class CreateTimestampedReverseSwitchPayload : CreateReverseSwitchPayload
+    [DisplayName("TimestampedProgressPercentPayload")]
+    [Description("Creates a timestamped message payload that sends a ProtocolProgress event each time the protocol advances this percentage of its steps. Zero disables these events.")]
+    public partial class CreateTimestampedProgressPercentPayload : CreateProgressPercentPayload
     {
         /// <summary>
-        /// Creates a timestamped message that status of the reverse limit switch.
+        /// Creates a timestamped message that sends a ProtocolProgress event each time the protocol advances this percentage of its steps. Zero disables these events.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ReverseSwitch register.</returns>
+        /// <returns>A new timestamped message for the ProgressPercent register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.SyringePump.ReverseSwitch.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.SyringePump.ProgressPercent.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that status of the digital input pin.
+    /// that snapshot of the step, direction, switches, input and protocol states with the position. When enabled in EnableEventsExtended it is sent once on the millisecond after any of the states changed, so the separate events of those registers can be disabled.
     /// </summary>
-    [DisplayName("DigitalInputStatePayload")]
-    [Description("Creates a message payload that status of the digital input pin.")]
-    public partial class CreateDigitalInputStatePayload
+    [DisplayName("StatusPayload")]
+    [Description("Creates a message payload that snapshot of the step, direction, switches, input and protocol states with the position. When enabled in EnableEventsExtended it is sent once on the millisecond after any of the states changed, so the separate events of those registers can be disabled.")]
+    public partial class CreateStatusPayload
     {
         /// <summary>
-        /// Gets or sets the value that status of the digital input pin.
+        /// Gets or sets a value that the packed states.
         /// </summary>
-        [Description("The value that status of the digital input pin.")]
-        public DigitalInputs DigitalInputState { get; set; }
+        [Description("The packed states.")]
+        public StatusFlags Flags { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalInputState register.
+        /// Gets or sets a value that the position, in steps of the current microstep mode.
+        /// </summary>
+        [Description("The position, in steps of the current microstep mode.")]
+        public int Position { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Status register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalInputs GetPayload()
+        public StatusPayload GetPayload()
         {
-            return DigitalInputState;
+            StatusPayload value;
+            value.Flags = Flags;
+            value.Position = Position;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that status of the digital input pin.
+        /// Creates a message that snapshot of the step, direction, switches, input and protocol states with the position. When enabled in EnableEventsExtended it is sent once on the millisecond after any of the states changed, so the separate events of those registers can be disabled.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalInputState register.</returns>
+        /// <returns>A new message for the Status register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.SyringePump.DigitalInputState.FromPayload(messageType, GetPayload());
+            return Harp.SyringePump.Status.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that status of the digital input pin.
+    /// that snapshot of the step, direction, switches, input and protocol states with the position. When enabled in EnableEventsExtended it is sent once on the millisecond after any of the states changed, so the separate events of those registers can be disabled.
     /// </summary>
-    [DisplayName("TimestampedDigitalInputStatePayload")]
-    [Description("Creates a timestamped message payload that status of the digital input pin.")]
-    public partial class CreateTimestampedDigitalInputStatePayload : CreateDigitalInputStatePayload
+    [DisplayName("TimestampedStatusPayload")]
+    [Description("Creates a timestamped message payload that snapshot of the step, direction, switches, input and protocol states with the position. When enabled in EnableEventsExtended it is sent once on the millisecond after any of the states changed, so the separate events of those registers can be disabled.")]
+    public partial class CreateTimestampedStatusPayload : CreateStatusPayload
     {
         /// <summary>
-        /// Creates a timestamped message that status of the digital input pin.
+        /// Creates a timestamped message that snapshot of the step, direction, switches, input and protocol states with the position. When enabled in EnableEventsExtended it is sent once on the millisecond after any of the states changed, so the separate events of those registers can be disabled.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalInputState register.</returns>
+        /// <returns>A new timestamped message for the Status register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.SyringePump.DigitalInputState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.SyringePump.Status.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that set the specified digital output lines.
+    /// that plays the STEP pulses of the Step and Volume protocols from DMA, with hardware timed intervals and one interrupt per block of up to 32 steps. Used from the next start of a protocol when the microstep mode isn't Auto, the refill is off and the Step and Position events are disabled or decimated; otherwise the protocol runs on the step interrupt. Commits are refused while a protocol plays back.
     /// </summary>
-    [DisplayName("DigitalOutputSetPayload")]
-    [Description("Creates a message payload that set the specified digital output lines.")]
-    public partial class CreateDigitalOutputSetPayload
+    [DisplayName("StepPlaybackPayload")]
+    [Description("Creates a message payload that plays the STEP pulses of the Step and Volume protocols from DMA, with hardware timed intervals and one interrupt per block of up to 32 steps. Used from the next start of a protocol when the microstep mode isn't Auto, the refill is off and the Step and Position events are disabled or decimated; otherwise the protocol runs on the step interrupt. Commits are refused while a protocol plays back.")]
+    public partial class CreateStepPlaybackPayload
     {
         /// <summary>
-        /// Gets or sets the value that set the specified digital output lines.
+        /// Gets or sets the value that plays the STEP pulses of the Step and Volume protocols from DMA, with hardware timed intervals and one interrupt per block of up to 32 steps. Used from the next start of a protocol when the microstep mode isn't Auto, the refill is off and the Step and Position events are disabled or decimated; otherwise the protocol runs on the step interrupt. Commits are refused while a protocol plays back.
         /// </summary>
-        [Description("The value that set the specified digital output lines.")]
-        public DigitalOutputs DigitalOutputSet { get; set; }
+        [Description("The value that plays the STEP pulses of the Step and Volume protocols from DMA, with hardware timed intervals and one interrupt per block of up to 32 steps. Used from the next start of a protocol when the microstep mode isn't Auto, the refill is off and the Step and Position events are disabled or decimated; otherwise the protocol runs on the step interrupt. Commits are refused while a protocol plays back.")]
+        public EnableFlag StepPlayback { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputSet register.
+        /// Creates a message payload for the StepPlayback register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public EnableFlag GetPayload()
         {
-            return DigitalOutputSet;
+            return StepPlayback;
         }
 
         /// <summary>
-        /// Creates a message that set the specified digital output lines.
+        /// Creates a message that plays the STEP pulses of the Step and Volume protocols from DMA, with hardware timed intervals and one interrupt per block of up to 32 steps. Used from the next start of a protocol when the microstep mode isn't Auto, the refill is off and the Step and Position events are disabled or decimated; otherwise the protocol runs on the step interrupt. Commits are refused while a protocol plays back.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputSet register.</returns>
+        /// <returns>A new message for the StepPlayback register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.SyringePump.DigitalOutputSet.FromPayload(messageType, GetPayload());
+            return Harp.SyringePump.StepPlayback.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that set the specified digital output lines.
+    /// that plays the STEP pulses of the Step and Volume protocols from DMA, with hardware timed intervals and one interrupt per block of up to 32 steps. Used from the next start of a protocol when the microstep mode isn't Auto, the refill is off and the Step and Position events are disabled or decimated; otherwise the protocol runs on the step interrupt. Commits are refused while a protocol plays back.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputSetPayload")]
-    [Description("Creates a timestamped message payload that set the specified digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputSetPayload : CreateDigitalOutputSetPayload
+    [DisplayName("TimestampedStepPlaybackPayload")]
+    [Description("Creates a timestamped message payload that plays the STEP pulses of the Step and Volume protocols from DMA, with hardware timed intervals and one interrupt per block of up to 32 steps. Used from the next start of a protocol when the microstep mode isn't Auto, the refill is off and the Step and Position events are disabled or decimated; otherwise the protocol runs on the step interrupt. Commits are refused while a protocol plays back.")]
+    public partial class CreateTimestampedStepPlaybackPayload : CreateStepPlaybackPayload
     {
         /// <summary>
-        /// Creates a timestamped message that set the specified digital output lines.
+        /// Creates a timestamped message that plays the STEP pulses of the Step and Volume protocols from DMA, with hardware timed intervals and one interrupt per block of up to 32 steps. Used from the next start of a protocol when the microstep mode isn't Auto, the refill is off and the Step and Position events are disabled or decimated; otherwise the protocol runs on the step interrupt. Commits are refused while a protocol plays back.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputSet register.</returns>
+        /// <returns>A new timestamped message for the StepPlayback register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.SyringePump.DigitalOutputSet.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.SyringePump.StepPlayback.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that clear the specified digital output lines.
+    /// that load of the CPU and latency of the interrupts, in CPU cycles (32 per microsecond). All values saturate at 65535. Any write resets the statistics.
     /// </summary>
-    [DisplayName("DigitalOutputClearPayload")]
-    [Description("Creates a message payload that clear the specified digital output lines.")]
-    public partial class CreateDigitalOutputClearPayload
+    [DisplayName("CpuLoadPayload")]
+    [Description("Creates a message payload that load of the CPU and latency of the interrupts, in CPU cycles (32 per microsecond). All values saturate at 65535. Any write resets the statistics.")]
+    public partial class CreateCpuLoadPayload
     {
         /// <summary>
-        /// Gets or sets the value that clear the specified digital output lines.
+        /// Gets or sets a value that the minimum CPU cycles used by a core tick of 500 microseconds (16000 cycles), including the interrupts served meanwhile.
         /// </summary>
-        [Description("The value that clear the specified digital output lines.")]
-        public DigitalOutputs DigitalOutputClear { get; set; }
+        [Description("The minimum CPU cycles used by a core tick of 500 microseconds (16000 cycles), including the interrupts served meanwhile.")]
+        public ushort TickCyclesMin { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the average CPU cycles used by a core tick, over about the last 16 ticks.
+        /// </summary>
+        [Description("The average CPU cycles used by a core tick, over about the last 16 ticks.")]
+        public ushort TickCyclesAverage { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the maximum CPU cycles used by a core tick.
+        /// </summary>
+        [Description("The maximum CPU cycles used by a core tick.")]
+        public ushort TickCyclesMax { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the worst latency, in CPU cycles, from an edge on DI0 to its interrupt.
+        /// </summary>
+        [Description("The worst latency, in CPU cycles, from an edge on DI0 to its interrupt.")]
+        public ushort LatencyPortB { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the worst latency, in CPU cycles, from an edge on the forward switch to its interrupt.
+        /// </summary>
+        [Description("The worst latency, in CPU cycles, from an edge on the forward switch to its interrupt.")]
+        public ushort LatencyPortC { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the worst latency, in CPU cycles, from an edge on the push button to its interrupt.
+        /// </summary>
+        [Description("The worst latency, in CPU cycles, from an edge on the push button to its interrupt.")]
+        public ushort LatencyPortD { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the number of core ticks that didn't run on time.
+        /// </summary>
+        [Description("The number of core ticks that didn't run on time.")]
+        public ushort MissedTicks { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the number of protocol STEP pulses raised after their end was due.
+        /// </summary>
+        [Description("The number of protocol STEP pulses raised after their end was due.")]
+        public ushort LateSteps { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the number of bytes waiting to be sent on the TX buffer of the core.
+        /// </summary>
+        [Description("The number of bytes waiting to be sent on the TX buffer of the core.")]
+        public ushort TxBufferDepth { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the maximum number of bytes waiting to be sent on the TX buffer of the core.
+        /// </summary>
+        [Description("The maximum number of bytes waiting to be sent on the TX buffer of the core.")]
+        public ushort TxBufferDepthMax { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputClear register.
+        /// Creates a message payload for the CpuLoad register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public CpuLoadPayload GetPayload()
         {
-            return DigitalOutputClear;
+            CpuLoadPayload value;
+            value.TickCyclesMin = TickCyclesMin;
+            value.TickCyclesAverage = TickCyclesAverage;
+            value.TickCyclesMax = TickCyclesMax;
+            value.LatencyPortB = LatencyPortB;
+            value.LatencyPortC = LatencyPortC;
+            value.LatencyPortD = LatencyPortD;
+            value.MissedTicks = MissedTicks;
+            value.LateSteps = LateSteps;
+            value.TxBufferDepth = TxBufferDepth;
+            value.TxBufferDepthMax = TxBufferDepthMax;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that clear the specified digital output lines.
+        /// Creates a message that load of the CPU and latency of the interrupts, in CPU cycles (32 per microsecond). All values saturate at 65535. Any write resets the statistics.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputClear register.</returns>
+        /// <returns>A new message for the CpuLoad register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.SyringePump.DigitalOutputClear.FromPayload(messageType, GetPayload());
+            return Harp.SyringePump.CpuLoad.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that clear the specified digital output lines.
+    /// that load of the CPU and latency of the interrupts, in CPU cycles (32 per microsecond). All values saturate at 65535. Any write resets the statistics.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputClearPayload")]
-    [Description("Creates a timestamped message payload that clear the specified digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputClearPayload : CreateDigitalOutputClearPayload
+    [DisplayName("TimestampedCpuLoadPayload")]
+    [Description("Creates a timestamped message payload that load of the CPU and latency of the interrupts, in CPU cycles (32 per microsecond). All values saturate at 65535. Any write resets the statistics.")]
+    public partial class CreateTimestampedCpuLoadPayload : CreateCpuLoadPayload
     {
         /// <summary>
-        /// Creates a timestamped message that clear the specified digital output lines.
+        /// Creates a timestamped message that load of the CPU and latency of the interrupts, in CPU cycles (32 per microsecond). All values saturate at 65535. Any write resets the statistics.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputClear register.</returns>
+        /// <returns>A new timestamped message for the CpuLoad register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.SyringePump.DigitalOutputClear.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.SyringePump.CpuLoad.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configures which signal is mimicked in the digital output 0.
+    /// that intervals between the STEP pulses raised by the step engine since the last start of a protocol, timestamped on the device. Pulses played back from DMA aren't measured. Any write resets the intervals and the StepJitter histogram.
     /// </summary>
-    [DisplayName("DO0SyncPayload")]
-    [Description("Creates a message payload that configures which signal is mimicked in the digital output 0.")]
-    public partial class CreateDO0SyncPayload
+    [DisplayName("StepIntervalsPayload")]
+    [Description("Creates a message payload that intervals between the STEP pulses raised by the step engine since the last start of a protocol, timestamped on the device. Pulses played back from DMA aren't measured. Any write resets the intervals and the StepJitter histogram.")]
+    public partial class CreateStepIntervalsPayload
     {
         /// <summary>
-        /// Gets or sets the value that configures which signal is mimicked in the digital output 0.
+        /// Gets or sets a value that the number of intervals measured.
         /// </summary>
-        [Description("The value that configures which signal is mimicked in the digital output 0.")]
-        public DO0SyncConfig DO0Sync { get; set; }
+        [Description("The number of intervals measured.")]
+        public uint Count { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO0Sync register.
+        /// Gets or sets a value that the shortest interval, in microseconds.
+        /// </summary>
+        [Description("The shortest interval, in microseconds.")]
+        public uint MinInterval { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the longest interval, in microseconds.
+        /// </summary>
+        [Description("The longest interval, in microseconds.")]
+        public uint MaxInterval { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the mean interval, in microseconds.
+        /// </summary>
+        [Description("The mean interval, in microseconds.")]
+        public uint MeanInterval { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StepIntervals register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DO0SyncConfig GetPayload()
+        public StepIntervalsPayload GetPayload()
         {
-            return DO0Sync;
+            StepIntervalsPayload value;
+            value.Count = Count;
+            value.MinInterval = MinInterval;
+            value.MaxInterval = MaxInterval;
+            value.MeanInterval = MeanInterval;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that configures which signal is mimicked in the digital output 0.
+        /// Creates a message that intervals between the STEP pulses raised by the step engine since the last start of a protocol, timestamped on the device. Pulses played back from DMA aren't measured. Any write resets the intervals and the StepJitter histogram.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO0Sync register.</returns>
+        /// <returns>A new message for the StepIntervals register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.SyringePump.DO0Sync.FromPayload(messageType, GetPayload());
+            return Harp.SyringePump.StepIntervals.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configures which signal is mimicked in the digital output 0.
+    /// that intervals between the STEP pulses raised by the step engine since the last start of a protocol, timestamped on the device. Pulses played back from DMA aren't measured. Any write resets the intervals and the StepJitter histogram.
     /// </summary>
-    [DisplayName("TimestampedDO0SyncPayload")]
-    [Description("Creates a timestamped message payload that configures which signal is mimicked in the digital output 0.")]
-    public partial class CreateTimestampedDO0SyncPayload : CreateDO0SyncPayload
+    [DisplayName("TimestampedStepIntervalsPayload")]
+    [Description("Creates a timestamped message payload that intervals between the STEP pulses raised by the step engine since the last start of a protocol, timestamped on the device. Pulses played back from DMA aren't measured. Any write resets the intervals and the StepJitter histogram.")]
+    public partial class CreateTimestampedStepIntervalsPayload : CreateStepIntervalsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configures which signal is mimicked in the digital output 0.
+        /// Creates a timestamped message that intervals between the STEP pulses raised by the step engine since the last start of a protocol, timestamped on the device. Pulses played back from DMA aren't measured. Any write resets the intervals and the StepJitter histogram.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO0Sync register.</returns>
+        /// <returns>A new timestamped message for the StepIntervals register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.SyringePump.DO0Sync.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.SyringePump.StepIntervals.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configures which signal is mimicked in the digital output 1.
+    /// that histogram of the deviations of the intervals in StepIntervals from the commanded ones. Bin 7 counts the intervals within 1 microsecond of the commanded one, bins 6 to 0 the ones shorter by 1, 2, 4, 8, 16, 32 and 64 or more microseconds and bins 8 to 14 the ones longer by the same amounts. Any write resets the histogram and StepIntervals.
     /// </summary>
-    [DisplayName("DO1SyncPayload")]
-    [Description("Creates a message payload that configures which signal is mimicked in the digital output 1.")]
-    public partial class CreateDO1SyncPayload
+    [DisplayName("StepJitterPayload")]
+    [Description("Creates a message payload that histogram of the deviations of the intervals in StepIntervals from the commanded ones. Bin 7 counts the intervals within 1 microsecond of the commanded one, bins 6 to 0 the ones shorter by 1, 2, 4, 8, 16, 32 and 64 or more microseconds and bins 8 to 14 the ones longer by the same amounts. Any write resets the histogram and StepIntervals.")]
+    public partial class CreateStepJitterPayload
     {
         /// <summary>
-        /// Gets or sets the value that configures which signal is mimicked in the digital output 1.
+        /// Gets or sets the value that histogram of the deviations of the intervals in StepIntervals from the commanded ones. Bin 7 counts the intervals within 1 microsecond of the commanded one, bins 6 to 0 the ones shorter by 1, 2, 4, 8, 16, 32 and 64 or more microseconds and bins 8 to 14 the ones longer by the same amounts. Any write resets the histogram and StepIntervals.
         /// </summary>
-        [Description("The value that configures which signal is mimicked in the digital output 1.")]
-        public DO1SyncConfig DO1Sync { get; set; }
+        [Description("The value that histogram of the deviations of the intervals in StepIntervals from the commanded ones. Bin 7 counts the intervals within 1 microsecond of the commanded one, bins 6 to 0 the ones shorter by 1, 2, 4, 8, 16, 32 and 64 or more microseconds and bins 8 to 14 the ones longer by the same amounts. Any write resets the histogram and StepIntervals.")]
+        public uint[] StepJitter { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO1Sync register.
+        /// Creates a message payload for the StepJitter register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DO1SyncConfig GetPayload()
+        public uint[] GetPayload()
         {
-            return DO1Sync;
+            return StepJitter;
         }
 
         /// <summary>
-        /// Creates a message that configures which signal is mimicked in the digital output 1.
+        /// Creates a message that histogram of the deviations of the intervals in StepIntervals from the commanded ones. Bin 7 counts the intervals within 1 microsecond of the commanded one, bins 6 to 0 the ones shorter by 1, 2, 4, 8, 16, 32 and 64 or more microseconds and bins 8 to 14 the ones longer by the same amounts. Any write resets the histogram and StepIntervals.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO1Sync register.</returns>
+        /// <returns>A new message for the StepJitter register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.SyringePump.DO1Sync.FromPayload(messageType, GetPayload());
+            return Harp.SyringePump.StepJitter.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configures which signal is mimicked in the digital output 1.
+    /// that histogram of the deviations of the intervals in StepIntervals from the commanded ones. Bin 7 counts the intervals within 1 microsecond of the commanded one, bins 6 to 0 the ones shorter by 1, 2, 4, 8, 16, 32 and 64 or more microseconds and bins 8 to 14 the ones longer by the same amounts. Any write resets the histogram and StepIntervals.
     /// </summary>
-    [DisplayName("TimestampedDO1SyncPayload")]
-    [Description("Creates a timestamped message payload that configures which signal is mimicked in the digital output 1.")]
-    public partial class CreateTimestampedDO1SyncPayload : CreateDO1SyncPayload
+    [DisplayName("TimestampedStepJitterPayload")]
+    [Description("Creates a timestamped message payload that histogram of the deviations of the intervals in StepIntervals from the commanded ones. Bin 7 counts the intervals within 1 microsecond of the commanded one, bins 6 to 0 the ones shorter by 1, 2, 4, 8, 16, 32 and 64 or more microseconds and bins 8 to 14 the ones longer by the same amounts. Any write resets the histogram and StepIntervals.")]
+    public partial class CreateTimestampedStepJitterPayload : CreateStepJitterPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configures which signal is mimicked in the digital output 1.
+        /// Creates a timestamped message that histogram of the deviations of the intervals in StepIntervals from the commanded ones. Bin 7 counts the intervals within 1 microsecond of the commanded one, bins 6 to 0 the ones shorter by 1, 2, 4, 8, 16, 32 and 64 or more microseconds and bins 8 to 14 the ones longer by the same amounts. Any write resets the histogram and StepIntervals.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO1Sync register.</returns>
+        /// <returns>A new timestamped message for the StepJitter register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.SyringePump.DO1Sync.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.SyringePump.StepJitter.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that configures the callback function triggered when digital input is triggered.
+    /// Represents the payload of the ProtocolQueueSegment register.
     /// </summary>
-    [DisplayName("DI0TriggerPayload")]
-    [Description("Creates a message payload that configures the callback function triggered when digital input is triggered.")]
-    public partial class CreateDI0TriggerPayload
+    public struct ProtocolQueueSegmentPayload
     {
         /// <summary>
-        /// Gets or sets the value that configures the callback function triggered when digital input is triggered.
+        /// Initializes a new instance of the <see cref="ProtocolQueueSegmentPayload"/> structure.
         /// </summary>
-        [Description("The value that configures the callback function triggered when digital input is triggered.")]
-        public DI0TriggerConfig DI0Trigger { get; set; }
+        /// <param name="stepCount">The number of steps in the segment.</param>
+        /// <param name="period">The period, in microseconds, of each step in the segment.</param>
+        /// <param name="direction">The direction of the segment.</param>
+        /// <param name="dwell">The pause, in microseconds, after the last step of the segment.</param>
+        public ProtocolQueueSegmentPayload(
+            uint stepCount,
+            uint period,
+            ProtocolDirectionState direction,
+            uint dwell)
+        {
+            StepCount = stepCount;
+            Period = period;
+            Direction = direction;
+            Dwell = dwell;
+        }
 
         /// <summary>
-        /// Creates a message payload for the DI0Trigger register.
+        /// The number of steps in the segment.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public DI0TriggerConfig GetPayload()
-        {
-            return DI0Trigger;
-        }
+        public uint StepCount;
 
         /// <summary>
-        /// Creates a message that configures the callback function triggered when digital input is triggered.
+        /// The period, in microseconds, of each step in the segment.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DI0Trigger register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public uint Period;
+
+        /// <summary>
+        /// The direction of the segment.
+        /// </summary>
+        public ProtocolDirectionState Direction;
+
+        /// <summary>
+        /// The pause, in microseconds, after the last step of the segment.
+        /// </summary>
+        public uint Dwell;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the ProtocolQueueSegment register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// ProtocolQueueSegment register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.SyringePump.DI0Trigger.FromPayload(messageType, GetPayload());
+            return "ProtocolQueueSegmentPayload { " +
+                "StepCount = " + StepCount + ", " +
+                "Period = " + Period + ", " +
+                "Direction = " + Direction + ", " +
+                "Dwell = " + Dwell + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that configures the callback function triggered when digital input is triggered.
+    /// Represents the payload of the DigitalInputEdgeTime register.
     /// </summary>
-    [DisplayName("TimestampedDI0TriggerPayload")]
-    [Description("Creates a timestamped message payload that configures the callback function triggered when digital input is triggered.")]
-    public partial class CreateTimestampedDI0TriggerPayload : CreateDI0TriggerPayload
+    public struct DigitalInputEdgeTimePayload
     {
         /// <summary>
-        /// Creates a timestamped message that configures the callback function triggered when digital input is triggered.
+        /// Initializes a new instance of the <see cref="DigitalInputEdgeTimePayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DI0Trigger register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="seconds">The seconds part of the Harp time of the edge.</param>
+        /// <param name="microseconds">The microseconds part of the Harp time of the edge.</param>
+        /// <param name="state">The level of the input after the edge.</param>
+        public DigitalInputEdgeTimePayload(
+            uint seconds,
+            uint microseconds,
+            uint state)
         {
-            return Harp.SyringePump.DI0Trigger.FromPayload(timestamp, messageType, GetPayload());
+            Seconds = seconds;
+            Microseconds = microseconds;
+            State = state;
+        }
+
+        /// <summary>
+        /// The seconds part of the Harp time of the edge.
+        /// </summary>
+        public uint Seconds;
+
+        /// <summary>
+        /// The microseconds part of the Harp time of the edge.
+        /// </summary>
+        public uint Microseconds;
+
+        /// <summary>
+        /// The level of the input after the edge.
+        /// </summary>
+        public uint State;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the DigitalInputEdgeTime register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// DigitalInputEdgeTime register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "DigitalInputEdgeTimePayload { " +
+                "Seconds = " + Seconds + ", " +
+                "Microseconds = " + Microseconds + ", " +
+                "State = " + State + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that sets the motor step mode from a list of available types.
+    /// Represents the payload of the ScheduleCommand register.
     /// </summary>
-    [DisplayName("StepModePayload")]
-    [Description("Creates a message payload that sets the motor step mode from a list of available types.")]
-    public partial class CreateStepModePayload
+    public struct ScheduleCommandPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the motor step mode from a list of available types.
+        /// Initializes a new instance of the <see cref="ScheduleCommandPayload"/> structure.
         /// </summary>
-        [Description("The value that sets the motor step mode from a list of available types.")]
-        public StepModeType StepMode { get; set; }
+        /// <param name="seconds">The seconds part of the Harp time when the register is written.</param>
+        /// <param name="microseconds">The microseconds part of the Harp time when the register is written.</param>
+        /// <param name="address">The address of the register to write.</param>
+        /// <param name="value">The value to write, with the raw bits of the register type.</param>
+        public ScheduleCommandPayload(
+            uint seconds,
+            uint microseconds,
+            uint address,
+            uint value)
+        {
+            Seconds = seconds;
+            Microseconds = microseconds;
+            Address = address;
+            Value = value;
+        }
 
         /// <summary>
-        /// Creates a message payload for the StepMode register.
+        /// The seconds part of the Harp time when the register is written.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public StepModeType GetPayload()
+        public uint Seconds;
+
+        /// <summary>
+        /// The microseconds part of the Harp time when the register is written.
+        /// </summary>
+        public uint Microseconds;
+
+        /// <summary>
+        /// The address of the register to write.
+        /// </summary>
+        public uint Address;
+
+        /// <summary>
+        /// The value to write, with the raw bits of the register type.
+        /// </summary>
+        public uint Value;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the ScheduleCommand register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// ScheduleCommand register.
+        /// </returns>
+        public override string ToString()
         {
-            return StepMode;
+            return "ScheduleCommandPayload { " +
+                "Seconds = " + Seconds + ", " +
+                "Microseconds = " + Microseconds + ", " +
+                "Address = " + Address + ", " +
+                "Value = " + Value + " " +
+            "}";
         }
+    }
 
+    /// <summary>
+    /// Represents the payload of the ScheduleStatistics register.
+    /// </summary>
+    public struct ScheduleStatisticsPayload
+    {
         /// <summary>
-        /// Creates a message that sets the motor step mode from a list of available types.
+        /// Initializes a new instance of the <see cref="ScheduleStatisticsPayload"/> structure.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the StepMode register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        /// <param name="lateCount">The number of commands fired more than 64 microseconds after their time.</param>
+        /// <param name="maxLateness">The maximum lateness, in microseconds.</param>
+        /// <param name="lastLateness">The lateness, in microseconds, of the last command fired.</param>
+        /// <param name="refusedCount">The number of commands whose value was refused by the register when fired.</param>
+        public ScheduleStatisticsPayload(
+            uint lateCount,
+            uint maxLateness,
+            uint lastLateness,
+            uint refusedCount)
         {
-            return Harp.SyringePump.StepMode.FromPayload(messageType, GetPayload());
+            LateCount = lateCount;
+            MaxLateness = maxLateness;
+            LastLateness = lastLateness;
+            RefusedCount = refusedCount;
+        }
+
+        /// <summary>
+        /// The number of commands fired more than 64 microseconds after their time.
+        /// </summary>
+        public uint LateCount;
+
+        /// <summary>
+        /// The maximum lateness, in microseconds.
+        /// </summary>
+        public uint MaxLateness;
+
+        /// <summary>
+        /// The lateness, in microseconds, of the last command fired.
+        /// </summary>
+        public uint LastLateness;
+
+        /// <summary>
+        /// The number of commands whose value was refused by the register when fired.
+        /// </summary>
+        public uint RefusedCount;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the ScheduleStatistics register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// ScheduleStatistics register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "ScheduleStatisticsPayload { " +
+                "LateCount = " + LateCount + ", " +
+                "MaxLateness = " + MaxLateness + ", " +
+                "LastLateness = " + LastLateness + ", " +
+                "RefusedCount = " + RefusedCount + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that sets the motor step mode from a list of available types.
+    /// Represents the payload of the RefillCycle register.
     /// </summary>
-    [DisplayName("TimestampedStepModePayload")]
-    [Description("Creates a timestamped message payload that sets the motor step mode from a list of available types.")]
-    public partial class CreateTimestampedStepModePayload : CreateStepModePayload
+    public struct RefillCyclePayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the motor step mode from a list of available types.
+        /// Initializes a new instance of the <see cref="RefillCyclePayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the StepMode register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="volume">The volume, in ul, delivered on the cycle that ended.</param>
+        /// <param name="deadTime">The time, in milliseconds, without infusion while refilling.</param>
+        public RefillCyclePayload(
+            float volume,
+            float deadTime)
         {
-            return Harp.SyringePump.StepMode.FromPayload(timestamp, messageType, GetPayload());
+            Volume = volume;
+            DeadTime = deadTime;
+        }
+
+        /// <summary>
+        /// The volume, in ul, delivered on the cycle that ended.
+        /// </summary>
+        public float Volume;
+
+        /// <summary>
+        /// The time, in milliseconds, without infusion while refilling.
+        /// </summary>
+        public float DeadTime;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the RefillCycle register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// RefillCycle register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "RefillCyclePayload { " +
+                "Volume = " + Volume + ", " +
+                "DeadTime = " + DeadTime + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that sets the number of steps to be executed in the current protocol.
+    /// Represents the payload of the ProtocolConfiguration register.
     /// </summary>
-    [DisplayName("ProtocolStepCountPayload")]
-    [Description("Creates a message payload that sets the number of steps to be executed in the current protocol.")]
-    public partial class CreateProtocolStepCountPayload
+    public struct ProtocolConfigurationPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the number of steps to be executed in the current protocol.
+        /// Initializes a new instance of the <see cref="ProtocolConfigurationPayload"/> structure.
         /// </summary>
-        [Range(min: 1, max: long.MaxValue)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the number of steps to be executed in the current protocol.")]
-        public ushort ProtocolStepCount { get; set; } = 1;
+        /// <param name="protocolType">The type of protocol.</param>
+        /// <param name="protocolDirection">The direction of the protocol.</param>
+        /// <param name="numberOfSteps">The number of steps of the step protocol.</param>
+        /// <param name="periodMicroseconds">The step period, in microseconds, of the step protocol.</param>
+        /// <param name="flowrate">The flowrate, in nl/s, of the volume protocol.</param>
+        /// <param name="volume">The volume, in nl, of the volume protocol.</param>
+        /// <param name="calibrationOffset">The calibration offset, in nl.</param>
+        /// <param name="calibrationSlope">The calibration slope, in pl per step.</param>
+        /// <param name="acceleration">The acceleration of the protocols, in steps per second squared.</param>
+        /// <param name="deceleration">The deceleration of the protocols, in steps per second squared.</param>
+        /// <param name="motorMicrostep">The motor microstep mode.</param>
+        /// <param name="digitalInput0Config">The configuration of the digital input 0.</param>
+        /// <param name="digitalOutput0Config">The configuration of the digital output 0.</param>
+        /// <param name="digitalOutput1Config">The configuration of the digital output 1.</param>
+        /// <param name="enableEvents">The events enabled.</param>
+        public ProtocolConfigurationPayload(
+            PumpProtocolType protocolType,
+            ProtocolDirectionState protocolDirection,
+            uint numberOfSteps,
+            uint periodMicroseconds,
+            uint flowrate,
+            uint volume,
+            int calibrationOffset,
+            uint calibrationSlope,
+            uint acceleration,
+            uint deceleration,
+            StepModeType motorMicrostep,
+            DI0TriggerConfig digitalInput0Config,
+            DO0SyncConfig digitalOutput0Config,
+            DO1SyncConfig digitalOutput1Config,
+            PumpEvents enableEvents)
+        {
+            ProtocolType = protocolType;
+            ProtocolDirection = protocolDirection;
+            NumberOfSteps = numberOfSteps;
+            PeriodMicroseconds = periodMicroseconds;
+            Flowrate = flowrate;
+            Volume = volume;
+            CalibrationOffset = calibrationOffset;
+            CalibrationSlope = calibrationSlope;
+            Acceleration = acceleration;
+            Deceleration = deceleration;
+            MotorMicrostep = motorMicrostep;
+            DigitalInput0Config = digitalInput0Config;
+            DigitalOutput0Config = digitalOutput0Config;
+            DigitalOutput1Config = digitalOutput1Config;
+            EnableEvents = enableEvents;
+        }
+
+        /// <summary>
+        /// The type of protocol.
+        /// </summary>
+        public PumpProtocolType ProtocolType;
+
+        /// <summary>
+        /// The direction of the protocol.
+        /// </summary>
+        public ProtocolDirectionState ProtocolDirection;
+
+        /// <summary>
+        /// The number of steps of the step protocol.
+        /// </summary>
+        public uint NumberOfSteps;
+
+        /// <summary>
+        /// The step period, in microseconds, of the step protocol.
+        /// </summary>
+        public uint PeriodMicroseconds;
+
+        /// <summary>
+        /// The flowrate, in nl/s, of the volume protocol.
+        /// </summary>
+        public uint Flowrate;
+
+        /// <summary>
+        /// The volume, in nl, of the volume protocol.
+        /// </summary>
+        public uint Volume;
+
+        /// <summary>
+        /// The calibration offset, in nl.
+        /// </summary>
+        public int CalibrationOffset;
+
+        /// <summary>
+        /// The calibration slope, in pl per step.
+        /// </summary>
+        public uint CalibrationSlope;
+
+        /// <summary>
+        /// The acceleration of the protocols, in steps per second squared.
+        /// </summary>
+        public uint Acceleration;
+
+        /// <summary>
+        /// The deceleration of the protocols, in steps per second squared.
+        /// </summary>
+        public uint Deceleration;
+
+        /// <summary>
+        /// The motor microstep mode.
+        /// </summary>
+        public StepModeType MotorMicrostep;
+
+        /// <summary>
+        /// The configuration of the digital input 0.
+        /// </summary>
+        public DI0TriggerConfig DigitalInput0Config;
+
+        /// <summary>
+        /// The configuration of the digital output 0.
+        /// </summary>
+        public DO0SyncConfig DigitalOutput0Config;
+
+        /// <summary>
+        /// The configuration of the digital output 1.
+        /// </summary>
+        public DO1SyncConfig DigitalOutput1Config;
 
         /// <summary>
-        /// Creates a message payload for the ProtocolStepCount register.
+        /// The events enabled.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return ProtocolStepCount;
-        }
+        public PumpEvents EnableEvents;
 
         /// <summary>
-        /// Creates a message that sets the number of steps to be executed in the current protocol.
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the ProtocolConfiguration register.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ProtocolStepCount register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
-        {
-            return Harp.SyringePump.ProtocolStepCount.FromPayload(messageType, GetPayload());
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// ProtocolConfiguration register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "ProtocolConfigurationPayload { " +
+                "ProtocolType = " + ProtocolType + ", " +
+                "ProtocolDirection = " + ProtocolDirection + ", " +
+                "NumberOfSteps = " + NumberOfSteps + ", " +
+                "PeriodMicroseconds = " + PeriodMicroseconds + ", " +
+                "Flowrate = " + Flowrate + ", " +
+                "Volume = " + Volume + ", " +
+                "CalibrationOffset = " + CalibrationOffset + ", " +
+                "CalibrationSlope = " + CalibrationSlope + ", " +
+                "Acceleration = " + Acceleration + ", " +
+                "Deceleration = " + Deceleration + ", " +
+                "MotorMicrostep = " + MotorMicrostep + ", " +
+                "DigitalInput0Config = " + DigitalInput0Config + ", " +
+                "DigitalOutput0Config = " + DigitalOutput0Config + ", " +
+                "DigitalOutput1Config = " + DigitalOutput1Config + ", " +
+                "EnableEvents = " + EnableEvents + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that sets the number of steps to be executed in the current protocol.
+    /// Represents the payload of the ProtocolProgress register.
     /// </summary>
-    [DisplayName("TimestampedProtocolStepCountPayload")]
-    [Description("Creates a timestamped message payload that sets the number of steps to be executed in the current protocol.")]
-    public partial class CreateTimestampedProtocolStepCountPayload : CreateProtocolStepCountPayload
+    public struct ProtocolProgressPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the number of steps to be executed in the current protocol.
+        /// Initializes a new instance of the <see cref="ProtocolProgressPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ProtocolStepCount register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="stepsDone">The steps made by the protocol, not counting the refill moves.</param>
+        /// <param name="stepsRemaining">The steps still to make.</param>
+        /// <param name="volume">The volume delivered, in nl, from the calibration slope.</param>
+        /// <param name="remainingTime">The estimated time, in milliseconds, to make the steps left at the protocol rate.</param>
+        public ProtocolProgressPayload(
+            uint stepsDone,
+            uint stepsRemaining,
+            uint volume,
+            uint remainingTime)
         {
-            return Harp.SyringePump.ProtocolStepCount.FromPayload(timestamp, messageType, GetPayload());
+            StepsDone = stepsDone;
+            StepsRemaining = stepsRemaining;
+            Volume = volume;
+            RemainingTime = remainingTime;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that sets the period, in ms, of of each step in the protocol.
-    /// </summary>
-    [DisplayName("ProtocolPeriodPayload")]
-    [Description("Creates a message payload that sets the period, in ms, of of each step in the protocol.")]
-    public partial class CreateProtocolPeriodPayload
-    {
         /// <summary>
-        /// Gets or sets the value that sets the period, in ms, of of each step in the protocol.
+        /// The steps made by the protocol, not counting the refill moves.
         /// </summary>
-        [Range(min: 1, max: long.MaxValue)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the period, in ms, of of each step in the protocol.")]
-        public ushort ProtocolPeriod { get; set; } = 1;
+        public uint StepsDone;
 
         /// <summary>
-        /// Creates a message payload for the ProtocolPeriod register.
+        /// The steps still to make.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return ProtocolPeriod;
-        }
+        public uint StepsRemaining;
 
         /// <summary>
-        /// Creates a message that sets the period, in ms, of of each step in the protocol.
+        /// The volume delivered, in nl, from the calibration slope.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ProtocolPeriod register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public uint Volume;
+
+        /// <summary>
+        /// The estimated time, in milliseconds, to make the steps left at the protocol rate.
+        /// </summary>
+        public uint RemainingTime;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the ProtocolProgress register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// ProtocolProgress register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.SyringePump.ProtocolPeriod.FromPayload(messageType, GetPayload());
+            return "ProtocolProgressPayload { " +
+                "StepsDone = " + StepsDone + ", " +
+                "StepsRemaining = " + StepsRemaining + ", " +
+                "Volume = " + Volume + ", " +
+                "RemainingTime = " + RemainingTime + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that sets the period, in ms, of of each step in the protocol.
+    /// Represents the payload of the Status register.
     /// </summary>
-    [DisplayName("TimestampedProtocolPeriodPayload")]
-    [Description("Creates a timestamped message payload that sets the period, in ms, of of each step in the protocol.")]
-    public partial class CreateTimestampedProtocolPeriodPayload : CreateProtocolPeriodPayload
+    public struct StatusPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the period, in ms, of of each step in the protocol.
+        /// Initializes a new instance of the <see cref="StatusPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ProtocolPeriod register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="flags">The packed states.</param>
+        /// <param name="position">The position, in steps of the current microstep mode.</param>
+        public StatusPayload(
+            StatusFlags flags,
+            int position)
         {
-            return Harp.SyringePump.ProtocolPeriod.FromPayload(timestamp, messageType, GetPayload());
+            Flags = flags;
+            Position = position;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that specifies all the active events in the device.
-    /// </summary>
-    [DisplayName("EnableEventsPayload")]
-    [Description("Creates a message payload that specifies all the active events in the device.")]
-    public partial class CreateEnableEventsPayload
-    {
         /// <summary>
-        /// Gets or sets the value that specifies all the active events in the device.
+        /// The packed states.
         /// </summary>
-        [Description("The value that specifies all the active events in the device.")]
-        public PumpEvents EnableEvents { get; set; }
+        public StatusFlags Flags;
 
         /// <summary>
-        /// Creates a message payload for the EnableEvents register.
+        /// The position, in steps of the current microstep mode.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public PumpEvents GetPayload()
-        {
-            return EnableEvents;
-        }
+        public int Position;
 
         /// <summary>
-        /// Creates a message that specifies all the active events in the device.
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the Status register.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableEvents register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// Status register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.SyringePump.EnableEvents.FromPayload(messageType, GetPayload());
+            return "StatusPayload { " +
+                "Flags = " + Flags + ", " +
+                "Position = " + Position + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that specifies all the active events in the device.
+    /// Represents the payload of the CpuLoad register.
     /// </summary>
-    [DisplayName("TimestampedEnableEventsPayload")]
-    [Description("Creates a timestamped message payload that specifies all the active events in the device.")]
-    public partial class CreateTimestampedEnableEventsPayload : CreateEnableEventsPayload
+    public struct CpuLoadPayload
     {
         /// <summary>
-        /// Creates a timestamped message that specifies all the active events in the device.
+        /// Initializes a new instance of the <see cref="CpuLoadPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableEvents register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="tickCyclesMin">The minimum CPU cycles used by a core tick of 500 microseconds (16000 cycles), including the interrupts served meanwhile.</param>
+        /// <param name="tickCyclesAverage">The average CPU cycles used by a core tick, over about the last 16 ticks.</param>
+        /// <param name="tickCyclesMax">The maximum CPU cycles used by a core tick.</param>
+        /// <param name="latencyPortB">The worst latency, in CPU cycles, from an edge on DI0 to its interrupt.</param>
+        /// <param name="latencyPortC">The worst latency, in CPU cycles, from an edge on the forward switch to its interrupt.</param>
+        /// <param name="latencyPortD">The worst latency, in CPU cycles, from an edge on the push button to its interrupt.</param>
+        /// <param name="missedTicks">The number of core ticks that didn't run on time.</param>
+        /// <param name="lateSteps">The number of protocol STEP pulses raised after their end was due.</param>
+        /// <param name="txBufferDepth">The number of bytes waiting to be sent on the TX buffer of the core.</param>
+        /// <param name="txBufferDepthMax">The maximum number of bytes waiting to be sent on the TX buffer of the core.</param>
+        public CpuLoadPayload(
+            ushort tickCyclesMin,
+            ushort tickCyclesAverage,
+            ushort tickCyclesMax,
+            ushort latencyPortB,
+            ushort latencyPortC,
+            ushort latencyPortD,
+            ushort missedTicks,
+            ushort lateSteps,
+            ushort txBufferDepth,
+            ushort txBufferDepthMax)
         {
-            return Harp.SyringePump.EnableEvents.FromPayload(timestamp, messageType, GetPayload());
+            TickCyclesMin = tickCyclesMin;
+            TickCyclesAverage = tickCyclesAverage;
+            TickCyclesMax = tickCyclesMax;
+            LatencyPortB = latencyPortB;
+            LatencyPortC = latencyPortC;
+            LatencyPortD = latencyPortD;
+            MissedTicks = missedTicks;
+            LateSteps = lateSteps;
+            TxBufferDepth = txBufferDepth;
+            TxBufferDepthMax = txBufferDepthMax;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that status of the protocol execution.
-    /// </summary>
-    [DisplayName("ProtocolPayload")]
-    [Description("Creates a message payload that status of the protocol execution.")]
-    public partial class CreateProtocolPayload
-    {
         /// <summary>
-        /// Gets or sets the value that status of the protocol execution.
+        /// The minimum CPU cycles used by a core tick of 500 microseconds (16000 cycles), including the interrupts served meanwhile.
         /// </summary>
-        [Description("The value that status of the protocol execution.")]
-        public ProtocolState Protocol { get; set; }
+        public ushort TickCyclesMin;
 
         /// <summary>
-        /// Creates a message payload for the Protocol register.
+        /// The average CPU cycles used by a core tick, over about the last 16 ticks.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ProtocolState GetPayload()
-        {
-            return Protocol;
-        }
+        public ushort TickCyclesAverage;
 
         /// <summary>
-        /// Creates a message that status of the protocol execution.
+        /// The maximum CPU cycles used by a core tick.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Protocol register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
-        {
-            return Harp.SyringePump.Protocol.FromPayload(messageType, GetPayload());
+        public ushort TickCyclesMax;
+
+        /// <summary>
+        /// The worst latency, in CPU cycles, from an edge on DI0 to its interrupt.
+        /// </summary>
+        public ushort LatencyPortB;
+
+        /// <summary>
+        /// The worst latency, in CPU cycles, from an edge on the forward switch to its interrupt.
+        /// </summary>
+        public ushort LatencyPortC;
+
+        /// <summary>
+        /// The worst latency, in CPU cycles, from an edge on the push button to its interrupt.
+        /// </summary>
+        public ushort LatencyPortD;
+
+        /// <summary>
+        /// The number of core ticks that didn't run on time.
+        /// </summary>
+        public ushort MissedTicks;
+
+        /// <summary>
+        /// The number of protocol STEP pulses raised after their end was due.
+        /// </summary>
+        public ushort LateSteps;
+
+        /// <summary>
+        /// The number of bytes waiting to be sent on the TX buffer of the core.
+        /// </summary>
+        public ushort TxBufferDepth;
+
+        /// <summary>
+        /// The maximum number of bytes waiting to be sent on the TX buffer of the core.
+        /// </summary>
+        public ushort TxBufferDepthMax;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the CpuLoad register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// CpuLoad register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "CpuLoadPayload { " +
+                "TickCyclesMin = " + TickCyclesMin + ", " +
+                "TickCyclesAverage = " + TickCyclesAverage + ", " +
+                "TickCyclesMax = " + TickCyclesMax + ", " +
+                "LatencyPortB = " + LatencyPortB + ", " +
+                "LatencyPortC = " + LatencyPortC + ", " +
+                "LatencyPortD = " + LatencyPortD + ", " +
+                "MissedTicks = " + MissedTicks + ", " +
+                "LateSteps = " + LateSteps + ", " +
+                "TxBufferDepth = " + TxBufferDepth + ", " +
+                "TxBufferDepthMax = " + TxBufferDepthMax + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that status of the protocol execution.
+    /// Represents the payload of the StepIntervals register.
     /// </summary>
-    [DisplayName("TimestampedProtocolPayload")]
-    [Description("Creates a timestamped message payload that status of the protocol execution.")]
-    public partial class CreateTimestampedProtocolPayload : CreateProtocolPayload
+    public struct StepIntervalsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that status of the protocol execution.
+        /// Initializes a new instance of the <see cref="StepIntervalsPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Protocol register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="count">The number of intervals measured.</param>
+        /// <param name="minInterval">The shortest interval, in microseconds.</param>
+        /// <param name="maxInterval">The longest interval, in microseconds.</param>
+        /// <param name="meanInterval">The mean interval, in microseconds.</param>
+        public StepIntervalsPayload(
+            uint count,
+            uint minInterval,
+            uint maxInterval,
+            uint meanInterval)
         {
-            return Harp.SyringePump.Protocol.FromPayload(timestamp, messageType, GetPayload());
+            Count = count;
+            MinInterval = minInterval;
+            MaxInterval = maxInterval;
+            MeanInterval = meanInterval;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that sets the direction of the protocol execution.
-    /// </summary>
-    [DisplayName("ProtocolDirectionPayload")]
-    [Description("Creates a message payload that sets the direction of the protocol execution.")]
-    public partial class CreateProtocolDirectionPayload
-    {
         /// <summary>
-        /// Gets or sets the value that sets the direction of the protocol execution.
+        /// The number of intervals measured.
         /// </summary>
-        [Description("The value that sets the direction of the protocol execution.")]
-        public ProtocolDirectionState ProtocolDirection { get; set; }
+        public uint Count;
 
         /// <summary>
-        /// Creates a message payload for the ProtocolDirection register.
+        /// The shortest interval, in microseconds.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ProtocolDirectionState GetPayload()
-        {
-            return ProtocolDirection;
-        }
+        public uint MinInterval;
 
         /// <summary>
-        /// Creates a message that sets the direction of the protocol execution.
+        /// The longest interval, in microseconds.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ProtocolDirection register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
-        {
-            return Harp.SyringePump.ProtocolDirection.FromPayload(messageType, GetPayload());
-        }
-    }
+        public uint MaxInterval;
 
-    /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that sets the direction of the protocol execution.
-    /// </summary>
-    [DisplayName("TimestampedProtocolDirectionPayload")]
-    [Description("Creates a timestamped message payload that sets the direction of the protocol execution.")]
-    public partial class CreateTimestampedProtocolDirectionPayload : CreateProtocolDirectionPayload
-    {
         /// <summary>
-        /// Creates a timestamped message that sets the direction of the protocol execution.
+        /// The mean interval, in microseconds.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ProtocolDirection register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        public uint MeanInterval;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the StepIntervals register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// StepIntervals register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.SyringePump.ProtocolDirection.FromPayload(timestamp, messageType, GetPayload());
+            return "StepIntervalsPayload { " +
+                "Count = " + Count + ", " +
+                "MinInterval = " + MinInterval + ", " +
+                "MaxInterval = " + MaxInterval + ", " +
+                "MeanInterval = " + MeanInterval + " " +
+            "}";
         }
     }
 
@@ -3260,6 +12954,52 @@ namespace Harp.SyringePump
         ForwardSwitch = 0x4,
         ReverseSwitch = 0x8,
         DigitalInput = 0x10,
+        Protocol = 0x20,
+        Position = 0x40,
+        ProtocolQueue = 0x80
+    }
+
+    /// <summary>
+    /// The additional events that can be enabled/disabled.
+    /// </summary>
+    [Flags]
+    public enum PumpEventsExtended : byte
+    {
+        None = 0x0,
+        Microstep = 0x1,
+        Homing = 0x2,
+        Refill = 0x4,
+        ProtocolCommit = 0x8,
+        Progress = 0x10,
+        Status = 0x20,
+        Schedule = 0x40,
+        InputEdge = 0x80
+    }
+
+    /// <summary>
+    /// The protocol parameters applied by a commit.
+    /// </summary>
+    [Flags]
+    public enum ProtocolCommitFields : byte
+    {
+        None = 0x0,
+        Period = 0x1,
+        NumberOfSteps = 0x2,
+        Direction = 0x4
+    }
+
+    /// <summary>
+    /// The states packed in the Status register.
+    /// </summary>
+    [Flags]
+    public enum StatusFlags : byte
+    {
+        None = 0x0,
+        Stepping = 0x1,
+        Direction = 0x2,
+        ForwardSwitch = 0x4,
+        ReverseSwitch = 0x8,
+        Input = 0x10,
         Protocol = 0x20
     }
 
@@ -3305,7 +13045,8 @@ namespace Harp.SyringePump
     public enum DO0SyncConfig : byte
     {
         None = 0,
-        SwitchState = 1
+        SwitchState = 1,
+        Valve = 2
     }
 
     /// <summary>
@@ -3325,7 +13066,8 @@ namespace Harp.SyringePump
     {
         None = 0,
         Step = 1,
-        StartProtocol = 2
+        StartProtocol = 2,
+        FollowStep = 3
     }
 
     /// <summary>
@@ -3337,7 +13079,8 @@ namespace Harp.SyringePump
         Half = 1,
         Quarter = 2,
         Eighth = 3,
-        Sixteenth = 4
+        Sixteenth = 4,
+        Auto = 5
     }
 
     /// <summary>
@@ -3346,7 +13089,9 @@ namespace Harp.SyringePump
     public enum PumpProtocolType : byte
     {
         Step = 0,
-        Volume = 1
+        Volume = 1,
+        Queue = 2,
+        Stream = 3
     }
 
     /// <summary>
@@ -3376,4 +13121,46 @@ namespace Harp.SyringePump
         Reverse = 0,
         Forward = 1
     }
+
+    /// <summary>
+    /// Starts or stops the homing routine.
+    /// </summary>
+    public enum HomingCommand : byte
+    {
+        Stop = 0,
+        Forward = 1,
+        Reverse = 2
+    }
+
+    /// <summary>
+    /// Phases of the homing routine.
+    /// </summary>
+    public enum HomingStateType : byte
+    {
+        Idle = 0,
+        Approach = 1,
+        BackOff = 2,
+        Reapproach = 3,
+        Done = 4,
+        Failed = 5
+    }
+
+    /// <summary>
+    /// Available ends of travel for the refill cycle.
+    /// </summary>
+    public enum RefillModeType : byte
+    {
+        False = 0,
+        Switch = 1,
+        Position = 2
+    }
+
+    /// <summary>
+    /// Available behaviors when the streaming FIFO runs empty.
+    /// </summary>
+    public enum StreamUnderrunMode : byte
+    {
+        Hold = 0,
+        Decay = 1
+    }
 }